@@ -243,6 +243,31 @@ class ApplicationDataBuffer {
    */
   ConversionResult::Type PutDouble(double value);
 
+  /**
+   * Put in buffer a numeric value as C type Tbuf. Unlike the other Put
+   * functions it does not look up the buffer type, so Tbuf must be the C
+   * type of the buffer, which a ConversionPlan resolves once per column.
+   *
+   * @param value Value.
+   * @return Conversion result.
+   */
+  template < typename Tbuf, typename Tin >
+  ConversionResult::Type PutNumAs(Tin value) {
+    if (buffer) {
+      uint8_t* data = static_cast< uint8_t* >(buffer) + byteOffset
+                      + sizeof(Tbuf) * elementOffset;
+      *reinterpret_cast< Tbuf* >(data) = static_cast< Tbuf >(value);
+    }
+
+    if (reslen) {
+      uint8_t* len = reinterpret_cast< uint8_t* >(reslen) + byteOffset
+                     + sizeof(SqlLen) * elementOffset;
+      *reinterpret_cast< SqlLen* >(len) = static_cast< SqlLen >(sizeof(Tbuf));
+    }
+
+    return ConversionResult::Type::AI_SUCCESS;
+  }
+
   /**
    * Put in buffer value of type optional string.
    *
@@ -642,9 +667,6 @@ class ApplicationDataBuffer {
   /** Current element offset. */
   SqlUlen elementOffset;
 };
-
-/** Column binging map type alias. */
-typedef std::map< uint16_t, ApplicationDataBuffer > ColumnBindingMap;
 }  // namespace app
 }  // namespace odbc
 }  // namespace timestream
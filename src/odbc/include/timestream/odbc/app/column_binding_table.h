@@ -0,0 +1,139 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#ifndef _TIMESTREAM_ODBC_APP_COLUMN_BINDING_TABLE
+#define _TIMESTREAM_ODBC_APP_COLUMN_BINDING_TABLE
+
+#include <stdint.h>
+
+#include <vector>
+
+#include "timestream/odbc/app/application_data_buffer.h"
+
+namespace timestream {
+namespace odbc {
+namespace app {
+/**
+ * Application buffers bound to result columns. Buffers are kept in an
+ * array indexed by column index along with the ascending list of the bound
+ * columns, so fetching a row walks the bound columns only and finds each
+ * buffer without a lookup.
+ */
+class ColumnBindingTable {
+ public:
+  /**
+   * Default constructor.
+   */
+  ColumnBindingTable() = default;
+
+  /**
+   * Bind a buffer to a column. A buffer bound to the column before is
+   * replaced.
+   *
+   * @param columnIdx Column index.
+   * @param buffer Buffer to put column data to.
+   */
+  void Bind(uint16_t columnIdx, const ApplicationDataBuffer& buffer);
+
+  /**
+   * Unbind the buffer of a column.
+   *
+   * @param columnIdx Column index.
+   */
+  void Unbind(uint16_t columnIdx);
+
+  /**
+   * Unbind all columns.
+   */
+  void Clear();
+
+  /**
+   * Get the buffer bound to a column.
+   *
+   * @param columnIdx Column index.
+   * @return Buffer, null if the column is not bound.
+   */
+  ApplicationDataBuffer* Find(uint16_t columnIdx) {
+    return IsBound(columnIdx) ? &buffers_[columnIdx] : nullptr;
+  }
+
+  /**
+   * Get the buffer bound to a column. The column must be bound.
+   *
+   * @param columnIdx Column index.
+   * @return Buffer.
+   */
+  ApplicationDataBuffer& GetBuffer(uint16_t columnIdx) {
+    return buffers_[columnIdx];
+  }
+
+  /**
+   * Check if a column is bound.
+   *
+   * @param columnIdx Column index.
+   * @return True if the column is bound.
+   */
+  bool IsBound(uint16_t columnIdx) const {
+    return columnIdx < bound_.size() && bound_[columnIdx] != 0;
+  }
+
+  /**
+   * Get indexes of the bound columns.
+   *
+   * @return Column indexes in ascending order.
+   */
+  const std::vector< uint16_t >& GetBoundColumns() const {
+    return boundColumns_;
+  }
+
+  /**
+   * Get number of bound columns.
+   *
+   * @return Number of bound columns.
+   */
+  size_t GetSize() const {
+    return boundColumns_.size();
+  }
+
+  /**
+   * Set offset in bytes for the buffers of all bound columns.
+   *
+   * @param offset Offset.
+   */
+  void SetByteOffset(SqlUlen offset);
+
+  /**
+   * Set offset in elements for the buffers of all bound columns.
+   *
+   * @param idx Element index.
+   */
+  void SetElementOffset(SqlUlen idx);
+
+ private:
+  /** Buffers indexed by column index. */
+  std::vector< ApplicationDataBuffer > buffers_;
+
+  /** Bound flags indexed by column index. */
+  std::vector< uint8_t > bound_;
+
+  /** Indexes of the bound columns in ascending order. */
+  std::vector< uint16_t > boundColumns_;
+};
+}  // namespace app
+}  // namespace odbc
+}  // namespace timestream
+
+#endif  //_TIMESTREAM_ODBC_APP_COLUMN_BINDING_TABLE
@@ -0,0 +1,265 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#ifndef _TIMESTREAM_ODBC_ASYNC_OPERATION
+#define _TIMESTREAM_ODBC_ASYNC_OPERATION
+
+#include <atomic>
+#include <functional>
+#include <future>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "ignite/common/common.h"
+#include "timestream/odbc/common_types.h"
+#include "timestream/odbc/diagnostic/diagnostic_record_storage.h"
+#include "timestream/odbc/system/odbc_constants.h"
+
+namespace timestream {
+namespace odbc {
+/**
+ * Completion callback of the Driver Manager, set by the
+ * SQL_ATTR_ASYNC_STMT_NOTIFICATION_CALLBACK and
+ * SQL_ATTR_ASYNC_DBC_NOTIFICATION_CALLBACK attributes. Same as
+ * SQL_ASYNC_NOTIFICATION_CALLBACK, the last argument is a BOOL.
+ */
+typedef SQLRETURN(SQL_API* AsyncNotificationCallback)(SQLPOINTER context,
+                                                       int last);
+
+/**
+ * Function of a statement or a connection executed on a worker thread.
+ * The application polls the function by calling it again until it
+ * completes, or is notified of the completion: the callback of the Driver
+ * Manager is called if it is set, otherwise the event of the application
+ * is signalled on Windows.
+ */
+class IGNITE_IMPORT_EXPORT AsyncOperation {
+ public:
+  /**
+   * Constructor.
+   */
+  AsyncOperation();
+
+  /**
+   * Destructor. Waits for the running function.
+   */
+  ~AsyncOperation();
+
+  /**
+   * Start a function on the worker thread.
+   *
+   * @param function ODBC function identifier, e.g. SQL_API_SQLEXECDIRECT.
+   * @param call Function.
+   */
+  void Start(SQLUSMALLINT function,
+             const std::function< SqlResult::Type() >& call);
+
+  /**
+   * Check if a function is started and its result is not collected.
+   *
+   * @return True if a function is running.
+   */
+  bool IsRunning() const {
+    std::lock_guard< std::mutex > locker(mutex_);
+    return result_.valid();
+  }
+
+  /**
+   * Get the running function.
+   *
+   * @return ODBC function identifier.
+   */
+  SQLUSMALLINT GetFunction() const {
+    std::lock_guard< std::mutex > locker(mutex_);
+    return function_;
+  }
+
+  /**
+   * Check if the running function has completed.
+   *
+   * @return True if the result can be collected without blocking.
+   */
+  bool IsCompleted() const;
+
+  /**
+   * Collect the result of the running function, waits for its completion.
+   *
+   * @return Result of the function.
+   */
+  SqlResult::Type Collect();
+
+  /**
+   * Wait for the running function to complete. The result is dropped.
+   */
+  void Wait();
+
+  /**
+   * Mark the running function cancelled.
+   */
+  void Cancel() {
+    cancelled_ = true;
+  }
+
+  /**
+   * Check if the running function is cancelled.
+   *
+   * @return True if the function is cancelled.
+   */
+  bool IsCancelled() const {
+    return cancelled_;
+  }
+
+  /**
+   * Get diagnostic records of the calls of the current thread polling the
+   * running function.
+   *
+   * @return Diagnostic records.
+   */
+  diagnostic::DiagnosticRecordStorage& GetRecords() {
+    std::lock_guard< std::mutex > locker(mutex_);
+    return records_[std::this_thread::get_id()];
+  }
+
+  /**
+   * Get diagnostic records of the calls of the current thread polling the
+   * running function.
+   *
+   * @return Diagnostic records.
+   */
+  const diagnostic::DiagnosticRecordStorage& GetRecords() const {
+    std::lock_guard< std::mutex > locker(mutex_);
+    return records_[std::this_thread::get_id()];
+  }
+
+  /**
+   * Set the result of the polling call of the current thread.
+   *
+   * @param result Result.
+   */
+  void SetPollResult(SqlResult::Type result);
+
+  /**
+   * Fail the polling call of the current thread.
+   *
+   * @param sqlState SQL state of the error.
+   * @param message Error message.
+   */
+  void SetPollError(SqlState::Type sqlState, const std::string& message);
+
+  /**
+   * Set completion callback of the Driver Manager.
+   *
+   * @param callback Callback, nullptr to unset.
+   */
+  void SetCallback(AsyncNotificationCallback callback) {
+    callback_ = callback;
+  }
+
+  /**
+   * Get completion callback of the Driver Manager.
+   *
+   * @return Callback.
+   */
+  AsyncNotificationCallback GetCallback() const {
+    return callback_;
+  }
+
+  /**
+   * Set context passed to the completion callback.
+   *
+   * @param context Context.
+   */
+  void SetContext(SQLPOINTER context) {
+    context_ = context;
+  }
+
+  /**
+   * Get context passed to the completion callback.
+   *
+   * @return Context.
+   */
+  SQLPOINTER GetContext() const {
+    return context_;
+  }
+
+  /**
+   * Set event of the application signalled on completion.
+   *
+   * @param event Event handle, nullptr to unset.
+   */
+  void SetEventHandle(SQLPOINTER event) {
+    event_ = event;
+  }
+
+  /**
+   * Get event of the application signalled on completion.
+   *
+   * @return Event handle.
+   */
+  SQLPOINTER GetEventHandle() const {
+    return event_;
+  }
+
+ private:
+  IGNITE_NO_COPY_ASSIGNMENT(AsyncOperation);
+
+  /**
+   * Notify the completion of a function.
+   *
+   * @param callback Callback of the Driver Manager.
+   * @param context Context passed to the callback.
+   * @param event Event of the application.
+   */
+  static void Notify(AsyncNotificationCallback callback, SQLPOINTER context,
+                     SQLPOINTER event);
+
+  /** Worker thread. */
+  std::thread worker_;
+
+  /** Result of the running function, invalid if none is running. */
+  std::future< SqlResult::Type > result_;
+
+  /** Running function. */
+  SQLUSMALLINT function_;
+
+  /** Flag indicating the running function is cancelled. */
+  std::atomic< bool > cancelled_;
+
+  /** Mutex guarding result_, function_ and records_. */
+  mutable std::mutex mutex_;
+
+  /**
+   * Diagnostic records of the calls polling the running function by
+   * thread. The records of a thread are only changed by the thread.
+   */
+  mutable std::map< std::thread::id, diagnostic::DiagnosticRecordStorage >
+      records_;
+
+  /** Completion callback of the Driver Manager. */
+  AsyncNotificationCallback callback_;
+
+  /** Context passed to the completion callback. */
+  SQLPOINTER context_;
+
+  /** Event of the application. */
+  SQLPOINTER event_;
+};
+}  // namespace odbc
+}  // namespace timestream
+
+#endif  //_TIMESTREAM_ODBC_ASYNC_OPERATION
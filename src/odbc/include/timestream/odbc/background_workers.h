@@ -0,0 +1,97 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#ifndef _TIMESTREAM_ODBC_BACKGROUND_WORKERS
+#define _TIMESTREAM_ODBC_BACKGROUND_WORKERS
+
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "ignite/common/common.h"
+
+namespace timestream {
+namespace odbc {
+/**
+ * Worker threads of the closed queries of a connection. A query hands its
+ * workers over when it is closed so the close does not wait for the page
+ * requests in flight. The finished workers are joined when more workers
+ * are added, and all workers are joined before the connection is closed.
+ */
+class IGNITE_IMPORT_EXPORT BackgroundWorkers {
+ public:
+  /**
+   * Constructor.
+   */
+  BackgroundWorkers() = default;
+
+  /**
+   * Destructor. All workers are joined.
+   */
+  ~BackgroundWorkers();
+
+  /**
+   * Take over the worker threads of a closed query.
+   *
+   * @param workers Worker threads, it is empty on return.
+   * @param isFinished Function returning true when all of the workers are
+   * about to exit, so joining them does not block.
+   */
+  void Add(std::vector< std::thread >& workers,
+           std::function< bool() > isFinished);
+
+  /**
+   * Wait for all workers to exit.
+   */
+  void JoinAll();
+
+  /**
+   * Get number of worker threads which are not joined.
+   *
+   * @return Number of worker threads.
+   */
+  size_t GetSize() const;
+
+ private:
+  IGNITE_NO_COPY_ASSIGNMENT(BackgroundWorkers);
+
+  /** Worker threads of a closed query. */
+  struct Entry {
+    /** Worker threads. */
+    std::vector< std::thread > workers;
+
+    /** Function returning true when the workers are about to exit. */
+    std::function< bool() > isFinished;
+  };
+
+  /**
+   * Join the workers of an entry.
+   *
+   * @param entry Workers of a closed query.
+   */
+  static void Join(Entry& entry);
+
+  /** Mutex guarding entries_. */
+  mutable std::mutex mutex_;
+
+  /** Workers of the closed queries. */
+  std::vector< Entry > entries_;
+};
+}  // namespace odbc
+}  // namespace timestream
+
+#endif  //_TIMESTREAM_ODBC_BACKGROUND_WORKERS
@@ -0,0 +1,167 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#ifndef _TIMESTREAM_ODBC_COLUMNAR_PAGE
+#define _TIMESTREAM_ODBC_COLUMNAR_PAGE
+
+#include <stdint.h>
+
+#include <vector>
+
+#include <timestream/odbc/app/application_data_buffer.h>
+
+#include <aws/timestream-query/model/QueryResult.h>
+#include <aws/timestream-query/model/ScalarType.h>
+
+namespace timestream {
+namespace odbc {
+/**
+ * Scalar columns of a query result page decoded into typed column-major
+ * arrays. A page is decoded once, so fetching a row only copies the
+ * decoded values to the application buffers instead of parsing the
+ * textual datum values again.
+ *
+ * BOOLEAN, INTEGER, BIGINT, DOUBLE, TIMESTAMP, DATE and TIME columns are
+ * decoded. Other columns are left to TimestreamColumn which reads the
+ * datum values directly.
+ */
+class ColumnarPage {
+ public:
+  /**
+   * Constructor. Decodes the page.
+   *
+   * @param result Aws query result page.
+   */
+  explicit ColumnarPage(const Aws::TimestreamQuery::Model::QueryResult& result);
+
+  /**
+   * Destructor.
+   */
+  ~ColumnarPage() = default;
+
+  /**
+   * Check if the column is decoded.
+   *
+   * @param columnIdx Column index, start from 1.
+   * @return True if the column is decoded.
+   */
+  bool IsDecoded(uint32_t columnIdx) const;
+
+  /**
+   * Read decoded value and store it in application data buffer.
+   * The column must be decoded.
+   *
+   * @param columnIdx Column index, start from 1.
+   * @param rowIdx Row index in the page, start from 0.
+   * @param dataBuf Application data buffer.
+   * @return Conversion result.
+   */
+  app::ConversionResult::Type ReadToBuffer(
+      uint32_t columnIdx, size_t rowIdx,
+      app::ApplicationDataBuffer& dataBuf) const;
+
+  /**
+   * Check if a decoded value is null. The column must be decoded and the
+   * row must be in the page.
+   *
+   * @param columnIdx Column index, start from 1.
+   * @param rowIdx Row index in the page, start from 0.
+   * @return True if the value is null.
+   */
+  bool IsNull(uint32_t columnIdx, size_t rowIdx) const {
+    return columns_[columnIdx - 1].nulls[rowIdx] != 0;
+  }
+
+  /**
+   * Get a decoded BOOLEAN, INTEGER or BIGINT value. The column must be
+   * decoded and the row must be in the page.
+   *
+   * @param columnIdx Column index, start from 1.
+   * @param rowIdx Row index in the page, start from 0.
+   * @return Value.
+   */
+  int64_t GetInt(uint32_t columnIdx, size_t rowIdx) const {
+    return columns_[columnIdx - 1].ints[rowIdx];
+  }
+
+  /**
+   * Get a decoded DOUBLE value. The column must be decoded and the row
+   * must be in the page.
+   *
+   * @param columnIdx Column index, start from 1.
+   * @param rowIdx Row index in the page, start from 0.
+   * @return Value.
+   */
+  double GetDouble(uint32_t columnIdx, size_t rowIdx) const {
+    return columns_[columnIdx - 1].doubles[rowIdx];
+  }
+
+  /**
+   * Get memory held by the decoded columns.
+   *
+   * @return Number of bytes.
+   */
+  size_t GetSize() const;
+
+ private:
+  IGNITE_NO_COPY_ASSIGNMENT(ColumnarPage);
+
+  /**
+   * Decoded column.
+   */
+  struct Column {
+    /** Scalar type of the column. */
+    Aws::TimestreamQuery::Model::ScalarType type =
+        Aws::TimestreamQuery::Model::ScalarType::NOT_SET;
+
+    /** Flag indicating if the column is decoded. */
+    bool decoded = false;
+
+    /** Null flag for each row. */
+    std::vector< uint8_t > nulls;
+
+    /**
+     * Integer values. It keeps BOOLEAN, INTEGER and BIGINT values,
+     * TIMESTAMP and TIME values as seconds and DATE values as milliseconds.
+     */
+    std::vector< int64_t > ints;
+
+    /** Nanosecond fractions of TIMESTAMP and TIME values. */
+    std::vector< int32_t > fractions;
+
+    /** DOUBLE values. */
+    std::vector< double > doubles;
+  };
+
+  /**
+   * Decode one column of the page.
+   *
+   * @param result Aws query result page.
+   * @param columnIdx Column index, start from 0.
+   * @param column Column to save decoded values to.
+   * @return True if all rows of the column are decoded.
+   */
+  static bool DecodeColumn(
+      const Aws::TimestreamQuery::Model::QueryResult& result,
+      size_t columnIdx, Column& column);
+
+  /** Decoded columns. */
+  std::vector< Column > columns_;
+};
+}  // namespace odbc
+}  // namespace timestream
+
+#endif  //_TIMESTREAM_ODBC_COLUMNAR_PAGE
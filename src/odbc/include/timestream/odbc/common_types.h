@@ -51,7 +51,10 @@ struct SqlResult {
     AI_NO_DATA,
 
     /** No more data. */
-    AI_NEED_DATA
+    AI_NEED_DATA,
+
+    /** Asynchronous operation is still executing. */
+    AI_STILL_EXECUTING
   };
 };
 
@@ -81,6 +84,9 @@ struct SqlState {
      */
     S01S02_OPTION_VALUE_CHANGED,
 
+    /** Attempt to fetch before the result set returned the first rowset. */
+    S01S06_FETCH_BEFORE_FIRST_ROWSET,
+
     /** The numeric or time data returned for a column was truncated. */
     S01S07_FRACTIONAL_TRUNCATION,
 
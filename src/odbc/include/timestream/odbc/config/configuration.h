@@ -62,6 +62,16 @@
 #define DEFAULT_AAD_TENANT ""
 #define DEFAULT_LOG_LEVEL LogLevel::Type::WARNING_LEVEL
 #define DEFAULT_MAX_ROW_PER_PAGE -1
+#define DEFAULT_PREFETCH_PAGES 1
+#define DEFAULT_METADATA_CACHE_SIZE 0
+#define DEFAULT_METADATA_CACHE_TTL 60
+#define DEFAULT_MAX_RESULT_BUFFER_MB 0
+#define DEFAULT_QUERY_FAN_OUT 1
+#define DEFAULT_FAN_OUT_ORDERED true
+#define DEFAULT_RESULT_CACHE_TTL 0
+#define DEFAULT_RESULT_CACHE_PATH ""
+#define DEFAULT_SCROLL_BUFFER_MB 64
+#define DEFAULT_ADAPTIVE_PAGE_SIZE false
 
 using ignite::odbc::config::SettableValue;
 
@@ -158,6 +168,36 @@ class IGNITE_IMPORT_EXPORT Configuration {
 
     /** Default value for maxRowPerPage attribute */
     static const int32_t maxRowPerPage;
+
+    /** Default value for prefetchPages attribute */
+    static const int32_t prefetchPages;
+
+    /** Default value for metadataCacheSize attribute */
+    static const int32_t metadataCacheSize;
+
+    /** Default value for metadataCacheTTL attribute */
+    static const int32_t metadataCacheTTL;
+
+    /** Default value for maxResultBufferMB attribute */
+    static const int32_t maxResultBufferMB;
+
+    /** Default value for queryFanOut attribute */
+    static const int32_t queryFanOut;
+
+    /** Default value for fanOutOrdered attribute */
+    static const bool fanOutOrdered;
+
+    /** Default value for resultCacheTTL attribute */
+    static const int32_t resultCacheTTL;
+
+    /** Default value for resultCachePath attribute */
+    static const std::string resultCachePath;
+
+    /** Default value for scrollBufferMB attribute */
+    static const int32_t scrollBufferMB;
+
+    /** Default value for adaptivePageSize attribute */
+    static const bool adaptivePageSize;
   };
 
   /**
@@ -750,6 +790,216 @@ class IGNITE_IMPORT_EXPORT Configuration {
    */
   bool IsMaxRowPerPageSet() const;
 
+  /**
+   * Get number of result pages to prefetch.
+   *
+   * @return value PrefetchPages.
+   */
+  int32_t GetPrefetchPages() const;
+
+  /**
+   * Set number of result pages to prefetch.
+   *
+   * @param value PrefetchPages.
+   */
+  void SetPrefetchPages(int32_t value);
+
+  /**
+   * Check if the value set.
+   *
+   * @return @true if PrefetchPages set.
+   */
+  bool IsPrefetchPagesSet() const;
+
+  /**
+   * Get max number of cached result set metadata entries.
+   *
+   * @return value MetadataCacheSize.
+   */
+  int32_t GetMetadataCacheSize() const;
+
+  /**
+   * Set max number of cached result set metadata entries.
+   *
+   * @param value MetadataCacheSize.
+   */
+  void SetMetadataCacheSize(int32_t value);
+
+  /**
+   * Check if the value set.
+   *
+   * @return @true if MetadataCacheSize set.
+   */
+  bool IsMetadataCacheSizeSet() const;
+
+  /**
+   * Get time in seconds a cached result set metadata entry is valid.
+   *
+   * @return value MetadataCacheTTL.
+   */
+  int32_t GetMetadataCacheTTL() const;
+
+  /**
+   * Set time in seconds a cached result set metadata entry is valid.
+   *
+   * @param value MetadataCacheTTL.
+   */
+  void SetMetadataCacheTTL(int32_t value);
+
+  /**
+   * Check if the value set.
+   *
+   * @return @true if MetadataCacheTTL set.
+   */
+  bool IsMetadataCacheTTLSet() const;
+
+  /**
+   * Get max megabytes of result pages buffered by the connection.
+   *
+   * @return value MaxResultBufferMB.
+   */
+  int32_t GetMaxResultBufferMB() const;
+
+  /**
+   * Set max megabytes of result pages buffered by the connection.
+   *
+   * @param value MaxResultBufferMB.
+   */
+  void SetMaxResultBufferMB(int32_t value);
+
+  /**
+   * Check if the value set.
+   *
+   * @return @true if MaxResultBufferMB set.
+   */
+  bool IsMaxResultBufferMBSet() const;
+
+  /**
+   * Get number of time sub-ranges a query is split into.
+   *
+   * @return value QueryFanOut.
+   */
+  int32_t GetQueryFanOut() const;
+
+  /**
+   * Set number of time sub-ranges a query is split into.
+   *
+   * @param value QueryFanOut.
+   */
+  void SetQueryFanOut(int32_t value);
+
+  /**
+   * Check if the value set.
+   *
+   * @return @true if QueryFanOut set.
+   */
+  bool IsQueryFanOutSet() const;
+
+  /**
+   * Check if the results of time sub-ranges are returned in time order.
+   *
+   * @return @true if the results are returned in time order.
+   */
+  bool IsFanOutOrdered() const;
+
+  /**
+   * Set if the results of time sub-ranges are returned in time order.
+   *
+   * @param value @true to return the results in time order.
+   */
+  void SetFanOutOrdered(bool value);
+
+  /**
+   * Check if the value set.
+   *
+   * @return @true if FanOutOrdered set.
+   */
+  bool IsFanOutOrderedSet() const;
+
+  /**
+   * Get time to live of result cache entries in seconds.
+   *
+   * @return value ResultCacheTTL.
+   */
+  int32_t GetResultCacheTTL() const;
+
+  /**
+   * Set time to live of result cache entries in seconds.
+   *
+   * @param value ResultCacheTTL.
+   */
+  void SetResultCacheTTL(int32_t value);
+
+  /**
+   * Check if the value set.
+   *
+   * @return @true if ResultCacheTTL set.
+   */
+  bool IsResultCacheTTLSet() const;
+
+  /**
+   * Get directory of result cache files.
+   *
+   * @return value ResultCachePath.
+   */
+  const std::string& GetResultCachePath() const;
+
+  /**
+   * Set directory of result cache files.
+   *
+   * @param value ResultCachePath.
+   */
+  void SetResultCachePath(const std::string& value);
+
+  /**
+   * Check if the value set.
+   *
+   * @return @true if ResultCachePath set.
+   */
+  bool IsResultCachePathSet() const;
+
+  /**
+   * Get max megabytes of a static cursor result kept in memory.
+   *
+   * @return value ScrollBufferMB.
+   */
+  int32_t GetScrollBufferMB() const;
+
+  /**
+   * Set max megabytes of a static cursor result kept in memory.
+   *
+   * @param value ScrollBufferMB.
+   */
+  void SetScrollBufferMB(int32_t value);
+
+  /**
+   * Check if the value set.
+   *
+   * @return @true if ScrollBufferMB set.
+   */
+  bool IsScrollBufferMBSet() const;
+
+  /**
+   * Check if the page size is adapted to the query.
+   *
+   * @return @true if the page size is adapted.
+   */
+  bool IsAdaptivePageSize() const;
+
+  /**
+   * Set if the page size is adapted to the query.
+   *
+   * @param value @true to adapt the page size.
+   */
+  void SetAdaptivePageSize(bool value);
+
+  /**
+   * Check if the value set.
+   *
+   * @return @true if AdaptivePageSize set.
+   */
+  bool IsAdaptivePageSizeSet() const;
+
   /**
    * Get argument map.
    *
@@ -867,6 +1117,37 @@ class IGNITE_IMPORT_EXPORT Configuration {
 
   /** The max row number in one page returned from TS */
   SettableValue< int32_t > maxRowPerPage = DefaultValue::maxRowPerPage;
+
+  /** The max number of result pages fetched ahead of the cursor */
+  SettableValue< int32_t > prefetchPages = DefaultValue::prefetchPages;
+
+  /** Max number of result set metadata entries cached by the connection */
+  SettableValue< int32_t > metadataCacheSize = DefaultValue::metadataCacheSize;
+
+  /** Time in seconds a cached result set metadata entry is valid */
+  SettableValue< int32_t > metadataCacheTTL = DefaultValue::metadataCacheTTL;
+
+  /** Max megabytes of result pages buffered by the connection */
+  SettableValue< int32_t > maxResultBufferMB = DefaultValue::maxResultBufferMB;
+
+  /** Number of time sub-ranges a query is split into */
+  SettableValue< int32_t > queryFanOut = DefaultValue::queryFanOut;
+
+  /** Return the results of time sub-ranges in time order */
+  SettableValue< bool > fanOutOrdered = DefaultValue::fanOutOrdered;
+
+  /** Time to live of result cache entries in seconds */
+  SettableValue< int32_t > resultCacheTTL = DefaultValue::resultCacheTTL;
+
+  /** Directory of result cache files, empty for the temporary directory */
+  SettableValue< std::string > resultCachePath =
+      DefaultValue::resultCachePath;
+
+  /** Max megabytes of a static cursor result kept in memory */
+  SettableValue< int32_t > scrollBufferMB = DefaultValue::scrollBufferMB;
+
+  /** Adapt the page size to the query */
+  SettableValue< bool > adaptivePageSize = DefaultValue::adaptivePageSize;
 };
 
 template <>
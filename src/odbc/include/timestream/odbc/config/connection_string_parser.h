@@ -116,6 +116,36 @@ class IGNITE_IMPORT_EXPORT ConnectionStringParser {
 
     /** Max number of rows in one page returned from TS. */
     static const std::string maxRowPerPage;
+
+    /** Max number of result pages fetched ahead of the cursor. */
+    static const std::string prefetchPages;
+
+    /** Connection attribute keyword for metadataCacheSize attribute. */
+    static const std::string metadataCacheSize;
+
+    /** Connection attribute keyword for metadataCacheTTL attribute. */
+    static const std::string metadataCacheTTL;
+
+    /** Connection attribute keyword for maxResultBufferMB attribute. */
+    static const std::string maxResultBufferMB;
+
+    /** Connection attribute keyword for queryFanOut attribute. */
+    static const std::string queryFanOut;
+
+    /** Connection attribute keyword for fanOutOrdered attribute. */
+    static const std::string fanOutOrdered;
+
+    /** Connection attribute keyword for resultCacheTTL attribute. */
+    static const std::string resultCacheTTL;
+
+    /** Connection attribute keyword for resultCachePath attribute. */
+    static const std::string resultCachePath;
+
+    /** Connection attribute keyword for scrollBufferMB attribute. */
+    static const std::string scrollBufferMB;
+
+    /** Connection attribute keyword for adaptivePageSize attribute. */
+    static const std::string adaptivePageSize;
   };
 
   /**
@@ -31,8 +31,13 @@
 #include "timestream/odbc/log.h"
 #include "timestream/odbc/ignite_error.h"
 #include "ignite/odbc/odbc_error.h"
+#include "timestream/odbc/async_operation.h"
 #include "timestream/odbc/authentication/saml.h"
+#include "timestream/odbc/background_workers.h"
 #include "timestream/odbc/descriptor.h"
+#include "timestream/odbc/meta/column_meta_cache.h"
+#include "timestream/odbc/result_buffer_budget.h"
+#include "timestream/odbc/result_cache.h"
 
 #include <aws/core/Aws.h>
 #include <aws/core/auth/AWSCredentials.h>
@@ -55,6 +60,9 @@ struct StatementAttributes {
   SqlUlen retrieveData;
   SqlUlen rowsetSize;
   SqlUlen rowArraySize;
+  SqlUlen maxRows;
+  SqlUlen queryTimeout;
+  SqlUlen asyncEnable;
 };
 
 /**
@@ -86,6 +94,40 @@ class IGNITE_IMPORT_EXPORT Connection : public diagnostic::DiagnosableAdapter {
    */
   const config::ConnectionInfo& GetInfo() const;
 
+  /**
+   * Get diagnostic records. While a connection function is executing
+   * asynchronously, the records of the polling calls of the current thread
+   * are returned.
+   *
+   * @return Diagnostic records.
+   */
+  virtual const diagnostic::DiagnosticRecordStorage& GetDiagnosticRecords()
+      const {
+    return asyncOperation_.IsRunning() ? asyncOperation_.GetRecords()
+                                       : diagnosticRecords;
+  }
+
+  /**
+   * Get diagnostic records. While a connection function is executing
+   * asynchronously, the records of the polling calls of the current thread
+   * are returned.
+   *
+   * @return Diagnostic records.
+   */
+  virtual diagnostic::DiagnosticRecordStorage& GetDiagnosticRecords() {
+    return asyncOperation_.IsRunning() ? asyncOperation_.GetRecords()
+                                       : diagnosticRecords;
+  }
+
+  /**
+   * Reject a connection function while a connection function is executing
+   * asynchronously. The function fails with HY010 in the records of the
+   * polling calls, the running function and its records are not touched.
+   *
+   * @return True if the function is rejected.
+   */
+  bool RejectIfAsyncRunning();
+
   /**
    * Get info of any type.
    *
@@ -112,6 +154,10 @@ class IGNITE_IMPORT_EXPORT Connection : public diagnostic::DiagnosableAdapter {
   inline void NativeSql(const CharT* inQuery, int64_t inQueryLen,
                         CharT* outQueryBuffer, int64_t outQueryBufferLen,
                         int64_t* outQueryLen) {
+    if (RejectIfAsyncRunning()) {
+      return;
+    }
+
     IGNITE_ODBC_API_CALL(InternalNativeSql(inQuery, inQueryLen, outQueryBuffer,
                                            outQueryBufferLen, outQueryLen));
   }
@@ -151,6 +197,34 @@ class IGNITE_IMPORT_EXPORT Connection : public diagnostic::DiagnosableAdapter {
   std::shared_ptr< Aws::TimestreamQuery::TimestreamQueryClient >
   GetQueryClient() const;
 
+  /**
+   * Get the result set metadata cache of the connection.
+   *
+   * @return Shared Pointer to result set metadata cache.
+   */
+  std::shared_ptr< meta::ColumnMetaCache > GetMetaCache() const;
+
+  /**
+   * Get the memory budget of result pages of the connection.
+   *
+   * @return Shared Pointer to result buffer budget.
+   */
+  std::shared_ptr< ResultBufferBudget > GetResultBufferBudget() const;
+
+  /**
+   * Get the query result cache of the connection.
+   *
+   * @return Shared Pointer to result cache, null if it is disabled.
+   */
+  std::shared_ptr< ResultCache > GetResultCache() const;
+
+  /**
+   * Get the worker threads of the closed queries of the connection.
+   *
+   * @return Shared Pointer to background workers.
+   */
+  std::shared_ptr< BackgroundWorkers > GetBackgroundWorkers() const;
+
   /**
    * Create statement associated with the connection.
    *
@@ -391,6 +465,17 @@ class IGNITE_IMPORT_EXPORT Connection : public diagnostic::DiagnosableAdapter {
    */
   void Close();
 
+  /**
+   * Run a connection function. If SQL_ATTR_ASYNC_DBC_FUNCTIONS_ENABLE is
+   * on, the function is started in a worker thread and AI_STILL_EXECUTING
+   * is returned, the calls made until it completes poll for its result.
+   *
+   * @param function ODBC function identifier, e.g. SQL_API_SQLCONNECT.
+   * @param call Internal call of the connection function.
+   */
+  void AsyncApiCall(SQLUSMALLINT function,
+                    const std::function< SqlResult::Type() >& call);
+
   /**
    * Get info of any type.
    * Internal call.
@@ -612,6 +697,24 @@ class IGNITE_IMPORT_EXPORT Connection : public diagnostic::DiagnosableAdapter {
   /** Timestream query client. */
   std::shared_ptr< Aws::TimestreamQuery::TimestreamQueryClient > queryClient_;
 
+  /** Result set metadata cache. */
+  std::shared_ptr< meta::ColumnMetaCache > metaCache_;
+
+  /** Memory budget of result pages. */
+  std::shared_ptr< ResultBufferBudget > resultBufferBudget_;
+
+  /** Query result cache, null if it is disabled. */
+  std::shared_ptr< ResultCache > resultCache_;
+
+  /** Worker threads of the closed queries. */
+  std::shared_ptr< BackgroundWorkers > backgroundWorkers_;
+
+  /** Asynchronous execution of the connection functions, SQL_ASYNC_DBC_*. */
+  SqlUlen asyncDbcFunctionsEnable_ = SQL_ASYNC_DBC_ENABLE_OFF;
+
+  /** Asynchronous connection function. */
+  AsyncOperation asyncOperation_;
+
   /** SAML credentials provider */
   std::shared_ptr< TimestreamSAMLCredentialsProvider > samlCredProvider_;
 
@@ -644,6 +747,9 @@ class IGNITE_IMPORT_EXPORT Connection : public diagnostic::DiagnosableAdapter {
     SQL_RD_OFF,               // retrieveData
     1,                        // rowsetSize
     1,                        // rowArraySize
+    0,                        // maxRows
+    0,                        // queryTimeout
+    SQL_ASYNC_ENABLE_OFF,     // asyncEnable
   };
 };
 }  // namespace odbc
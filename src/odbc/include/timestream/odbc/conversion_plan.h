@@ -0,0 +1,111 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#ifndef _TIMESTREAM_ODBC_CONVERSION_PLAN
+#define _TIMESTREAM_ODBC_CONVERSION_PLAN
+
+#include <stdint.h>
+
+#include "timestream/odbc/app/application_data_buffer.h"
+#include "timestream/odbc/columnar_page.h"
+#include "timestream/odbc/type_traits.h"
+
+#include <aws/timestream-query/model/ScalarType.h>
+
+namespace timestream {
+namespace odbc {
+/**
+ * Conversion of a result column to the C type of its bound buffer. The
+ * plan pairs the scalar type of the column with the buffer type once, so
+ * reading a decoded value calls a converter specialized for the pair
+ * instead of switching on both types for every cell.
+ */
+class ConversionPlan {
+ public:
+  /**
+   * Converter of a decoded value of a columnar page.
+   *
+   * @param page Columnar page.
+   * @param columnIdx Column index, start from 1. The column is decoded.
+   * @param rowIdx Row index in the page, start from 0.
+   * @param dataBuf Application data buffer.
+   * @return Conversion result.
+   */
+  typedef app::ConversionResult::Type (*Converter)(
+      const ColumnarPage& page, uint32_t columnIdx, size_t rowIdx,
+      app::ApplicationDataBuffer& dataBuf);
+
+  /**
+   * Default constructor. The plan is not resolved.
+   */
+  ConversionPlan();
+
+  /**
+   * Resolve the plan.
+   *
+   * @param scalarType Scalar type of the column.
+   * @param targetType Type of the bound buffer.
+   */
+  void Resolve(Aws::TimestreamQuery::Model::ScalarType scalarType,
+               type_traits::OdbcNativeType::Type targetType);
+
+  /**
+   * Check if the plan is resolved for a buffer type. A column can be bound
+   * again to a buffer of another type between fetches.
+   *
+   * @param targetType Type of the bound buffer.
+   * @return True if the plan is resolved for the type.
+   */
+  bool IsResolvedFor(type_traits::OdbcNativeType::Type targetType) const {
+    return resolved_ && targetType_ == targetType;
+  }
+
+  /**
+   * Get converter of decoded values.
+   *
+   * @return Converter, null if the values are read from the datum values
+   * of the page.
+   */
+  Converter GetConverter() const {
+    return converter_;
+  }
+
+  /**
+   * Find converter of decoded values of a scalar type to a buffer type.
+   *
+   * @param scalarType Scalar type of the column.
+   * @param targetType Type of the bound buffer.
+   * @return Converter, null if the values are read from the datum values
+   * of the page.
+   */
+  static Converter FindConverter(
+      Aws::TimestreamQuery::Model::ScalarType scalarType,
+      type_traits::OdbcNativeType::Type targetType);
+
+ private:
+  /** Flag indicating if the plan is resolved. */
+  bool resolved_;
+
+  /** Type of the bound buffer the plan is resolved for. */
+  type_traits::OdbcNativeType::Type targetType_;
+
+  /** Converter of decoded values. */
+  Converter converter_;
+};
+}  // namespace odbc
+}  // namespace timestream
+
+#endif  //_TIMESTREAM_ODBC_CONVERSION_PLAN
@@ -31,6 +31,7 @@
 #include "timestream/odbc/log.h"
 #include "timestream/odbc/utility.h"
 #include "timestream/odbc/app/application_data_buffer.h"
+#include "timestream/odbc/app/column_binding_table.h"
 
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/timestream-query/model/ColumnInfo.h>
@@ -222,7 +223,7 @@ class IGNITE_IMPORT_EXPORT ColumnMeta {
    * @param columnBindings the map containing the data to be read.
    * @param position the ordinal position of the column.
    */
-  void Read(timestream::odbc::app::ColumnBindingMap& columnBindings,
+  void Read(timestream::odbc::app::ColumnBindingTable& columnBindings,
             int32_t position);
 
   /**
@@ -0,0 +1,130 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#ifndef _TIMESTREAM_ODBC_META_COLUMN_META_CACHE
+#define _TIMESTREAM_ODBC_META_COLUMN_META_CACHE
+
+#include <chrono>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "timestream/odbc/meta/column_meta.h"
+
+namespace timestream {
+namespace odbc {
+namespace meta {
+/**
+ * Bounded LRU cache of result set metadata keyed by normalized SQL text.
+ * Entries expire after the configured time to live.
+ */
+class IGNITE_IMPORT_EXPORT ColumnMetaCache {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param capacity Max number of entries. Zero disables the cache.
+   * @param ttl Time to live of an entry. Zero disables the cache.
+   */
+  ColumnMetaCache(size_t capacity, std::chrono::seconds ttl);
+
+  /**
+   * Destructor.
+   */
+  ~ColumnMetaCache() = default;
+
+  /**
+   * Get the cached result set metadata of a query.
+   *
+   * @param sql SQL query string.
+   * @param meta Result set metadata output.
+   * @return True if an entry which is not expired is found.
+   */
+  bool Get(const std::string& sql, ColumnMetaVector& meta);
+
+  /**
+   * Add or replace the cached result set metadata of a query.
+   *
+   * @param sql SQL query string.
+   * @param meta Result set metadata.
+   */
+  void Put(const std::string& sql, const ColumnMetaVector& meta);
+
+  /**
+   * Remove the cached result set metadata of a query.
+   *
+   * @param sql SQL query string.
+   */
+  void Invalidate(const std::string& sql);
+
+  /**
+   * Remove all cached entries.
+   */
+  void Clear();
+
+  /**
+   * Get number of cached entries.
+   *
+   * @return Number of cached entries.
+   */
+  size_t Size();
+
+  /**
+   * Normalize SQL text used as cache key. Leading and trailing white spaces
+   * are removed and the white space runs outside of quoted literals and
+   * identifiers are collapsed to a single space.
+   *
+   * @param sql SQL query string.
+   * @return Normalized SQL query string.
+   */
+  static std::string NormalizeSql(const std::string& sql);
+
+ private:
+  IGNITE_NO_COPY_ASSIGNMENT(ColumnMetaCache);
+
+  /** Cache entry. */
+  struct Entry {
+    /** Normalized SQL. */
+    std::string key;
+
+    /** Result set metadata. */
+    ColumnMetaVector meta;
+
+    /** Time when the entry expires. */
+    std::chrono::steady_clock::time_point expiry;
+  };
+
+  /** Max number of entries. */
+  const size_t capacity_;
+
+  /** Time to live of an entry. */
+  const std::chrono::seconds ttl_;
+
+  /** Entries ordered from the most recently used to the least. */
+  std::list< Entry > entries_;
+
+  /** Index from normalized SQL to entry. */
+  std::unordered_map< std::string, std::list< Entry >::iterator > index_;
+
+  /** mutex for exclusive access */
+  std::mutex mutex_;
+};
+}  // namespace meta
+}  // namespace odbc
+}  // namespace timestream
+
+#endif  //_TIMESTREAM_ODBC_META_COLUMN_META_CACHE
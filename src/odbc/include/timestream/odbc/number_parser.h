@@ -0,0 +1,94 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#ifndef _TIMESTREAM_ODBC_NUMBER_PARSER
+#define _TIMESTREAM_ODBC_NUMBER_PARSER
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ignite/common/common.h"
+
+namespace timestream {
+namespace odbc {
+/**
+ * Parsers of the INTEGER, BIGINT and DOUBLE values returned by Timestream.
+ * Like std::from_chars, they do not depend on the locale, do not throw and
+ * do not allocate memory for common values. A double is rounded correctly,
+ * so the shortest text of a double is parsed back to the same double.
+ */
+class IGNITE_IMPORT_EXPORT NumberParser {
+ public:
+  /**
+   * Parse a text which is a 32-bit integer "[+-]digits".
+   *
+   * @param str Text.
+   * @param len Length of the text.
+   * @param value Value output, not changed on failure.
+   * @return True on success.
+   */
+  static bool ParseInt32(const char* str, size_t len, int32_t& value);
+
+  /**
+   * Parse a text which is a 64-bit integer "[+-]digits".
+   *
+   * @param str Text.
+   * @param len Length of the text.
+   * @param value Value output, not changed on failure.
+   * @return True on success.
+   */
+  static bool ParseInt64(const char* str, size_t len, int64_t& value);
+
+  /**
+   * Parse a text which is a double, see ReadDouble.
+   *
+   * @param str Text.
+   * @param len Length of the text.
+   * @param value Value output, not changed on failure.
+   * @return True on success.
+   */
+  static bool ParseDouble(const char* str, size_t len, double& value);
+
+  /**
+   * Read a 64-bit integer "[+-]digits" at the beginning of a text.
+   *
+   * @param first Beginning of the text.
+   * @param last End of the text.
+   * @param value Value output, not changed on failure.
+   * @return End of the read number, first if there is no number or the
+   * number is out of range.
+   */
+  static const char* ReadInt64(const char* first, const char* last,
+                               int64_t& value);
+
+  /**
+   * Read a double "[+-]digits[.digits][(e|E)[+-]digits]", or infinity or
+   * NaN spelled case insensitively as "inf", "infinity" or "nan", at the
+   * beginning of a text.
+   *
+   * @param first Beginning of the text.
+   * @param last End of the text.
+   * @param value Value output, not changed on failure.
+   * @return End of the read number, first if there is no number or the
+   * number is out of range.
+   */
+  static const char* ReadDouble(const char* first, const char* last,
+                                double& value);
+};
+}  // namespace odbc
+}  // namespace timestream
+
+#endif  //_TIMESTREAM_ODBC_NUMBER_PARSER
@@ -83,7 +83,7 @@ class ColumnMetadataQuery : public timestream::odbc::query::Query {
    *
    * @return Operation result.
    */
-  virtual SqlResult::Type FetchNextRow(app::ColumnBindingMap& columnBindings);
+  virtual SqlResult::Type FetchNextRow(app::ColumnBindingTable& columnBindings);
 
   /**
    * Get data of the specified column in the result set.
@@ -21,6 +21,10 @@
 #ifndef _TIMESTREAM_ODBC_QUERY_DATA_QUERY
 #define _TIMESTREAM_ODBC_QUERY_DATA_QUERY
 
+#include "timestream/odbc/columnar_page.h"
+#include "timestream/odbc/conversion_plan.h"
+#include "timestream/odbc/result_buffer_budget.h"
+#include "timestream/odbc/result_page_store.h"
 #include "timestream/odbc/timestream_cursor.h"
 #include "timestream/odbc/query/query.h"
 #include "timestream/odbc/connection.h"
@@ -28,14 +32,22 @@
 #include <aws/timestream-query/model/QueryRequest.h>
 #include <aws/timestream-query/model/QueryResult.h>
 #include <aws/timestream-query/model/ColumnInfo.h>
+#include <aws/timestream-query/model/SelectColumn.h>
 
-#include <queue>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <memory>
 #include <mutex>
 #include <condition_variable>
+#include <thread>
+#include <vector>
 
 using Aws::TimestreamQuery::Model::ColumnInfo;
 using Aws::TimestreamQuery::Model::QueryRequest;
 using Aws::TimestreamQuery::Model::QueryResult;
+using Aws::TimestreamQuery::Model::SelectColumn;
 
 namespace timestream {
 namespace odbc {
@@ -44,23 +56,107 @@ class Connection;
 
 namespace query {
 /**
- * Context for asynchronous fetching data query result.
+ * Page fetched by the worker thread.
+ */
+struct FetchedPage {
+  /** Query execution outcome. */
+  Aws::TimestreamQuery::Model::QueryOutcome outcome;
+
+  /** Decoded columns of the page, null if the page is not decoded. */
+  std::shared_ptr< const ColumnarPage > columns;
+
+  /** Bytes of the page accounted in the result buffer budget. */
+  size_t bytes = 0;
+
+  /** Index of the time sub-range the page belongs to. */
+  size_t part = 0;
+
+  /** Flag indicating no more pages of the time sub-range are fetched. */
+  bool isLast = false;
+};
+
+/**
+ * Context for asynchronous fetching data query result. It is shared by the
+ * query and its worker threads, and outlives the query when the workers of
+ * a closed query are still running.
  */
 class IGNITE_IMPORT_EXPORT DataQueryContext {
  public:
-  DataQueryContext() : isClosing_(false) {
+  /**
+   * Constructor.
+   *
+   * @param prefetchPages Max number of pages buffered ahead of the cursor.
+   * @param budget Memory budget of the connection, could be null.
+   * @param maxRows Max number of rows of the result, zero if there is no
+   * limit. It is set again when the query is executed.
+   * @param maxRowPerPage Max number of rows of a page, zero if it is not
+   * set.
+   * @param adaptivePageSize Flag indicating the page size is adapted.
+   */
+  DataQueryContext(size_t prefetchPages,
+                   std::shared_ptr< ResultBufferBudget > budget,
+                   int64_t maxRows, int32_t maxRowPerPage,
+                   bool adaptivePageSize)
+      : prefetchPages_(prefetchPages),
+        budget_(std::move(budget)),
+        maxRows_(maxRows),
+        maxRowPerPage_(maxRowPerPage),
+        adaptivePageSize_(adaptivePageSize),
+        drainRate_(0),
+        runningWorkers_(0),
+        isClosing_(false) {
   }
 
   ~DataQueryContext() = default;
 
+  /**
+   * Get number of pages of a time sub-range in queue_.
+   * The mutex_ must be held by the caller.
+   *
+   * @param part Index of the time sub-range.
+   * @return Number of pages.
+   */
+  size_t GetQueuedPages(size_t part) const {
+    return std::count_if(
+        queue_.begin(), queue_.end(),
+        [part](const FetchedPage& page) { return page.part == part; });
+  }
+
   /** mutex */
   std::mutex mutex_;
 
   /** condition variable to synchronize threads */
   std::condition_variable cv_;
 
-  /** queue to save query execution outcome objects. */
-  std::queue< Aws::TimestreamQuery::Model::QueryOutcome > queue_;
+  /** queue to save fetched pages. */
+  std::deque< FetchedPage > queue_;
+
+  /** Max number of pages of a time sub-range that could be saved in queue_. */
+  const size_t prefetchPages_;
+
+  /** Memory budget of the connection, null if there is no budget. */
+  const std::shared_ptr< ResultBufferBudget > budget_;
+
+  /**
+   * Max number of rows of the result, zero if there is no limit. It is set
+   * before the workers of an execution are started.
+   */
+  int64_t maxRows_;
+
+  /** Max number of rows of a page, zero if it is not set. */
+  const int32_t maxRowPerPage_;
+
+  /** Flag indicating the page size is adapted by PageSizer. */
+  const bool adaptivePageSize_;
+
+  /** Rows per second drained by the cursor, zero if not measured yet. */
+  double drainRate_;
+
+  /** Query IDs of the queries which have pages left on the server. */
+  std::vector< Aws::String > queryIds_;
+
+  /** Number of worker threads which have not exited. */
+  size_t runningWorkers_;
 
   /** Flag to indicate if the main thread is exiting or not. */
   bool isClosing_;
@@ -77,9 +173,11 @@ class IGNITE_IMPORT_EXPORT DataQuery : public timestream::odbc::query::Query {
    * @param diag Diagnostics collector.
    * @param connection Associated connection.
    * @param sql SQL query string.
+   * @param scrollable Flag indicating the pages are kept so the cursor
+   * could be moved backwards.
    */
   DataQuery(diagnostic::DiagnosableAdapter& diag, Connection& connection,
-            const std::string& sql);
+            const std::string& sql, bool scrollable = false);
 
   /**
    * Destructor.
@@ -100,6 +198,33 @@ class IGNITE_IMPORT_EXPORT DataQuery : public timestream::odbc::query::Query {
    */
   virtual SqlResult::Type Cancel();
 
+  /**
+   * Set the max number of rows returned by the next execution.
+   *
+   * @param maxRows Max number of rows, zero if there is no limit.
+   */
+  virtual void SetMaxRows(int64_t maxRows);
+
+  /**
+   * Set the query timeout of the next execution.
+   *
+   * @param queryTimeout Seconds to wait for a page of the result, zero if
+   * there is no timeout.
+   */
+  virtual void SetQueryTimeout(int32_t queryTimeout);
+
+  /**
+   * Interrupt the execution or fetch running in another thread. A thread
+   * waiting for a page stops waiting and closes the query, which cancels
+   * the running queries on the server.
+   */
+  virtual void Interrupt();
+
+  /**
+   * Clear the interruption.
+   */
+  virtual void ClearInterrupt();
+
   /**
    * Get column metadata.
    *
@@ -113,7 +238,19 @@ class IGNITE_IMPORT_EXPORT DataQuery : public timestream::odbc::query::Query {
    * @param columnBindings Application buffers to put data to.
    * @return Operation result.
    */
-  virtual SqlResult::Type FetchNextRow(app::ColumnBindingMap& columnBindings);
+  virtual SqlResult::Type FetchNextRow(app::ColumnBindingTable& columnBindings);
+
+  /**
+   * Fetch a rowset to application buffers. Rows of the current page are
+   * filled column by column, rows in the next page or in the page store
+   * are fetched with FetchNextRow.
+   *
+   * @param columnBindings Application buffers to put data to.
+   * @param rowResults Result of each row of the rowset. Its size is the
+   * rowset size.
+   */
+  virtual void FetchRowset(app::ColumnBindingTable& columnBindings,
+                           std::vector< SqlResult::Type >& rowResults);
 
   /**
    * Get data of the specified column in the result set.
@@ -161,6 +298,33 @@ class IGNITE_IMPORT_EXPORT DataQuery : public timestream::odbc::query::Query {
    */
   virtual SqlResult::Type NextResultSet();
 
+  /**
+   * Check if the cursor of the query could be moved backwards.
+   *
+   * @return True if the cursor is scrollable.
+   */
+  virtual bool IsScrollable() const {
+    return scrollable_;
+  }
+
+  /**
+   * Move the cursor before a row so the next fetched row is that row.
+   *
+   * @param rowNum Row number, starts at 1.
+   * @return AI_SUCCESS if the row exists, AI_NO_DATA if the row is beyond
+   * the end of the result set.
+   */
+  virtual SqlResult::Type MoveTo(int64_t rowNum);
+
+  /**
+   * Get number of rows in the result set. All pages of the result are
+   * fetched.
+   *
+   * @param count Number of rows output.
+   * @return Operation result.
+   */
+  virtual SqlResult::Type GetRowCount(int64_t& count);
+
   /**
    * Get SQL query string.
    *
@@ -189,6 +353,32 @@ class IGNITE_IMPORT_EXPORT DataQuery : public timestream::odbc::query::Query {
    */
   SqlResult::Type MakeRequestExecute();
 
+  /**
+   * Execute the time sub-range queries of the query in parallel.
+   *
+   * @param subQueries Sub-range queries ordered by time.
+   * @return Result.
+   */
+  SqlResult::Type MakeRequestExecuteFanOut(
+      const std::vector< std::string >& subQueries);
+
+  /**
+   * Serve the query from the result pages found in the result cache.
+   *
+   * @param pages Cached result pages in fetch order.
+   * @return Result.
+   */
+  SqlResult::Type MakeRequestExecuteCached(std::vector< QueryResult >& pages);
+
+  /**
+   * Add a delivered result page to the pages to be cached. The pages are
+   * written to the result cache when the last page is delivered.
+   *
+   * @param page Result page.
+   * @param isLast Flag indicating the page is the last page of the result.
+   */
+  void CachePage(const QueryResult& page, bool isLast);
+
   /**
    * Make data fetch request and use response to set internal state.
    *
@@ -197,7 +387,8 @@ class IGNITE_IMPORT_EXPORT DataQuery : public timestream::odbc::query::Query {
   SqlResult::Type MakeRequestFetch();
 
   /**
-   * Make result set metadata request.
+   * Make result set metadata request. PrepareQuery is used so the query is
+   * not run, Query is used as fallback if PrepareQuery fails.
    *
    * @return Result.
    */
@@ -218,6 +409,37 @@ class IGNITE_IMPORT_EXPORT DataQuery : public timestream::odbc::query::Query {
    */
   void ReadColumnMetadataVector(const Aws::Vector< ColumnInfo >& tsVector);
 
+  /**
+   * Remove the result set metadata of the query from the metadata cache
+   * after the query failed.
+   */
+  void InvalidateMeta();
+
+  /**
+   * Fill rows of the rowset from the rows after the current one in the page
+   * and move the cursor to the last of them. The rows are filled column by
+   * column.
+   *
+   * @param columnBindings Application buffers to put data to.
+   * @param first Index of the first row to fill in the rowset.
+   * @param count Number of rows to fill. The page has at least as many rows
+   * after the current one.
+   * @param rowResults Result of each row of the rowset.
+   */
+  void FillRowsFromPage(app::ColumnBindingTable& columnBindings, size_t first,
+                        size_t count,
+                        std::vector< SqlResult::Type >& rowResults);
+
+  /**
+   * Get conversion plan of a result column resolved for its bound buffer.
+   *
+   * @param columnIdx Column index, start from 1.
+   * @param dataBuf Bound buffer.
+   * @return Conversion plan.
+   */
+  const ConversionPlan& GetConversionPlan(
+      uint32_t columnIdx, const app::ApplicationDataBuffer& dataBuf);
+
   /**
    * Process column conversion operation result.
    *
@@ -244,21 +466,27 @@ class IGNITE_IMPORT_EXPORT DataQuery : public timestream::odbc::query::Query {
   SqlResult::Type InternalClose();
 
   /**
-   * Switch cursor to hold next resultset page data.
+   * Switch cursor to hold next resultset page data. If the page is not
+   * fetched within the query timeout, the query is closed and cancelled.
    *
    * @return Result.
    */
   SqlResult::Type SwitchCursor();
 
   /**
-   * Record the thread so they could be waited before the main thread ends.
-   * @param thread Thread to be saved.
+   * Release the current page and return its bytes to the budget.
+   */
+  void ReleasePage();
+
+  /**
+   * Point the cursor at a row of the page store. Pages are fetched until
+   * the row is in the store or the last page is fetched.
    *
-   * @return void.
+   * @param rowNum Row number, starts at 1.
+   * @return AI_SUCCESS if the row exists, AI_NO_DATA if the row is beyond
+   * the end of the result set.
    */
-  void addThreads(std::thread& thread) {
-    threads_.push(std::move(thread));
-  }
+  SqlResult::Type SeekRow(int64_t rowNum);
 
   /** Connection associated with the statement. */
   Connection& connection_;
@@ -272,12 +500,21 @@ class IGNITE_IMPORT_EXPORT DataQuery : public timestream::odbc::query::Query {
   /** Result set metadata. */
   meta::ColumnMetaVector resultMeta_;
 
+  /** Conversion plans of the result columns to their bound buffers. */
+  std::vector< ConversionPlan > conversionPlans_;
+
   /** Current TS Query Request. */
   QueryRequest request_;
 
   /** Current TS Query Result. */
   std::shared_ptr< QueryResult > result_;
 
+  /** Bytes of result_ accounted in the result buffer budget. */
+  size_t resultBytes_;
+
+  /** Query ID of the running query. */
+  Aws::String queryId_;
+
   /** Cursor. */
   std::unique_ptr< TimestreamCursor > cursor_;
 
@@ -285,10 +522,61 @@ class IGNITE_IMPORT_EXPORT DataQuery : public timestream::odbc::query::Query {
   std::shared_ptr< Aws::TimestreamQuery::TimestreamQueryClient > queryClient_;
 
   /** Context for asynchornous result fetching. */
-  DataQueryContext context_;
+  std::shared_ptr< DataQueryContext > context_;
+
+  /** Worker threads fetching the pages of the time sub-ranges. */
+  std::vector< std::thread > workers_;
+
+  /** Number of time sub-ranges being fetched. */
+  size_t parts_;
+
+  /** Number of time sub-ranges which are fetched to the last page. */
+  size_t finishedParts_;
+
+  /** Index of the time sub-range read in time order. */
+  size_t currentPart_;
+
+  /** Flag indicating the sub-ranges are read in time order. */
+  bool ordered_;
+
+  /** Serialized pages of the result to be written to the result cache. */
+  std::vector< std::string > cachePages_;
+
+  /** Total size of cachePages_. */
+  size_t cacheBytes_;
+
+  /** Flag indicating the delivered pages are collected for the cache. */
+  bool isCaching_;
+
+  /** Flag indicating the cursor is scrollable. */
+  const bool scrollable_;
+
+  /** Max number of rows returned, zero if there is no limit. */
+  int64_t maxRows_;
+
+  /** Seconds to wait for a page of the result, zero if there is no timeout. */
+  int32_t queryTimeout_;
+
+  /**
+   * Flag indicating the query is closed as the wait for a page failed on
+   * the query timeout or an interruption. The error is already reported.
+   */
+  bool waitFailed_;
+
+  /** Flag indicating the query is interrupted by another thread. */
+  std::atomic< bool > interrupted_;
+
+  /** Fetched pages of a scrollable cursor, null if not scrollable. */
+  std::unique_ptr< ResultPageStore > pageStore_;
+
+  /** Row number of a scrollable cursor, 0 is before the first row. */
+  int64_t position_;
+
+  /** Page which cursor_ is created on. */
+  const QueryResult* cursorPage_;
 
-  /** Queue for threads. */
-  std::queue< std::thread > threads_;
+  /** Time the current page is switched to, used to measure drainRate_. */
+  std::chrono::steady_clock::time_point pageStartTime_;
 
   /** Flag indicating asynchronous fetch is started. */
   bool hasAsyncFetch;
@@ -0,0 +1,65 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#ifndef _TIMESTREAM_ODBC_QUERY_PAGE_SIZER
+#define _TIMESTREAM_ODBC_QUERY_PAGE_SIZER
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace timestream {
+namespace odbc {
+namespace query {
+/**
+ * Sizes the pages of a query in the adaptive page size mode. The first
+ * page is small so the first rows are returned quickly. Each next page is
+ * grown from the measurements of the previous page: the page grows while
+ * the consumer drains rows faster than they are fetched, and it is capped
+ * by the row width so a page stays within a target number of bytes.
+ */
+class PageSizer {
+ public:
+  /** Number of rows of the first page. */
+  static const int32_t firstPageRows;
+
+  /** Max number of rows of a page, the limit of Timestream. */
+  static const int32_t maxPageRows;
+
+  /** Factor a page grows by. */
+  static const int32_t growthFactor;
+
+  /** Target number of bytes of a decoded page. */
+  static const size_t targetPageBytes;
+
+  /**
+   * Compute the number of rows of the next page.
+   *
+   * @param pageRows Number of rows requested for the previous page.
+   * @param rows Number of rows returned in the previous page.
+   * @param bytes Number of bytes of the previous page.
+   * @param latency Seconds taken to fetch the previous page.
+   * @param drainRate Rows per second drained by the consumer, zero if it
+   * is not measured yet.
+   * @return Number of rows of the next page.
+   */
+  static int32_t NextPageRows(int32_t pageRows, size_t rows, size_t bytes,
+                              double latency, double drainRate);
+};
+}  // namespace query
+}  // namespace odbc
+}  // namespace timestream
+
+#endif  //_TIMESTREAM_ODBC_QUERY_PAGE_SIZER
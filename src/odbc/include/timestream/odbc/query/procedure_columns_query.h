@@ -69,7 +69,7 @@ class ProcedureColumnsQuery : public Query {
    *
    * @return Operation result.
    */
-  virtual SqlResult::Type FetchNextRow(app::ColumnBindingMap& columnBindings);
+  virtual SqlResult::Type FetchNextRow(app::ColumnBindingTable& columnBindings);
 
   /**
    * Get data of the specified column in the result set.
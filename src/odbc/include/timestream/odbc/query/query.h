@@ -24,7 +24,9 @@
 #include <stdint.h>
 
 #include <map>
+#include <vector>
 
+#include "timestream/odbc/app/column_binding_table.h"
 #include "timestream/odbc/common_types.h"
 #include "timestream/odbc/diagnostic/diagnosable_adapter.h"
 #include "timestream/odbc/meta/column_meta.h"
@@ -104,6 +106,41 @@ class Query {
    */
   virtual SqlResult::Type Cancel() = 0;
 
+  /**
+   * Set the max number of rows returned by the next execution.
+   *
+   * @param maxRows Max number of rows, zero if there is no limit.
+   */
+  virtual void SetMaxRows(int64_t maxRows) {
+    // No-op.
+  }
+
+  /**
+   * Set the query timeout of the next execution.
+   *
+   * @param queryTimeout Seconds to wait for a page of the result, zero if
+   * there is no timeout.
+   */
+  virtual void SetQueryTimeout(int32_t queryTimeout) {
+    // No-op.
+  }
+
+  /**
+   * Interrupt the execution or fetch running in another thread. It could
+   * be called from any thread, the interrupted call fails as soon as it
+   * stops waiting for the server.
+   */
+  virtual void Interrupt() {
+    // No-op.
+  }
+
+  /**
+   * Clear the interruption, so the next execution or fetch runs.
+   */
+  virtual void ClearInterrupt() {
+    // No-op.
+  }
+
   /**
    * Fetch next result row to application buffers.
    *
@@ -111,7 +148,25 @@ class Query {
    * @return Operation result.
    */
   virtual SqlResult::Type FetchNextRow(
-      timestream::odbc::app::ColumnBindingMap& columnBindings) = 0;
+      timestream::odbc::app::ColumnBindingTable& columnBindings) = 0;
+
+  /**
+   * Fetch a rowset to application buffers. Element i of each bound buffer
+   * receives row i of the rowset. The default implementation fetches the
+   * rows one by one with FetchNextRow.
+   *
+   * @param columnBindings Application buffers to put data to.
+   * @param rowResults Result of each row of the rowset. Its size is the
+   * rowset size.
+   */
+  virtual void FetchRowset(
+      timestream::odbc::app::ColumnBindingTable& columnBindings,
+      std::vector< SqlResult::Type >& rowResults) {
+    for (size_t i = 0; i < rowResults.size(); ++i) {
+      columnBindings.SetElementOffset(i);
+      rowResults[i] = FetchNextRow(columnBindings);
+    }
+  }
 
   /**
    * Get data of the specified column in the result set.
@@ -171,6 +226,42 @@ class Query {
    */
   virtual SqlResult::Type NextResultSet() = 0;
 
+  /**
+   * Check if the cursor of the query could be moved backwards.
+   *
+   * @return True if the cursor is scrollable.
+   */
+  virtual bool IsScrollable() const {
+    return false;
+  }
+
+  /**
+   * Move the cursor before a row so the next fetched row is that row.
+   * Only supported by the scrollable queries.
+   *
+   * @param rowNum Row number, starts at 1.
+   * @return AI_SUCCESS if the row exists, AI_NO_DATA if the row is beyond
+   * the end of the result set.
+   */
+  virtual SqlResult::Type MoveTo(int64_t rowNum) {
+    diag.AddStatusRecord(SqlState::SHYC00_OPTIONAL_FEATURE_NOT_IMPLEMENTED,
+                         "Cursor is not scrollable.");
+    return SqlResult::AI_ERROR;
+  }
+
+  /**
+   * Get number of rows in the result set. All pages of the result are
+   * fetched. Only supported by the scrollable queries.
+   *
+   * @param count Number of rows output.
+   * @return Operation result.
+   */
+  virtual SqlResult::Type GetRowCount(int64_t& count) {
+    diag.AddStatusRecord(SqlState::SHYC00_OPTIONAL_FEATURE_NOT_IMPLEMENTED,
+                         "Cursor is not scrollable.");
+    return SqlResult::AI_ERROR;
+  }
+
   /**
    * Get query type.
    *
@@ -56,7 +56,7 @@ class SpecialColumnsQuery : public Query {
    * @param columnBindings Application buffers to put data to.
    * @return Operation result.
    */
-  virtual SqlResult::Type FetchNextRow(app::ColumnBindingMap& columnBindings);
+  virtual SqlResult::Type FetchNextRow(app::ColumnBindingTable& columnBindings);
 
   /**
    * Get data of the specified column in the result set.
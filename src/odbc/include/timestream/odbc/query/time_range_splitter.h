@@ -0,0 +1,112 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#ifndef _TIMESTREAM_ODBC_QUERY_TIME_RANGE_SPLITTER
+#define _TIMESTREAM_ODBC_QUERY_TIME_RANGE_SPLITTER
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+namespace timestream {
+namespace odbc {
+namespace query {
+/**
+ * Splits a scan query with a "time BETWEEN a AND b" predicate into queries
+ * over consecutive time sub-ranges, so the sub-ranges could be queried in
+ * parallel.
+ *
+ * Only plain scans are split: a single SELECT without aggregation,
+ * grouping, ordering, limit, join, set operation or OR condition, where
+ * the time predicate is a top level conjunct of a WHERE clause without NOT
+ * or CASE, and its bounds are timestamp literals such as
+ * '2022-10-20 19:01:02.123456789' or TIMESTAMP '2022-10-20'.
+ */
+class TimeRangeSplitter {
+ public:
+  /**
+   * Split the query into sub-range queries.
+   *
+   * @param sql SQL query string.
+   * @param parts Number of sub-ranges.
+   * @param subQueries Sub-range queries output, ordered by time.
+   * @return True if the query is split.
+   */
+  static bool Split(const std::string& sql, int32_t parts,
+                    std::vector< std::string >& subQueries);
+
+  /**
+   * Parse timestamp literal text as nanoseconds since epoch in UTC.
+   *
+   * @param value Timestamp text "yyyy-MM-dd[ HH:mm:ss[.fffffffff]]".
+   * @param nanos Nanoseconds output.
+   * @return True on success.
+   */
+  static bool ParseTimestamp(const std::string& value, int64_t& nanos);
+
+ private:
+  /**
+   * SQL token.
+   */
+  struct Token {
+    /** Token text, lower case for words. */
+    std::string text;
+
+    /** Offset of the token in the query. */
+    size_t begin;
+
+    /** Offset after the token in the query. */
+    size_t end;
+
+    /** Flag indicating the token is a string literal. */
+    bool isLiteral;
+  };
+
+  /**
+   * Split the query into tokens.
+   *
+   * @param sql SQL query string.
+   * @param tokens Tokens output.
+   * @return True on success, false if a quote is not closed.
+   */
+  static bool Tokenize(const std::string& sql, std::vector< Token >& tokens);
+
+  /**
+   * Check if the token is the word or punctuation.
+   *
+   * @param token Token.
+   * @param word Lower case word or punctuation.
+   * @return True if the token is not a literal and matches the word.
+   */
+  static bool IsWord(const Token& token, const std::string& word);
+
+  /**
+   * Read a timestamp literal, optionally prefixed by TIMESTAMP.
+   *
+   * @param tokens Tokens.
+   * @param pos Position of the literal, moved after it on success.
+   * @param nanos Nanoseconds output.
+   * @return True on success.
+   */
+  static bool ReadTimestamp(const std::vector< Token >& tokens, size_t& pos,
+                            int64_t& nanos);
+};
+}  // namespace query
+}  // namespace odbc
+}  // namespace timestream
+
+#endif  //_TIMESTREAM_ODBC_QUERY_TIME_RANGE_SPLITTER
@@ -0,0 +1,109 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#ifndef _TIMESTREAM_ODBC_RESULT_BUFFER_BUDGET
+#define _TIMESTREAM_ODBC_RESULT_BUFFER_BUDGET
+
+#include <stdint.h>
+
+#include <atomic>
+
+#include "ignite/common/common.h"
+
+#include <aws/timestream-query/model/Datum.h>
+#include <aws/timestream-query/model/QueryResult.h>
+
+namespace timestream {
+namespace odbc {
+/**
+ * Memory budget of the result pages held by the statements of a connection.
+ * The fetch worker of a statement stops prefetching while the budget is
+ * exhausted.
+ */
+class IGNITE_IMPORT_EXPORT ResultBufferBudget {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param maxBytes Max number of bytes. Zero disables the limit.
+   */
+  explicit ResultBufferBudget(size_t maxBytes);
+
+  /**
+   * Destructor.
+   */
+  ~ResultBufferBudget() = default;
+
+  /**
+   * Check if more pages could be buffered.
+   *
+   * @return True if the used bytes are below the limit.
+   */
+  bool HasRoom() const;
+
+  /**
+   * Account bytes of a buffered page.
+   *
+   * @param bytes Number of bytes.
+   */
+  void Acquire(size_t bytes);
+
+  /**
+   * Release bytes of a page which is no longer buffered.
+   *
+   * @param bytes Number of bytes.
+   */
+  void Release(size_t bytes);
+
+  /**
+   * Get number of bytes in use.
+   *
+   * @return Number of bytes in use.
+   */
+  size_t GetUsed() const {
+    return used_.load();
+  }
+
+  /**
+   * Estimate the memory held by a query result page.
+   *
+   * @param result Aws query result page.
+   * @return Estimated number of bytes.
+   */
+  static size_t EstimateSize(
+      const Aws::TimestreamQuery::Model::QueryResult& result);
+
+ private:
+  IGNITE_NO_COPY_ASSIGNMENT(ResultBufferBudget);
+
+  /**
+   * Estimate the memory held by a datum.
+   *
+   * @param datum Aws datum.
+   * @return Estimated number of bytes.
+   */
+  static size_t EstimateSize(const Aws::TimestreamQuery::Model::Datum& datum);
+
+  /** Max number of bytes, zero if there is no limit. */
+  const size_t maxBytes_;
+
+  /** Number of bytes in use. */
+  std::atomic< size_t > used_;
+};
+}  // namespace odbc
+}  // namespace timestream
+
+#endif  //_TIMESTREAM_ODBC_RESULT_BUFFER_BUDGET
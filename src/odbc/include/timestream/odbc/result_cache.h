@@ -0,0 +1,181 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#ifndef _TIMESTREAM_ODBC_RESULT_CACHE
+#define _TIMESTREAM_ODBC_RESULT_CACHE
+
+#include <stdint.h>
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <aws/timestream-query/model/QueryResult.h>
+
+#include "ignite/common/common.h"
+
+namespace timestream {
+namespace odbc {
+namespace config {
+/** Configuration forward-declaration. */
+class Configuration;
+}  // namespace config
+
+/**
+ * Query result cache shared by the processes of a host. Each entry is a
+ * file holding all pages of a query result, it is keyed by the normalized
+ * SQL text and the identity of the connection. Files are written to a
+ * temporary file and renamed so readers never see partial entries, and
+ * they are read through a read-only memory mapping. Expired entries are
+ * removed when an entry is written.
+ */
+class IGNITE_IMPORT_EXPORT ResultCache {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param directory Directory of the cache files, it is created if missing.
+   * @param ttl Time to live of an entry.
+   * @param identity Connection identity, entries of other identities are
+   * never returned.
+   */
+  ResultCache(const std::string& directory, std::chrono::seconds ttl,
+              const std::string& identity);
+
+  /**
+   * Destructor.
+   */
+  ~ResultCache() = default;
+
+  /**
+   * Get the cached result pages of a query.
+   *
+   * @param sql SQL query string.
+   * @param pages Result pages output in fetch order.
+   * @return True if an entry which is not expired is found.
+   */
+  bool Get(const std::string& sql,
+           std::vector< Aws::TimestreamQuery::Model::QueryResult >& pages);
+
+  /**
+   * Add or replace the cached result pages of a query.
+   *
+   * @param sql SQL query string.
+   * @param pages Serialized result pages in fetch order.
+   * @return True if the entry is written.
+   */
+  bool Put(const std::string& sql, const std::vector< std::string >& pages);
+
+  /**
+   * Serialize a result page for Put. The next token of the page is not
+   * kept, a placeholder token marks the pages which are not the last.
+   *
+   * @param page Result page.
+   * @param isLast Flag indicating the page is the last page of the result.
+   * @return Serialized page in the Query response format.
+   */
+  static std::string SerializePage(
+      const Aws::TimestreamQuery::Model::QueryResult& page, bool isLast);
+
+  /**
+   * Deserialize a result page written by SerializePage.
+   *
+   * @param serialized Serialized page.
+   * @param page Result page output.
+   * @return True on success.
+   */
+  static bool DeserializePage(const std::string& serialized,
+                              Aws::TimestreamQuery::Model::QueryResult& page);
+
+  /**
+   * Make the connection identity of a configuration from its region,
+   * endpoint and user settings. Secrets are not included.
+   *
+   * @param config Configuration.
+   * @return Connection identity.
+   */
+  static std::string MakeIdentity(const config::Configuration& config);
+
+  /**
+   * Get the default directory of the cache files. It is a directory of the
+   * current user under the runtime or the temporary directory.
+   *
+   * @return Directory path.
+   */
+  static std::string GetDefaultDirectory();
+
+  /**
+   * Create a directory which could only be accessed by the owner. An
+   * existing directory is only used if it is owned by the current user,
+   * is not a symbolic link and has mode 0700.
+   *
+   * @param directory Directory path.
+   * @return True if the directory could be used.
+   */
+  static bool EnsureDirectory(const std::string& directory);
+
+  /**
+   * Make a path of a temporary file which is unique among the processes.
+   *
+   * @param directory Directory of the file.
+   * @param name Name prefix of the file.
+   * @return File path.
+   */
+  static std::string MakeTempPath(const std::string& directory,
+                                  const std::string& name);
+
+ private:
+  IGNITE_NO_COPY_ASSIGNMENT(ResultCache);
+
+  /**
+   * Make the entry key of a query.
+   *
+   * @param sql SQL query string.
+   * @return Key.
+   */
+  std::string MakeKey(const std::string& sql) const;
+
+  /**
+   * Remove the expired entries of the cache directory, including the
+   * entries of other queries and identities.
+   */
+  void RemoveExpired() const;
+
+  /**
+   * Get the file name of an entry.
+   *
+   * @param key Entry key.
+   * @return File name.
+   */
+  static std::string GetFileName(const std::string& key);
+
+  /** Directory of the cache files. */
+  const std::string directory_;
+
+  /** Time to live of an entry. */
+  const std::chrono::seconds ttl_;
+
+  /** Connection identity. */
+  const std::string identity_;
+
+  /** Flag indicating the directory is created and safe to use. */
+  const bool available_;
+};
+}  // namespace odbc
+}  // namespace timestream
+
+#endif  //_TIMESTREAM_ODBC_RESULT_CACHE
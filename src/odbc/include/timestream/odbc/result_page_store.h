@@ -0,0 +1,182 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#ifndef _TIMESTREAM_ODBC_RESULT_PAGE_STORE
+#define _TIMESTREAM_ODBC_RESULT_PAGE_STORE
+
+#include <stdint.h>
+
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <aws/timestream-query/model/QueryResult.h>
+
+#include "ignite/common/common.h"
+#include "timestream/odbc/columnar_page.h"
+
+namespace timestream {
+namespace odbc {
+/**
+ * Pages of a scrollable result set addressed by row number. The oldest
+ * pages are spilled to a temporary file when the pages in memory exceed
+ * the memory limit, spilled pages are read back through a read-only
+ * memory mapping.
+ */
+class IGNITE_IMPORT_EXPORT ResultPageStore {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param memoryLimit Max bytes of the pages in memory. Zero disables
+   * spilling.
+   * @param spillDirectory Directory of the temporary file.
+   */
+  ResultPageStore(size_t memoryLimit, const std::string& spillDirectory);
+
+  /**
+   * Destructor. The temporary file is removed.
+   */
+  ~ResultPageStore();
+
+  /**
+   * Add a page after the pages in the store.
+   *
+   * @param page Result page.
+   * @param columns Decoded columns of the page, could be null.
+   */
+  void Add(std::shared_ptr< Aws::TimestreamQuery::Model::QueryResult > page,
+           std::shared_ptr< const ColumnarPage > columns);
+
+  /**
+   * Get number of rows in the store.
+   *
+   * @return Number of rows.
+   */
+  int64_t GetRowCount() const {
+    return rowCount_;
+  }
+
+  /**
+   * Find the page holding a row.
+   *
+   * @param row 0-based row number.
+   * @param page Result page output.
+   * @param columns Decoded columns output, could be null.
+   * @param rowIdx Index of the row in the page output.
+   * @return True if the row is found.
+   */
+  bool Find(int64_t row,
+            std::shared_ptr< Aws::TimestreamQuery::Model::QueryResult >& page,
+            std::shared_ptr< const ColumnarPage >& columns, size_t& rowIdx);
+
+  /**
+   * Get bytes of the pages in memory.
+   *
+   * @return Bytes of the pages in memory.
+   */
+  size_t GetMemoryUsed() const {
+    return memoryUsed_;
+  }
+
+ private:
+  IGNITE_NO_COPY_ASSIGNMENT(ResultPageStore);
+
+  /** Page of the store. */
+  struct Entry {
+    /** 0-based row number of the first row of the page. */
+    int64_t firstRow;
+
+    /** Number of rows of the page. */
+    size_t rowCount;
+
+    /** Page, null if it is spilled. */
+    std::shared_ptr< Aws::TimestreamQuery::Model::QueryResult > page;
+
+    /** Decoded columns of the page, null if it is spilled. */
+    std::shared_ptr< const ColumnarPage > columns;
+
+    /** Bytes of the page in memory. */
+    size_t bytes;
+
+    /** Offset of the spilled page in the temporary file. */
+    uint64_t offset;
+
+    /** Length of the spilled page in the temporary file. */
+    uint64_t length;
+  };
+
+  /**
+   * Write the page to the temporary file and release it from memory.
+   *
+   * @param entry Page.
+   * @return True on success.
+   */
+  bool Spill(Entry& entry);
+
+  /**
+   * Read a spilled page from the temporary file.
+   *
+   * @param entry Page.
+   * @param page Result page output.
+   * @param columns Decoded columns output.
+   * @return True on success.
+   */
+  bool Load(const Entry& entry,
+            std::shared_ptr< Aws::TimestreamQuery::Model::QueryResult >& page,
+            std::shared_ptr< const ColumnarPage >& columns);
+
+  /** Max bytes of the pages in memory, zero if there is no limit. */
+  size_t memoryLimit_;
+
+  /** Bytes of the pages in memory. */
+  size_t memoryUsed_;
+
+  /** Number of rows in the store. */
+  int64_t rowCount_;
+
+  /** Pages ordered by row number. */
+  std::vector< Entry > entries_;
+
+  /** Index of the oldest page in memory. */
+  size_t nextSpill_;
+
+  /** Directory of the temporary file. */
+  const std::string spillDirectory_;
+
+  /** Path of the temporary file, empty if nothing is spilled. */
+  std::string spillPath_;
+
+  /** Temporary file. */
+  std::ofstream spillFile_;
+
+  /** Size of the temporary file. */
+  uint64_t spillSize_;
+
+  /** Index of the spilled page read last. */
+  size_t loadedIdx_;
+
+  /** Spilled page read last. */
+  std::shared_ptr< Aws::TimestreamQuery::Model::QueryResult > loadedPage_;
+
+  /** Decoded columns of the spilled page read last. */
+  std::shared_ptr< const ColumnarPage > loadedColumns_;
+};
+}  // namespace odbc
+}  // namespace timestream
+
+#endif  //_TIMESTREAM_ODBC_RESULT_PAGE_STORE
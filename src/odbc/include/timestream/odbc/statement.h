@@ -23,10 +23,14 @@
 
 #include <stdint.h>
 
+#include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
 
 #include "timestream/odbc/app/application_data_buffer.h"
+#include "timestream/odbc/app/column_binding_table.h"
+#include "timestream/odbc/async_operation.h"
 #include "timestream/odbc/common_types.h"
 #include "timestream/odbc/diagnostic/diagnosable_adapter.h"
 #include "timestream/odbc/meta/column_meta.h"
@@ -408,6 +412,41 @@ class IGNITE_IMPORT_EXPORT Statement : public diagnostic::DiagnosableAdapter {
    */
   void RestoreDescriptor(DescType type);
 
+  /**
+   * Get diagnostic records. While an asynchronous operation is executing,
+   * the records of the polling calls of the current thread are returned,
+   * the records of the operation are returned when it completes.
+   *
+   * @return Diagnostic records.
+   */
+  virtual const diagnostic::DiagnosticRecordStorage& GetDiagnosticRecords()
+      const {
+    return asyncOperation.IsRunning() ? asyncOperation.GetRecords()
+                                      : diagnosticRecords;
+  }
+
+  /**
+   * Get diagnostic records. While an asynchronous operation is executing,
+   * the records of the polling calls of the current thread are returned,
+   * the records of the operation are returned when it completes.
+   *
+   * @return Diagnostic records.
+   */
+  virtual diagnostic::DiagnosticRecordStorage& GetDiagnosticRecords() {
+    return asyncOperation.IsRunning() ? asyncOperation.GetRecords()
+                                      : diagnosticRecords;
+  }
+
+  /**
+   * Reject a statement function while an asynchronous operation is
+   * running. The function fails with HY010 in the records of the polling
+   * calls, the operation and its records are not touched. SQLCancel and
+   * the diagnostic functions are not rejected.
+   *
+   * @return True if the function is rejected.
+   */
+  bool RejectIfAsyncRunning();
+
  protected:
   /**
    * Constructor.
@@ -597,6 +636,35 @@ class IGNITE_IMPORT_EXPORT Statement : public diagnostic::DiagnosableAdapter {
    */
   SqlResult::Type InternalFetchRow();
 
+  /**
+   * Fetch the rows of the rowset the cursor is moved to.
+   *
+   * @return Operation result.
+   */
+  SqlResult::Type FetchRowset();
+
+  /**
+   * Move the cursor of a scrollable query to the start of a rowset.
+   *
+   * @param orientation Fetch type.
+   * @param offset Fetch offset.
+   * @return AI_SUCCESS_WITH_INFO if the rowset is moved to the first row
+   * as it would start before the first row, AI_NO_DATA if the cursor is
+   * before the start or after the end of the result set.
+   */
+  SqlResult::Type MoveRowset(int16_t orientation, int64_t offset);
+
+  /**
+   * Get the start row of the rowset at an absolute position.
+   *
+   * @param offset Absolute fetch offset, negative offsets count from the
+   * end of the result set.
+   * @param start Start row output, 0 if it is before the start and -1 if it
+   * is after the end of the result set.
+   * @return Operation result.
+   */
+  SqlResult::Type GetAbsoluteRowsetStart(int64_t offset, int64_t& start);
+
   /**
    * Get number of columns in the result set.
    *
@@ -737,6 +805,18 @@ class IGNITE_IMPORT_EXPORT Statement : public diagnostic::DiagnosableAdapter {
 
   SqlResult::Type InternalSetCursorName(SQLWCHAR* name, SQLSMALLINT nameLen);
 
+  /**
+   * Run a statement function. If SQL_ATTR_ASYNC_ENABLE is on, the function
+   * is started in a worker thread and AI_STILL_EXECUTING is returned, the
+   * calls made until it completes poll for its result. The completion is
+   * notified if the Driver Manager has set the notification callback.
+   *
+   * @param function ODBC function identifier, e.g. SQL_API_SQLEXECDIRECT.
+   * @param call Internal call of the statement function.
+   */
+  void AsyncApiCall(SQLUSMALLINT function,
+                    const std::function< SqlResult::Type() >& call);
+
   /**
    * Convert SQLRESULT to SQL_ROW_RESULT.
    *
@@ -748,7 +828,7 @@ class IGNITE_IMPORT_EXPORT Statement : public diagnostic::DiagnosableAdapter {
   Connection& connection;
 
   /** Column bindings. */
-  app::ColumnBindingMap columnBindings;
+  app::ColumnBindingTable columnBindings;
 
   /** Underlying query. */
   std::unique_ptr< Query > currentQuery;
@@ -774,6 +854,36 @@ class IGNITE_IMPORT_EXPORT Statement : public diagnostic::DiagnosableAdapter {
   /** Rowset size. */
   SqlUlen rowsetSize;
 
+  /** Cursor type. */
+  SqlUlen cursorType;
+
+  /**
+   * Start row of the current rowset of a scrollable cursor, 0 if it is
+   * before the start and -1 if it is after the end of the result set.
+   */
+  int64_t rowsetStart;
+
+  /** Max number of rows returned by a query, zero if there is no limit. */
+  SqlUlen maxRows;
+
+  /** Query timeout in seconds, 0 means no timeout. */
+  SqlUlen queryTimeout;
+
+  /** Asynchronous execution mode, SQL_ASYNC_ENABLE_OFF or _ON. */
+  SqlUlen asyncEnable;
+
+  /** Asynchronous operation. */
+  AsyncOperation asyncOperation;
+
+  /**
+   * Mutex of currentQuery between SQLCancel and the worker thread of the
+   * asynchronous operation, which replaces the query in SQLExecDirect.
+   */
+  std::mutex queryMutex;
+
+  /** Flag indicating the running operation is cancelled by SQLCancel. */
+  bool queryInterrupted;
+
   /** implicitly allocated ARD */
   std::unique_ptr< Descriptor > ardi;
 
@@ -70,4 +70,66 @@
 // For ODBC2 all functions
 #define SQL_API_ALL_FUNCTIONS_SIZE 100
 
+// ODBC 3.8 asynchronous notification, not defined for ODBCVER 0x0351 and
+// the callback attributes are defined by sqlspi.h
+#ifndef SQL_ATTR_ASYNC_STMT_EVENT
+#define SQL_ATTR_ASYNC_STMT_EVENT 29
+#endif  // SQL_ATTR_ASYNC_STMT_EVENT
+
+#ifndef SQL_ATTR_ASYNC_STMT_NOTIFICATION_CALLBACK
+#define SQL_ATTR_ASYNC_STMT_NOTIFICATION_CALLBACK 30
+#endif  // SQL_ATTR_ASYNC_STMT_NOTIFICATION_CALLBACK
+
+#ifndef SQL_ATTR_ASYNC_STMT_NOTIFICATION_CONTEXT
+#define SQL_ATTR_ASYNC_STMT_NOTIFICATION_CONTEXT 31
+#endif  // SQL_ATTR_ASYNC_STMT_NOTIFICATION_CONTEXT
+
+#ifndef SQL_ATTR_ASYNC_DBC_FUNCTIONS_ENABLE
+#define SQL_ATTR_ASYNC_DBC_FUNCTIONS_ENABLE 117
+#endif  // SQL_ATTR_ASYNC_DBC_FUNCTIONS_ENABLE
+
+#ifndef SQL_ATTR_ASYNC_DBC_EVENT
+#define SQL_ATTR_ASYNC_DBC_EVENT 119
+#endif  // SQL_ATTR_ASYNC_DBC_EVENT
+
+#ifndef SQL_ATTR_ASYNC_DBC_NOTIFICATION_CALLBACK
+#define SQL_ATTR_ASYNC_DBC_NOTIFICATION_CALLBACK 120
+#endif  // SQL_ATTR_ASYNC_DBC_NOTIFICATION_CALLBACK
+
+#ifndef SQL_ATTR_ASYNC_DBC_NOTIFICATION_CONTEXT
+#define SQL_ATTR_ASYNC_DBC_NOTIFICATION_CONTEXT 121
+#endif  // SQL_ATTR_ASYNC_DBC_NOTIFICATION_CONTEXT
+
+#ifndef SQL_ASYNC_DBC_ENABLE_OFF
+#define SQL_ASYNC_DBC_ENABLE_OFF 0UL
+#endif  // SQL_ASYNC_DBC_ENABLE_OFF
+
+#ifndef SQL_ASYNC_DBC_ENABLE_ON
+#define SQL_ASYNC_DBC_ENABLE_ON 1UL
+#endif  // SQL_ASYNC_DBC_ENABLE_ON
+
+#ifndef SQL_ASYNC_DBC_FUNCTIONS
+#define SQL_ASYNC_DBC_FUNCTIONS 10023
+#endif  // SQL_ASYNC_DBC_FUNCTIONS
+
+#ifndef SQL_ASYNC_DBC_NOT_CAPABLE
+#define SQL_ASYNC_DBC_NOT_CAPABLE 0x00000000L
+#endif  // SQL_ASYNC_DBC_NOT_CAPABLE
+
+#ifndef SQL_ASYNC_DBC_CAPABLE
+#define SQL_ASYNC_DBC_CAPABLE 0x00000001L
+#endif  // SQL_ASYNC_DBC_CAPABLE
+
+#ifndef SQL_ASYNC_NOTIFICATION
+#define SQL_ASYNC_NOTIFICATION 10025
+#endif  // SQL_ASYNC_NOTIFICATION
+
+#ifndef SQL_ASYNC_NOTIFICATION_NOT_CAPABLE
+#define SQL_ASYNC_NOTIFICATION_NOT_CAPABLE 0x00000000L
+#endif  // SQL_ASYNC_NOTIFICATION_NOT_CAPABLE
+
+#ifndef SQL_ASYNC_NOTIFICATION_CAPABLE
+#define SQL_ASYNC_NOTIFICATION_CAPABLE 0x00000001L
+#endif  // SQL_ASYNC_NOTIFICATION_CAPABLE
+
 #endif  //_TIMESTREAM_ODBC_SYSTEM_ODBC_CONSTANTS
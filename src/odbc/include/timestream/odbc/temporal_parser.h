@@ -0,0 +1,140 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#ifndef _TIMESTREAM_ODBC_TEMPORAL_PARSER
+#define _TIMESTREAM_ODBC_TEMPORAL_PARSER
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ignite/common/common.h"
+#include "timestream/odbc/system/odbc_constants.h"
+
+namespace timestream {
+namespace odbc {
+/**
+ * Parsers of the fixed format TIMESTAMP, DATE, TIME and INTERVAL values
+ * returned by Timestream, and the UTC calendar arithmetic to convert them
+ * from and to seconds since epoch. The parsers do not depend on the locale
+ * and do not allocate memory.
+ */
+class IGNITE_IMPORT_EXPORT TemporalParser {
+ public:
+  /**
+   * Parse a timestamp.
+   *
+   * @param str Text "yyyy-MM-dd HH:mm:ss[.fffffffff]".
+   * @param len Length of the text.
+   * @param value Timestamp output, the fraction is in nanoseconds.
+   * @return True on success.
+   */
+  static bool ParseTimestamp(const char* str, size_t len,
+                             SQL_TIMESTAMP_STRUCT& value);
+
+  /**
+   * Parse a date.
+   *
+   * @param str Text "yyyy-MM-dd".
+   * @param len Length of the text.
+   * @param value Date output.
+   * @return True on success.
+   */
+  static bool ParseDate(const char* str, size_t len, SQL_DATE_STRUCT& value);
+
+  /**
+   * Parse a time of day.
+   *
+   * @param str Text "HH:mm:ss[.fffffffff]".
+   * @param len Length of the text.
+   * @param value Time output.
+   * @param fraction Nanoseconds output.
+   * @return True on success.
+   */
+  static bool ParseTime(const char* str, size_t len, SQL_TIME_STRUCT& value,
+                        int32_t& fraction);
+
+  /**
+   * Parse a year to month interval.
+   *
+   * @param str Text "[-]y-M".
+   * @param len Length of the text.
+   * @param year Years output, negative for a negative interval.
+   * @param month Months output.
+   * @return True on success.
+   */
+  static bool ParseIntervalYearMonth(const char* str, size_t len,
+                                     int32_t& year, int32_t& month);
+
+  /**
+   * Parse a day to second interval.
+   *
+   * @param str Text "[-]d HH:mm:ss[.fffffffff]".
+   * @param len Length of the text.
+   * @param day Days output, negative for a negative interval.
+   * @param hour Hours output.
+   * @param minute Minutes output.
+   * @param second Seconds output.
+   * @param fraction Nanoseconds output.
+   * @return True on success.
+   */
+  static bool ParseIntervalDaySecond(const char* str, size_t len,
+                                     int32_t& day, int32_t& hour,
+                                     int32_t& minute, int32_t& second,
+                                     int32_t& fraction);
+
+  /**
+   * Get number of days since 1970-01-01 of a date in the proleptic
+   * Gregorian calendar.
+   *
+   * @param year Year.
+   * @param month Month, 1 to 12.
+   * @param day Day of month, 1 to 31.
+   * @return Number of days, negative before 1970.
+   */
+  static int64_t DaysFromCivil(int64_t year, uint32_t month, uint32_t day);
+
+  /**
+   * Get the date of a number of days since 1970-01-01 in the proleptic
+   * Gregorian calendar.
+   *
+   * @param days Number of days, negative before 1970.
+   * @param year Year output.
+   * @param month Month output, 1 to 12.
+   * @param day Day of month output, 1 to 31.
+   */
+  static void CivilFromDays(int64_t days, int64_t& year, uint32_t& month,
+                            uint32_t& day);
+
+  /**
+   * Convert a timestamp to seconds since epoch. The fraction is ignored.
+   *
+   * @param value Timestamp in UTC.
+   * @return Seconds since epoch.
+   */
+  static int64_t ToEpochSeconds(const SQL_TIMESTAMP_STRUCT& value);
+
+  /**
+   * Convert seconds since epoch to a timestamp. The fraction is not set.
+   *
+   * @param seconds Seconds since epoch.
+   * @param value Timestamp output in UTC.
+   */
+  static void FromEpochSeconds(int64_t seconds, SQL_TIMESTAMP_STRUCT& value);
+};
+}  // namespace odbc
+}  // namespace timestream
+
+#endif  //_TIMESTREAM_ODBC_TEMPORAL_PARSER
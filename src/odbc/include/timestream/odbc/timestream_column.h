@@ -22,6 +22,9 @@
 #define _TIMESTREAM_ODBC_IGNITE_COLUMN
 
 #include <stdint.h>
+
+#include <string>
+
 #include <timestream/odbc/app/application_data_buffer.h>
 #include "timestream/odbc/meta/column_meta.h"
 #include <aws/timestream-query/model/Row.h>
@@ -77,6 +80,40 @@ class TimestreamColumn {
   ConversionResult::Type ReadToBuffer(const Datum& datum,
                                       ApplicationDataBuffer& dataBuf) const;
 
+  /**
+   * Check if the column is a TIMESTAMP, DATE or TIME column read to a
+   * character buffer. The text of such a value is copied to the buffer
+   * without converting it to a date and time.
+   *
+   * @param dataBuf Application data buffer.
+   * @return True if the value text is copied.
+   */
+  bool IsTemporalText(const ApplicationDataBuffer& dataBuf) const;
+
+  /**
+   * Parse Timestream TIMESTAMP value.
+   *
+   * @param value Value in format "yyyy-MM-dd HH:mm:ss.SSSSSSSSS".
+   * @return Timestamp.
+   */
+  static Timestamp ParseTimestamp(const Aws::String& value);
+
+  /**
+   * Parse Timestream DATE value.
+   *
+   * @param value Value in format "yyyy-MM-dd".
+   * @return Date.
+   */
+  static Date ParseDate(const Aws::String& value);
+
+  /**
+   * Parse Timestream TIME value.
+   *
+   * @param value Value in format "HH:mm:ss.SSSSSSSSS".
+   * @return Time.
+   */
+  static Time ParseTime(const Aws::String& value);
+
  private:
   /**
    * Parse Aws Datum data and save result to dataBuf
@@ -98,6 +135,18 @@ class TimestreamColumn {
   ConversionResult::Type ParseScalarType(const Datum& datum,
                                          ApplicationDataBuffer& dataBuf) const;
 
+  /**
+   * Copy the text of a TIMESTAMP, DATE or TIME value to a character buffer.
+   * A value which is not in the canonical format with nine fraction digits
+   * is reformatted from its fields.
+   *
+   * @param value Value text.
+   * @param dataBuf Application data buffer.
+   * @return Operation result.
+   */
+  ConversionResult::Type PutTemporalText(const Aws::String& value,
+                                         ApplicationDataBuffer& dataBuf) const;
+
   /**
    * Parse TimeSeries data type in datum and save result to dataBuf.
    *
@@ -128,6 +177,57 @@ class TimestreamColumn {
   ConversionResult::Type ParseRowType(const Datum& datum,
                                       ApplicationDataBuffer& dataBuf) const;
 
+  /**
+   * Get the text nested values are serialized to. The text is cleared and
+   * its capacity is reused by the following values of the thread.
+   *
+   * @return Text.
+   */
+  static std::string& GetNestedText();
+
+  /**
+   * Put the serialized text of a nested value to dataBuf.
+   *
+   * @param text Text returned by GetNestedText.
+   * @param dataBuf Application data buffer.
+   * @return Operation result.
+   */
+  static ConversionResult::Type PutNestedText(std::string& text,
+                                              ApplicationDataBuffer& dataBuf);
+
+  /**
+   * Append the text of a value nested in an ARRAY, ROW or TIMESERIES value.
+   * A null value appends nothing.
+   *
+   * @param datum Aws datum which contains the value.
+   * @param text Text to append to.
+   */
+  static void AppendDatum(const Datum& datum, std::string& text);
+
+  /**
+   * Append the text of a TIMESERIES value.
+   *
+   * @param datum Aws datum which contains the value.
+   * @param text Text to append to.
+   */
+  static void AppendTimeSeries(const Datum& datum, std::string& text);
+
+  /**
+   * Append the text of an ARRAY value.
+   *
+   * @param datum Aws datum which contains the value.
+   * @param text Text to append to.
+   */
+  static void AppendArray(const Datum& datum, std::string& text);
+
+  /**
+   * Append the text of a ROW value.
+   *
+   * @param datum Aws datum which contains the value.
+   * @param text Text to append to.
+   */
+  static void AppendRow(const Datum& datum, std::string& text);
+
   /** The column index */
   uint32_t columnIdx_;
 
@@ -26,13 +26,17 @@
 #include <map>
 #include <memory>
 
+#include "timestream/odbc/columnar_page.h"
 #include "timestream/odbc/common_types.h"
+#include "timestream/odbc/conversion_plan.h"
 #include "timestream/odbc/timestream_column.h"
 #include "timestream/odbc/meta/column_meta.h"
 
 #include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/timestream-query/model/QueryResult.h>
 #include <aws/timestream-query/model/Row.h>
 
+using Aws::TimestreamQuery::Model::QueryResult;
 using Aws::TimestreamQuery::Model::Row;
 
 namespace timestream {
@@ -44,11 +48,16 @@ class TimestreamCursor {
  public:
   /**
    * Constructor.
-   * @param rowVec Aws Row vector.
+   * @param page Aws query result page. The cursor shares the ownership of
+   * the page so its rows are never copied.
    * @param columnMetadataVec Column metadata vector.
+   * @param columnar Decoded columns of the page. Columns which are not
+   * decoded are read from the datum values of the page.
    */
-  TimestreamCursor(const Aws::Vector< Row > rowVec,
-                   const meta::ColumnMetaVector& columnMetadataVec);
+  TimestreamCursor(
+      std::shared_ptr< const QueryResult > page,
+      const meta::ColumnMetaVector& columnMetadataVec,
+      std::shared_ptr< const ColumnarPage > columnar = nullptr);
 
   /**
    * Destructor.
@@ -62,6 +71,13 @@ class TimestreamCursor {
    */
   bool Increment();
 
+  /**
+   * Move cursor to a row of the page.
+   *
+   * @param rowIdx Row index in the page, start from 0.
+   */
+  void SetPosition(size_t rowIdx);
+
   /**
    * Check if the iterator has data.
    *
@@ -69,6 +85,25 @@ class TimestreamCursor {
    */
   bool HasData() const;
 
+  /**
+   * Get index of the row after the current one.
+   *
+   * @return Row index in the page, start from 0.
+   */
+  size_t GetNextRowIndex() const {
+    return static_cast< size_t >(curPos_);
+  }
+
+  /**
+   * Get number of rows after the current one in the page.
+   *
+   * @return Number of rows.
+   */
+  size_t GetRowsAhead() const {
+    size_t next = GetNextRowIndex();
+    return next < rowVec_.size() ? rowVec_.size() - next : 0;
+  }
+
   /**
    * Get column number in a row.
    *
@@ -83,11 +118,42 @@ class TimestreamCursor {
    *
    * @param columnIdx Column index.
    * @param dataBuf Application data buffer.
-   * @return Conversion result.
+   * @return Conversion result, AI_FAILURE if the cursor is not incremented
+   * to a row.
    */
   app::ConversionResult::Type ReadColumnToBuffer(
       uint32_t columnIdx, app::ApplicationDataBuffer& dataBuf);
 
+  /**
+   * Read column data and store it in application data buffer with the
+   * converter of a conversion plan if the column is decoded.
+   *
+   * @param columnIdx Column index.
+   * @param dataBuf Application data buffer.
+   * @param plan Conversion plan resolved for the buffer type.
+   * @return Conversion result, AI_FAILURE if the cursor is not incremented
+   * to a row.
+   */
+  app::ConversionResult::Type ReadColumnToBuffer(
+      uint32_t columnIdx, app::ApplicationDataBuffer& dataBuf,
+      const ConversionPlan& plan);
+
+  /**
+   * Read column data of a row of the page and store it in application data
+   * buffer with the converter of a conversion plan if the column is
+   * decoded. The cursor is not moved.
+   *
+   * @param columnIdx Column index.
+   * @param rowIdx Row index in the page, start from 0.
+   * @param dataBuf Application data buffer.
+   * @param plan Conversion plan resolved for the buffer type.
+   * @return Conversion result, AI_FAILURE if the row is not in the page or
+   * has no value for the column.
+   */
+  app::ConversionResult::Type ReadColumnToBuffer(
+      uint32_t columnIdx, size_t rowIdx, app::ApplicationDataBuffer& dataBuf,
+      const ConversionPlan& plan);
+
  private:
   IGNITE_NO_COPY_ASSIGNMENT(TimestreamCursor);
 
@@ -116,8 +182,14 @@ class TimestreamCursor {
    */
   bool EnsureColumnDiscovered(uint32_t columnIdx);
 
-  /** Resultset rows */
-  const Aws::Vector< Row > rowVec_;
+  /** Resultset page */
+  const std::shared_ptr< const QueryResult > page_;
+
+  /** Resultset rows, owned by page_ */
+  const Aws::Vector< Row >& rowVec_;
+
+  /** Decoded columns of the page, could be null */
+  const std::shared_ptr< const ColumnarPage > columnar_;
 
   /** The iterator to beginning of cursor */
   Aws::Vector< Row >::const_iterator iterator_;
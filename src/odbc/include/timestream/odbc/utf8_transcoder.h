@@ -0,0 +1,134 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#ifndef _TIMESTREAM_ODBC_UTF8_TRANSCODER
+#define _TIMESTREAM_ODBC_UTF8_TRANSCODER
+
+#include <stddef.h>
+
+#include "ignite/common/common.h"
+
+namespace timestream {
+namespace odbc {
+/**
+ * Transcoder of UTF-8 text to UTF-16 and UTF-32. Runs of ASCII characters
+ * are widened 16 bytes per step with SSE2 where it is available and 8 bytes
+ * per step otherwise. Other characters are decoded one by one. The scalar
+ * variants decode every character and give the same output.
+ *
+ * Overlong sequences, surrogates and code points above U+10FFFF are
+ * invalid. Characters above U+FFFF are written to UTF-16 as surrogate
+ * pairs.
+ */
+class IGNITE_IMPORT_EXPORT Utf8Transcoder {
+ public:
+  /**
+   * Result of a transcoding.
+   */
+  struct Result {
+    /** Number of bytes read. */
+    size_t read;
+
+    /** Number of code units written. */
+    size_t written;
+
+    /** Flag indicating the byte at the read position starts an invalid or
+     * incomplete sequence. */
+    bool invalid;
+  };
+
+  /**
+   * Transcode UTF-8 text to UTF-16. Transcoding stops at an invalid
+   * sequence or before a character the output has no room for.
+   *
+   * @param in UTF-8 text.
+   * @param inLen Length of the text in bytes.
+   * @param out Output buffer.
+   * @param outLen Length of the output buffer in code units.
+   * @return Result.
+   */
+  static Result Transcode(const char* in, size_t inLen, char16_t* out,
+                          size_t outLen);
+
+  /**
+   * Transcode UTF-8 text to UTF-32, see Transcode to UTF-16.
+   *
+   * @param in UTF-8 text.
+   * @param inLen Length of the text in bytes.
+   * @param out Output buffer.
+   * @param outLen Length of the output buffer in code units.
+   * @return Result.
+   */
+  static Result Transcode(const char* in, size_t inLen, char32_t* out,
+                          size_t outLen);
+
+  /**
+   * Transcode UTF-8 text to UTF-16 without the ASCII fast path.
+   *
+   * @param in UTF-8 text.
+   * @param inLen Length of the text in bytes.
+   * @param out Output buffer.
+   * @param outLen Length of the output buffer in code units.
+   * @return Result.
+   */
+  static Result TranscodeScalar(const char* in, size_t inLen, char16_t* out,
+                                size_t outLen);
+
+  /**
+   * Transcode UTF-8 text to UTF-32 without the ASCII fast path.
+   *
+   * @param in UTF-8 text.
+   * @param inLen Length of the text in bytes.
+   * @param out Output buffer.
+   * @param outLen Length of the output buffer in code units.
+   * @return Result.
+   */
+  static Result TranscodeScalar(const char* in, size_t inLen, char32_t* out,
+                                size_t outLen);
+
+  /**
+   * Count UTF-16 code units of UTF-8 text up to the first invalid
+   * sequence.
+   *
+   * @param in UTF-8 text.
+   * @param inLen Length of the text in bytes.
+   * @return Number of code units.
+   */
+  static size_t CountUtf16(const char* in, size_t inLen);
+
+  /**
+   * Count code points of UTF-8 text up to the first invalid sequence.
+   *
+   * @param in UTF-8 text.
+   * @param inLen Length of the text in bytes.
+   * @return Number of code points.
+   */
+  static size_t CountUtf32(const char* in, size_t inLen);
+
+  /**
+   * Get length of the ASCII characters at the start of a text. The text is
+   * checked with the ASCII fast path.
+   *
+   * @param in Text.
+   * @param inLen Length of the text in bytes.
+   * @return Number of leading ASCII bytes. It is inLen for ASCII text.
+   */
+  static size_t AsciiPrefixLength(const char* in, size_t inLen);
+};
+}  // namespace odbc
+}  // namespace timestream
+
+#endif  //_TIMESTREAM_ODBC_UTF8_TRANSCODER
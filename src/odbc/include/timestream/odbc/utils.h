@@ -33,6 +33,7 @@
 #include <sstream>
 #include <string>
 
+#include "timestream/odbc/temporal_parser.h"
 #include "timestream/odbc/time.h"
 
 #ifdef IGNITE_FRIEND
@@ -242,6 +243,42 @@ inline time_t TimeToCTime(const Time& time) {
   return static_cast< time_t >(time.GetSeconds());
 }
 
+/**
+ * Convert seconds since epoch to standard C type struct tm in UTC. The
+ * calendar is computed directly, so it does not depend on the range of
+ * gmtime or take its lock.
+ *
+ * @param seconds Seconds since epoch.
+ * @param ctime Corresponding value of struct tm.
+ * @return True on success.
+ */
+inline bool EpochSecondsToCTm(int64_t seconds, tm& ctime) {
+  int64_t days = seconds / 86400;
+  int64_t secondOfDay = seconds % 86400;
+  if (secondOfDay < 0) {
+    secondOfDay += 86400;
+    days--;
+  }
+
+  int64_t year;
+  uint32_t month, day;
+  TemporalParser::CivilFromDays(days, year, month, day);
+
+  memset(&ctime, 0, sizeof(tm));
+  ctime.tm_year = static_cast< int >(year - 1900);
+  ctime.tm_mon = static_cast< int >(month - 1);
+  ctime.tm_mday = static_cast< int >(day);
+  ctime.tm_hour = static_cast< int >(secondOfDay / 3600);
+  ctime.tm_min = static_cast< int >(secondOfDay / 60 % 60);
+  ctime.tm_sec = static_cast< int >(secondOfDay % 60);
+  // 1970-01-01 is a Thursday
+  ctime.tm_wday = static_cast< int >(((days + 4) % 7 + 7) % 7);
+  ctime.tm_yday =
+      static_cast< int >(days - TemporalParser::DaysFromCivil(year, 1, 1));
+
+  return true;
+}
+
 /**
  * Convert Date type to standard C type time_t.
  *
@@ -250,9 +287,7 @@ inline time_t TimeToCTime(const Time& time) {
  * @return True on success.
  */
 inline bool DateToCTm(const Date& date, tm& ctime) {
-  time_t tmt = DateToCTime(date);
-
-  return ignite::odbc::common::IgniteGmTime(tmt, ctime);
+  return EpochSecondsToCTm(date.GetSeconds(), ctime);
 }
 
 /**
@@ -263,9 +298,7 @@ inline bool DateToCTm(const Date& date, tm& ctime) {
  * @return True on success.
  */
 inline bool TimestampToCTm(const Timestamp& ts, tm& ctime) {
-  time_t tmt = TimestampToCTime(ts);
-
-  return ignite::odbc::common::IgniteGmTime(tmt, ctime);
+  return EpochSecondsToCTm(ts.GetSeconds(), ctime);
 }
 
 /**
@@ -276,9 +309,7 @@ inline bool TimestampToCTm(const Timestamp& ts, tm& ctime) {
  * @return True on success.
  */
 inline bool TimeToCTm(const Time& time, tm& ctime) {
-  time_t tmt = TimeToCTime(time);
-
-  return ignite::odbc::common::IgniteGmTime(tmt, ctime);
+  return EpochSecondsToCTm(time.GetSeconds(), ctime);
 }
 
 /**
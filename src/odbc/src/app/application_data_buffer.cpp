@@ -21,17 +21,35 @@
 #include "timestream/odbc/app/application_data_buffer.h"
 
 #include <algorithm>
-#include <codecvt>
-#include <locale>
 #include <sstream>
 #include <string>
 #include <vector>
 
 #include <sqltypes.h>
 #include "timestream/odbc/log.h"
+#include "timestream/odbc/number_parser.h"
 #include "timestream/odbc/system/odbc_constants.h"
+#include "timestream/odbc/utf8_transcoder.h"
 #include "timestream/odbc/utility.h"
 
+namespace {
+/**
+ * Skip the leading white space of a text, as a stream does before it
+ * reads a number.
+ *
+ * @param value Text.
+ * @return First character which is not white space.
+ */
+const char* SkipSpaces(const std::string& value) {
+  const char* pos = value.data();
+  const char* end = pos + value.size();
+  while (pos != end && (*pos == ' ' || (*pos >= '\t' && *pos <= '\r'))) {
+    pos++;
+  }
+  return pos;
+}
+}  // namespace
+
 namespace timestream {
 namespace odbc {
 namespace app {
@@ -259,11 +277,13 @@ ConversionResult::Type ApplicationDataBuffer::PutStrToStrBuffer(
   size_t bytesRequired = 0;
   if (ANSI_STRING_ONLY) {
     bytesRequired = value.length() * outCharSize;
+  } else if (outCharSize == 2) {
+    bytesRequired =
+        Utf8Transcoder::CountUtf16(value.data(), value.length()) * outCharSize;
   } else {
-    thread_local std::wstring_convert<std::codecvt_utf8<wchar_t >, wchar_t>
-      converter;
-    std::wstring inString = converter.from_bytes(value.c_str());
-    bytesRequired = inString.length() * outCharSize;
+    // a character buffer receives one narrowed character per code point
+    bytesRequired =
+        Utf8Transcoder::CountUtf32(value.data(), value.length()) * outCharSize;
   }
 
   SqlLen* resLenPtr = GetResLen();
@@ -469,13 +489,10 @@ ConversionResult::Type ApplicationDataBuffer::PutString(
     case OdbcNativeType::AI_SIGNED_BIGINT:
     case OdbcNativeType::AI_UNSIGNED_BIGINT:
     case OdbcNativeType::AI_NUMERIC: {
-      std::stringstream converter;
+      int64_t numValue = 0;
 
-      converter << value;
-
-      int64_t numValue;
-
-      converter >> numValue;
+      NumberParser::ReadInt64(SkipSpaces(value), value.data() + value.size(),
+                              numValue);
 
       written = static_cast< SqlLen >(value.size());
 
@@ -484,13 +501,10 @@ ConversionResult::Type ApplicationDataBuffer::PutString(
 
     case OdbcNativeType::AI_FLOAT:
     case OdbcNativeType::AI_DOUBLE: {
-      std::stringstream converter;
-
-      converter << value;
-
-      double numValue;
+      double numValue = 0.0;
 
-      converter >> numValue;
+      NumberParser::ReadDouble(SkipSpaces(value), value.data() + value.size(),
+                               numValue);
 
       written = static_cast< SqlLen >(value.size());
 
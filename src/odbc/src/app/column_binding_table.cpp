@@ -0,0 +1,70 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#include "timestream/odbc/app/column_binding_table.h"
+
+#include <algorithm>
+
+namespace timestream {
+namespace odbc {
+namespace app {
+void ColumnBindingTable::Bind(uint16_t columnIdx,
+                              const ApplicationDataBuffer& buffer) {
+  if (columnIdx >= buffers_.size()) {
+    buffers_.resize(columnIdx + 1);
+    bound_.resize(columnIdx + 1, 0);
+  }
+
+  buffers_[columnIdx] = buffer;
+  if (!bound_[columnIdx]) {
+    bound_[columnIdx] = 1;
+    boundColumns_.insert(std::upper_bound(boundColumns_.begin(),
+                                          boundColumns_.end(), columnIdx),
+                         columnIdx);
+  }
+}
+
+void ColumnBindingTable::Unbind(uint16_t columnIdx) {
+  if (!IsBound(columnIdx)) {
+    return;
+  }
+
+  bound_[columnIdx] = 0;
+  buffers_[columnIdx] = ApplicationDataBuffer();
+  boundColumns_.erase(std::lower_bound(boundColumns_.begin(),
+                                       boundColumns_.end(), columnIdx));
+}
+
+void ColumnBindingTable::Clear() {
+  buffers_.clear();
+  bound_.clear();
+  boundColumns_.clear();
+}
+
+void ColumnBindingTable::SetByteOffset(SqlUlen offset) {
+  for (uint16_t columnIdx : boundColumns_) {
+    buffers_[columnIdx].SetByteOffset(offset);
+  }
+}
+
+void ColumnBindingTable::SetElementOffset(SqlUlen idx) {
+  for (uint16_t columnIdx : boundColumns_) {
+    buffers_[columnIdx].SetElementOffset(idx);
+  }
+}
+}  // namespace app
+}  // namespace odbc
+}  // namespace timestream
@@ -0,0 +1,145 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#include "timestream/odbc/async_operation.h"
+
+#include <chrono>
+#include <exception>
+
+#include "timestream/odbc/log.h"
+
+namespace timestream {
+namespace odbc {
+AsyncOperation::AsyncOperation()
+    : worker_(),
+      result_(),
+      function_(0),
+      cancelled_(false),
+      records_(),
+      callback_(nullptr),
+      context_(nullptr),
+      event_(nullptr) {
+  // No-op.
+}
+
+AsyncOperation::~AsyncOperation() {
+  Wait();
+}
+
+void AsyncOperation::Start(SQLUSMALLINT function,
+                           const std::function< SqlResult::Type() >& call) {
+  Wait();
+
+  std::promise< SqlResult::Type > promise;
+  std::lock_guard< std::mutex > locker(mutex_);
+  function_ = function;
+  cancelled_ = false;
+  result_ = promise.get_future();
+  records_.clear();
+
+  // the notification target is the one set when the function is started
+  AsyncNotificationCallback callback = callback_;
+  SQLPOINTER context = context_;
+  SQLPOINTER event = event_;
+  worker_ = std::thread(
+      [call, callback, context, event](
+          std::promise< SqlResult::Type > result) {
+        try {
+          result.set_value(call());
+        } catch (const std::exception& e) {
+          LOG_ERROR_MSG("Asynchronous function failed: " << e.what());
+          result.set_value(SqlResult::AI_ERROR);
+        }
+        Notify(callback, context, event);
+      },
+      std::move(promise));
+
+  LOG_DEBUG_MSG("Asynchronous function " << function << " is started");
+  records_[std::this_thread::get_id()].SetHeaderRecord(
+      SqlResult::AI_STILL_EXECUTING);
+}
+
+bool AsyncOperation::IsCompleted() const {
+  std::lock_guard< std::mutex > locker(mutex_);
+  return result_.valid()
+         && result_.wait_for(std::chrono::seconds(0))
+                == std::future_status::ready;
+}
+
+SqlResult::Type AsyncOperation::Collect() {
+  std::future< SqlResult::Type > future;
+  {
+    std::lock_guard< std::mutex > locker(mutex_);
+    future = std::move(result_);
+  }
+  SqlResult::Type result = future.get();
+  if (worker_.joinable()) {
+    worker_.join();
+  }
+  LOG_DEBUG_MSG("Asynchronous function " << function_ << " is completed with "
+                                         << result);
+  return result;
+}
+
+void AsyncOperation::Wait() {
+  std::future< SqlResult::Type > future;
+  {
+    std::lock_guard< std::mutex > locker(mutex_);
+    future = std::move(result_);
+  }
+  if (future.valid()) {
+    future.wait();
+  }
+  if (worker_.joinable()) {
+    worker_.join();
+  }
+}
+
+void AsyncOperation::SetPollResult(SqlResult::Type result) {
+  std::lock_guard< std::mutex > locker(mutex_);
+  diagnostic::DiagnosticRecordStorage& records =
+      records_[std::this_thread::get_id()];
+  records.Reset();
+  records.SetHeaderRecord(result);
+}
+
+void AsyncOperation::SetPollError(SqlState::Type sqlState,
+                                  const std::string& message) {
+  std::lock_guard< std::mutex > locker(mutex_);
+  diagnostic::DiagnosticRecordStorage& records =
+      records_[std::this_thread::get_id()];
+  records.Reset();
+  records.SetHeaderRecord(SqlResult::AI_ERROR);
+  records.AddStatusRecord(sqlState, message);
+}
+
+void AsyncOperation::Notify(AsyncNotificationCallback callback,
+                            SQLPOINTER context, SQLPOINTER event) {
+  if (callback) {
+    callback(context, 1);
+    return;
+  }
+
+#ifdef _WIN32
+  if (event) {
+    ::SetEvent(static_cast< HANDLE >(event));
+  }
+#else
+  IGNITE_UNUSED(event);
+#endif  // _WIN32
+}
+}  // namespace odbc
+}  // namespace timestream
@@ -0,0 +1,86 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#include "timestream/odbc/background_workers.h"
+
+#include "timestream/odbc/log.h"
+
+namespace timestream {
+namespace odbc {
+BackgroundWorkers::~BackgroundWorkers() {
+  JoinAll();
+}
+
+void BackgroundWorkers::Add(std::vector< std::thread >& workers,
+                            std::function< bool() > isFinished) {
+  std::vector< Entry > finished;
+  {
+    std::lock_guard< std::mutex > locker(mutex_);
+    auto it = entries_.begin();
+    while (it != entries_.end()) {
+      if (it->isFinished()) {
+        finished.push_back(std::move(*it));
+        it = entries_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+
+    Entry entry;
+    entry.workers.swap(workers);
+    entry.isFinished = std::move(isFinished);
+    entries_.push_back(std::move(entry));
+  }
+
+  for (Entry& entry : finished) {
+    Join(entry);
+  }
+}
+
+void BackgroundWorkers::JoinAll() {
+  std::vector< Entry > entries;
+  {
+    std::lock_guard< std::mutex > locker(mutex_);
+    entries.swap(entries_);
+  }
+
+  if (!entries.empty()) {
+    LOG_DEBUG_MSG("Waiting for the workers of " << entries.size()
+                                                << " closed queries");
+  }
+  for (Entry& entry : entries) {
+    Join(entry);
+  }
+}
+
+size_t BackgroundWorkers::GetSize() const {
+  std::lock_guard< std::mutex > locker(mutex_);
+  size_t size = 0;
+  for (const Entry& entry : entries_) {
+    size += entry.workers.size();
+  }
+  return size;
+}
+
+void BackgroundWorkers::Join(Entry& entry) {
+  for (std::thread& worker : entry.workers) {
+    if (worker.joinable()) {
+      worker.join();
+    }
+  }
+}
+}  // namespace odbc
+}  // namespace timestream
@@ -0,0 +1,213 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#include "timestream/odbc/columnar_page.h"
+
+#include <exception>
+
+#include "timestream/odbc/number_parser.h"
+#include "timestream/odbc/timestream_column.h"
+#include "timestream/odbc/utility.h"
+
+using Aws::TimestreamQuery::Model::ColumnInfo;
+using Aws::TimestreamQuery::Model::QueryResult;
+using Aws::TimestreamQuery::Model::ScalarType;
+
+namespace timestream {
+namespace odbc {
+ColumnarPage::ColumnarPage(const QueryResult& result) {
+  const Aws::Vector< ColumnInfo >& columnInfo = result.GetColumnInfo();
+  columns_.resize(columnInfo.size());
+
+  for (size_t i = 0; i < columnInfo.size(); i++) {
+    Column& column = columns_[i];
+    const ColumnInfo& info = columnInfo[i];
+    if (!info.GetType().ScalarTypeHasBeenSet()) {
+      continue;
+    }
+
+    column.type = info.GetType().GetScalarType();
+    column.decoded = DecodeColumn(result, i, column);
+    if (!column.decoded) {
+      // the column is read from the datum values, release the partial data
+      column.nulls = std::vector< uint8_t >();
+      column.ints = std::vector< int64_t >();
+      column.fractions = std::vector< int32_t >();
+      column.doubles = std::vector< double >();
+    }
+  }
+}
+
+bool ColumnarPage::IsDecoded(uint32_t columnIdx) const {
+  return columnIdx >= 1 && columnIdx <= columns_.size()
+         && columns_[columnIdx - 1].decoded;
+}
+
+app::ConversionResult::Type ColumnarPage::ReadToBuffer(
+    uint32_t columnIdx, size_t rowIdx,
+    app::ApplicationDataBuffer& dataBuf) const {
+  const Column& column = columns_[columnIdx - 1];
+  if (rowIdx >= column.nulls.size()) {
+    LOG_ERROR_MSG("rowIdx out of range for index " << rowIdx);
+    return app::ConversionResult::Type::AI_FAILURE;
+  }
+
+  if (column.nulls[rowIdx]) {
+    return dataBuf.PutNull();
+  }
+
+  switch (column.type) {
+    case ScalarType::BOOLEAN:
+      return dataBuf.PutInt8(static_cast< int8_t >(column.ints[rowIdx]));
+    case ScalarType::INTEGER:
+      return dataBuf.PutInt32(static_cast< int32_t >(column.ints[rowIdx]));
+    case ScalarType::BIGINT:
+      return dataBuf.PutInt64(column.ints[rowIdx]);
+    case ScalarType::DOUBLE:
+      return dataBuf.PutDouble(column.doubles[rowIdx]);
+    case ScalarType::TIMESTAMP:
+      return dataBuf.PutTimestamp(
+          Timestamp(column.ints[rowIdx], column.fractions[rowIdx]));
+    case ScalarType::DATE:
+      return dataBuf.PutDate(Date(column.ints[rowIdx]));
+    case ScalarType::TIME:
+      return dataBuf.PutTime(Time(static_cast< int32_t >(column.ints[rowIdx]),
+                                  column.fractions[rowIdx]));
+    default:
+      break;
+  }
+
+  LOG_ERROR_MSG("Unsupported decoded column type "
+                << static_cast< int >(column.type));
+  return app::ConversionResult::Type::AI_FAILURE;
+}
+
+size_t ColumnarPage::GetSize() const {
+  size_t size = sizeof(ColumnarPage) + columns_.capacity() * sizeof(Column);
+  for (const Column& column : columns_) {
+    size += column.nulls.capacity() * sizeof(uint8_t);
+    size += column.ints.capacity() * sizeof(int64_t);
+    size += column.fractions.capacity() * sizeof(int32_t);
+    size += column.doubles.capacity() * sizeof(double);
+  }
+
+  return size;
+}
+
+bool ColumnarPage::DecodeColumn(const QueryResult& result, size_t columnIdx,
+                                Column& column) {
+  bool hasFraction = false;
+  bool isDouble = false;
+  switch (column.type) {
+    case ScalarType::BOOLEAN:
+    case ScalarType::INTEGER:
+    case ScalarType::BIGINT:
+    case ScalarType::DATE:
+      break;
+    case ScalarType::TIMESTAMP:
+    case ScalarType::TIME:
+      hasFraction = true;
+      break;
+    case ScalarType::DOUBLE:
+      isDouble = true;
+      break;
+    default:
+      // VARCHAR, interval and unknown columns are read from the datum values
+      return false;
+  }
+
+  const Aws::Vector< Row >& rows = result.GetRows();
+  column.nulls.assign(rows.size(), 0);
+  if (isDouble) {
+    column.doubles.assign(rows.size(), 0.0);
+  } else {
+    column.ints.assign(rows.size(), 0);
+  }
+  if (hasFraction) {
+    column.fractions.assign(rows.size(), 0);
+  }
+
+  try {
+    for (size_t i = 0; i < rows.size(); i++) {
+      const Aws::Vector< Datum >& data = rows[i].GetData();
+      if (columnIdx >= data.size()) {
+        return false;
+      }
+
+      const Datum& datum = data[columnIdx];
+      if (datum.NullValueHasBeenSet()) {
+        column.nulls[i] = 1;
+        continue;
+      }
+
+      if (!datum.ScalarValueHasBeenSet()) {
+        return false;
+      }
+
+      const Aws::String& value = datum.GetScalarValue();
+      switch (column.type) {
+        case ScalarType::BOOLEAN:
+          column.ints[i] = value == "true" ? 1 : 0;
+          break;
+        case ScalarType::INTEGER: {
+          int32_t intValue;
+          if (!NumberParser::ParseInt32(value.c_str(), value.size(),
+                                        intValue)) {
+            return false;
+          }
+          column.ints[i] = intValue;
+          break;
+        }
+        case ScalarType::BIGINT:
+          if (!NumberParser::ParseInt64(value.c_str(), value.size(),
+                                        column.ints[i])) {
+            return false;
+          }
+          break;
+        case ScalarType::DOUBLE:
+          if (!NumberParser::ParseDouble(value.c_str(), value.size(),
+                                         column.doubles[i])) {
+            return false;
+          }
+          break;
+        case ScalarType::TIMESTAMP: {
+          Timestamp timestamp = TimestreamColumn::ParseTimestamp(value);
+          column.ints[i] = timestamp.GetSeconds();
+          column.fractions[i] = timestamp.GetSecondFraction();
+          break;
+        }
+        case ScalarType::DATE:
+          column.ints[i] = TimestreamColumn::ParseDate(value).GetMilliseconds();
+          break;
+        case ScalarType::TIME: {
+          Time time = TimestreamColumn::ParseTime(value);
+          column.ints[i] = time.GetSeconds();
+          column.fractions[i] = time.GetSecondFraction();
+          break;
+        }
+        default:
+          return false;
+      }
+    }
+  } catch (const std::exception& e) {
+    LOG_DEBUG_MSG("Column " << columnIdx << " is not decoded: " << e.what());
+    return false;
+  }
+
+  return true;
+}
+}  // namespace odbc
+}  // namespace timestream
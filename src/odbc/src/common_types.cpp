@@ -38,6 +38,9 @@ int SqlResultToReturnCode(SqlResult::Type result) {
     case SqlResult::AI_NEED_DATA:
       return SQL_NEED_DATA;
 
+    case SqlResult::AI_STILL_EXECUTING:
+      return SQL_STILL_EXECUTING;
+
     case SqlResult::AI_ERROR:
     default:
       return SQL_ERROR;
@@ -58,6 +61,9 @@ SqlResult::Type ReturnCodeToSqlResult(int retCode) {
     case SQL_NEED_DATA:
       return SqlResult::AI_NEED_DATA;
 
+    case SQL_STILL_EXECUTING:
+      return SqlResult::AI_STILL_EXECUTING;
+
     case SQL_ERROR:
     default:
       return SqlResult::AI_ERROR;
@@ -83,6 +83,25 @@ const LogLevel::Type Configuration::DefaultValue::logLevel = DEFAULT_LOG_LEVEL;
 const std::string Configuration::DefaultValue::logPath = DEFAULT_LOG_PATH;
 const int32_t Configuration::DefaultValue::maxRowPerPage =
     DEFAULT_MAX_ROW_PER_PAGE;
+const int32_t Configuration::DefaultValue::prefetchPages =
+    DEFAULT_PREFETCH_PAGES;
+const int32_t Configuration::DefaultValue::metadataCacheSize =
+    DEFAULT_METADATA_CACHE_SIZE;
+const int32_t Configuration::DefaultValue::metadataCacheTTL =
+    DEFAULT_METADATA_CACHE_TTL;
+const int32_t Configuration::DefaultValue::maxResultBufferMB =
+    DEFAULT_MAX_RESULT_BUFFER_MB;
+const int32_t Configuration::DefaultValue::queryFanOut = DEFAULT_QUERY_FAN_OUT;
+const bool Configuration::DefaultValue::fanOutOrdered =
+    DEFAULT_FAN_OUT_ORDERED;
+const int32_t Configuration::DefaultValue::resultCacheTTL =
+    DEFAULT_RESULT_CACHE_TTL;
+const std::string Configuration::DefaultValue::resultCachePath =
+    DEFAULT_RESULT_CACHE_PATH;
+const int32_t Configuration::DefaultValue::scrollBufferMB =
+    DEFAULT_SCROLL_BUFFER_MB;
+const bool Configuration::DefaultValue::adaptivePageSize =
+    DEFAULT_ADAPTIVE_PAGE_SIZE;
 
 std::string Configuration::ToConnectString() const {
   LOG_DEBUG_MSG("ToConnectString is called");
@@ -477,6 +496,126 @@ bool Configuration::IsMaxRowPerPageSet() const {
   return maxRowPerPage.IsSet();
 }
 
+int32_t Configuration::GetPrefetchPages() const {
+  return prefetchPages.GetValue();
+}
+
+void Configuration::SetPrefetchPages(int32_t value) {
+  this->prefetchPages.SetValue(value);
+}
+
+bool Configuration::IsPrefetchPagesSet() const {
+  return prefetchPages.IsSet();
+}
+
+int32_t Configuration::GetMetadataCacheSize() const {
+  return metadataCacheSize.GetValue();
+}
+
+void Configuration::SetMetadataCacheSize(int32_t value) {
+  this->metadataCacheSize.SetValue(value);
+}
+
+bool Configuration::IsMetadataCacheSizeSet() const {
+  return metadataCacheSize.IsSet();
+}
+
+int32_t Configuration::GetMetadataCacheTTL() const {
+  return metadataCacheTTL.GetValue();
+}
+
+void Configuration::SetMetadataCacheTTL(int32_t value) {
+  this->metadataCacheTTL.SetValue(value);
+}
+
+bool Configuration::IsMetadataCacheTTLSet() const {
+  return metadataCacheTTL.IsSet();
+}
+
+int32_t Configuration::GetMaxResultBufferMB() const {
+  return maxResultBufferMB.GetValue();
+}
+
+void Configuration::SetMaxResultBufferMB(int32_t value) {
+  this->maxResultBufferMB.SetValue(value);
+}
+
+bool Configuration::IsMaxResultBufferMBSet() const {
+  return maxResultBufferMB.IsSet();
+}
+
+int32_t Configuration::GetQueryFanOut() const {
+  return queryFanOut.GetValue();
+}
+
+void Configuration::SetQueryFanOut(int32_t value) {
+  this->queryFanOut.SetValue(value);
+}
+
+bool Configuration::IsQueryFanOutSet() const {
+  return queryFanOut.IsSet();
+}
+
+bool Configuration::IsFanOutOrdered() const {
+  return fanOutOrdered.GetValue();
+}
+
+void Configuration::SetFanOutOrdered(bool value) {
+  this->fanOutOrdered.SetValue(value);
+}
+
+bool Configuration::IsFanOutOrderedSet() const {
+  return fanOutOrdered.IsSet();
+}
+
+int32_t Configuration::GetResultCacheTTL() const {
+  return resultCacheTTL.GetValue();
+}
+
+void Configuration::SetResultCacheTTL(int32_t value) {
+  this->resultCacheTTL.SetValue(value);
+}
+
+bool Configuration::IsResultCacheTTLSet() const {
+  return resultCacheTTL.IsSet();
+}
+
+const std::string& Configuration::GetResultCachePath() const {
+  return resultCachePath.GetValue();
+}
+
+void Configuration::SetResultCachePath(const std::string& value) {
+  this->resultCachePath.SetValue(value);
+}
+
+bool Configuration::IsResultCachePathSet() const {
+  return resultCachePath.IsSet();
+}
+
+int32_t Configuration::GetScrollBufferMB() const {
+  return scrollBufferMB.GetValue();
+}
+
+void Configuration::SetScrollBufferMB(int32_t value) {
+  this->scrollBufferMB.SetValue(value);
+}
+
+bool Configuration::IsScrollBufferMBSet() const {
+  return scrollBufferMB.IsSet();
+}
+
+bool Configuration::IsAdaptivePageSize() const {
+  return adaptivePageSize.GetValue();
+}
+
+void Configuration::SetAdaptivePageSize(bool value) {
+  this->adaptivePageSize.SetValue(value);
+}
+
+bool Configuration::IsAdaptivePageSizeSet() const {
+  return adaptivePageSize.IsSet();
+}
+
 void Configuration::ToMap(ArgumentMap& res) const {
   AddToMap(res, ConnectionStringParser::Key::dsn, dsn);
   AddToMap(res, ConnectionStringParser::Key::driver, driver);
@@ -507,6 +646,20 @@ void Configuration::ToMap(ArgumentMap& res) const {
   AddToMap(res, ConnectionStringParser::Key::logLevel, logLevel);
   AddToMap(res, ConnectionStringParser::Key::logPath, logPath);
   AddToMap(res, ConnectionStringParser::Key::maxRowPerPage, maxRowPerPage);
+  AddToMap(res, ConnectionStringParser::Key::prefetchPages, prefetchPages);
+  AddToMap(res, ConnectionStringParser::Key::metadataCacheSize,
+           metadataCacheSize);
+  AddToMap(res, ConnectionStringParser::Key::metadataCacheTTL,
+           metadataCacheTTL);
+  AddToMap(res, ConnectionStringParser::Key::maxResultBufferMB,
+           maxResultBufferMB);
+  AddToMap(res, ConnectionStringParser::Key::queryFanOut, queryFanOut);
+  AddToMap(res, ConnectionStringParser::Key::fanOutOrdered, fanOutOrdered);
+  AddToMap(res, ConnectionStringParser::Key::resultCacheTTL, resultCacheTTL);
+  AddToMap(res, ConnectionStringParser::Key::resultCachePath, resultCachePath);
+  AddToMap(res, ConnectionStringParser::Key::scrollBufferMB, scrollBufferMB);
+  AddToMap(res, ConnectionStringParser::Key::adaptivePageSize,
+           adaptivePageSize);
 }
 
 void Configuration::Validate() const {
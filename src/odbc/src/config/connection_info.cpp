@@ -27,19 +27,6 @@
 #include "timestream/odbc/log.h"
 #include "timestream/odbc/utility.h"
 
-// Temporary workaround.
-#ifndef SQL_ASYNC_NOTIFICATION
-#define SQL_ASYNC_NOTIFICATION 10025
-#endif
-
-#ifndef SQL_ASYNC_NOTIFICATION_NOT_CAPABLE
-#define SQL_ASYNC_NOTIFICATION_NOT_CAPABLE 0x00000000L
-#endif
-
-#ifndef SQL_ASYNC_NOTIFICATION_CAPABLE
-#define SQL_ASYNC_NOTIFICATION_CAPABLE 0x00000001L
-#endif
-
 namespace timestream {
 namespace odbc {
 namespace config {
@@ -883,7 +870,7 @@ ConnectionInfo::ConnectionInfo(const Configuration& config)
   // connection handle. SQL_ASYNC_DBC_CAPABLE = The driver can execute
   // connection functions asynchronously. SQL_ASYNC_DBC_NOT_CAPABLE = The driver
   // can not execute connection functions asynchronously.
-  intParams[SQL_ASYNC_DBC_FUNCTIONS] = SQL_ASYNC_DBC_NOT_CAPABLE;
+  intParams[SQL_ASYNC_DBC_FUNCTIONS] = SQL_ASYNC_DBC_CAPABLE;
 #endif  // SQL_ASYNC_DBC_FUNCTIONS
 
 #ifdef SQL_ASYNC_MODE
@@ -899,7 +886,7 @@ ConnectionInfo::ConnectionInfo(const Configuration& config)
   //    associated with a connection handle can be in asynchronous mode, while
   //    other statement handles on the same connection are in synchronous mode.
   // SQL_AM_NONE = Asynchronous mode is not supported.
-  intParams[SQL_ASYNC_MODE] = SQL_AM_NONE;
+  intParams[SQL_ASYNC_MODE] = SQL_AM_STATEMENT;
 #endif  // SQL_ASYNC_MODE
 
 #ifdef SQL_ASYNC_NOTIFICATION
@@ -913,7 +900,7 @@ ConnectionInfo::ConnectionInfo(const Configuration& config)
   // asynchronous operations and statement level asynchronous operations. If a
   // driver returns SQL_ASYNC_NOTIFICATION_CAPABLE, it must support notification
   // for all APIs that it can execute asynchronously.
-  intParams[SQL_ASYNC_NOTIFICATION] = SQL_ASYNC_NOTIFICATION_NOT_CAPABLE;
+  intParams[SQL_ASYNC_NOTIFICATION] = SQL_ASYNC_NOTIFICATION_CAPABLE;
 #endif  // SQL_ASYNC_NOTIFICATION
 
 #ifdef SQL_BATCH_ROW_COUNT
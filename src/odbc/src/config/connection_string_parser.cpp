@@ -63,6 +63,24 @@ const std::string ConnectionStringParser::Key::aadTenant = "aadtenant";
 const std::string ConnectionStringParser::Key::logLevel = "loglevel";
 const std::string ConnectionStringParser::Key::logPath = "logoutput";
 const std::string ConnectionStringParser::Key::maxRowPerPage = "maxrowperpage";
+const std::string ConnectionStringParser::Key::prefetchPages = "prefetchpages";
+const std::string ConnectionStringParser::Key::metadataCacheSize =
+    "metadatacachesize";
+const std::string ConnectionStringParser::Key::metadataCacheTTL =
+    "metadatacachettl";
+const std::string ConnectionStringParser::Key::maxResultBufferMB =
+    "maxresultbuffermb";
+const std::string ConnectionStringParser::Key::queryFanOut = "queryfanout";
+const std::string ConnectionStringParser::Key::fanOutOrdered =
+    "fanoutordered";
+const std::string ConnectionStringParser::Key::resultCacheTTL =
+    "resultcachettl";
+const std::string ConnectionStringParser::Key::resultCachePath =
+    "resultcachepath";
+const std::string ConnectionStringParser::Key::scrollBufferMB =
+    "scrollbuffermb";
+const std::string ConnectionStringParser::Key::adaptivePageSize =
+    "adaptivepagesize";
 
 ConnectionStringParser::ConnectionStringParser(Configuration& cfg) : cfg(cfg) {
   // No-op.
@@ -591,6 +609,407 @@ void ConnectionStringParser::HandleAttributePair(
     }
 
     cfg.SetMaxRowPerPage(static_cast< uint32_t >(numValue));
+  } else if (lKey == Key::prefetchPages) {
+    if (value.empty()) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Prefetch Pages attribute value is empty. Using "
+                             "default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    if (!timestream::odbc::common::AllDigits(value)) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Prefetch Pages attribute value contains "
+                             "unexpected characters."
+                             " Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    if (value.size() >= sizeof(std::to_string(INT32_MAX))) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Prefetch Pages attribute value is too large. "
+                             "Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    int64_t numValue = 0;
+    std::stringstream conv;
+
+    conv << value;
+    conv >> numValue;
+
+    if (numValue <= 0 || numValue > INT32_MAX) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Prefetch Pages attribute value is out of range. "
+                             "Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    cfg.SetPrefetchPages(static_cast< int32_t >(numValue));
+  } else if (lKey == Key::metadataCacheSize) {
+    if (value.empty()) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Metadata Cache Size attribute value is empty. "
+                             "Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    if (!timestream::odbc::common::AllDigits(value)) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Metadata Cache Size attribute value contains "
+                             "unexpected characters."
+                             " Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    if (value.size() >= sizeof(std::to_string(INT32_MAX))) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Metadata Cache Size attribute value is too "
+                             "large. Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    int64_t numValue = 0;
+    std::stringstream conv;
+
+    conv << value;
+    conv >> numValue;
+
+    if (numValue < 0 || numValue > INT32_MAX) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Metadata Cache Size attribute value is out of "
+                             "range. Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    cfg.SetMetadataCacheSize(static_cast< int32_t >(numValue));
+  } else if (lKey == Key::metadataCacheTTL) {
+    if (value.empty()) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Metadata Cache TTL attribute value is empty. "
+                             "Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    if (!timestream::odbc::common::AllDigits(value)) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Metadata Cache TTL attribute value contains "
+                             "unexpected characters."
+                             " Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    if (value.size() >= sizeof(std::to_string(INT32_MAX))) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Metadata Cache TTL attribute value is too "
+                             "large. Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    int64_t numValue = 0;
+    std::stringstream conv;
+
+    conv << value;
+    conv >> numValue;
+
+    if (numValue < 0 || numValue > INT32_MAX) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Metadata Cache TTL attribute value is out of "
+                             "range. Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    cfg.SetMetadataCacheTTL(static_cast< int32_t >(numValue));
+  } else if (lKey == Key::maxResultBufferMB) {
+    if (value.empty()) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("MaxResultBufferMB attribute value is empty. "
+                             "Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    if (!timestream::odbc::common::AllDigits(value)) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("MaxResultBufferMB attribute value contains "
+                             "unexpected characters."
+                             " Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    if (value.size() >= sizeof(std::to_string(INT32_MAX))) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("MaxResultBufferMB attribute value is too "
+                             "large. Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    int64_t numValue = 0;
+    std::stringstream conv;
+
+    conv << value;
+    conv >> numValue;
+
+    if (numValue < 0 || numValue > INT32_MAX) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("MaxResultBufferMB attribute value is out of "
+                             "range. Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    cfg.SetMaxResultBufferMB(static_cast< int32_t >(numValue));
+  } else if (lKey == Key::queryFanOut) {
+    if (value.empty()) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("QueryFanOut attribute value is empty. "
+                             "Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    if (!timestream::odbc::common::AllDigits(value)) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("QueryFanOut attribute value contains "
+                             "unexpected characters."
+                             " Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    if (value.size() >= sizeof(std::to_string(INT32_MAX))) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("QueryFanOut attribute value is too "
+                             "large. Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    int64_t numValue = 0;
+    std::stringstream conv;
+
+    conv << value;
+    conv >> numValue;
+
+    if (numValue <= 0 || numValue > INT32_MAX) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("QueryFanOut attribute value is out of "
+                             "range. Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    cfg.SetQueryFanOut(static_cast< int32_t >(numValue));
+  } else if (lKey == Key::fanOutOrdered) {
+    BoolParseResult::Type res = StringToBool(value);
+
+    if (res == BoolParseResult::Type::AI_UNRECOGNIZED) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Unrecognized bool value. Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    cfg.SetFanOutOrdered(res == BoolParseResult::Type::AI_TRUE);
+  } else if (lKey == Key::resultCacheTTL) {
+    if (value.empty()) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Result Cache TTL attribute value is empty. "
+                             "Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    if (!timestream::odbc::common::AllDigits(value)) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Result Cache TTL attribute value contains "
+                             "unexpected characters."
+                             " Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    if (value.size() >= sizeof(std::to_string(INT32_MAX))) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Result Cache TTL attribute value is too "
+                             "large. Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    int64_t numValue = 0;
+    std::stringstream conv;
+
+    conv << value;
+    conv >> numValue;
+
+    if (numValue < 0 || numValue > INT32_MAX) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Result Cache TTL attribute value is out of "
+                             "range. Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    cfg.SetResultCacheTTL(static_cast< int32_t >(numValue));
+  } else if (lKey == Key::resultCachePath) {
+    cfg.SetResultCachePath(value);
+  } else if (lKey == Key::scrollBufferMB) {
+    if (value.empty()) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("ScrollBufferMB attribute value is empty. "
+                             "Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    if (!timestream::odbc::common::AllDigits(value)) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("ScrollBufferMB attribute value contains "
+                             "unexpected characters."
+                             " Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    if (value.size() >= sizeof(std::to_string(INT32_MAX))) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("ScrollBufferMB attribute value is too "
+                             "large. Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    int64_t numValue = 0;
+    std::stringstream conv;
+
+    conv << value;
+    conv >> numValue;
+
+    if (numValue < 0 || numValue > INT32_MAX) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("ScrollBufferMB attribute value is out of "
+                             "range. Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    cfg.SetScrollBufferMB(static_cast< int32_t >(numValue));
+  } else if (lKey == Key::adaptivePageSize) {
+    BoolParseResult::Type res = StringToBool(value);
+
+    if (res == BoolParseResult::Type::AI_UNRECOGNIZED) {
+      if (diag) {
+        diag->AddStatusRecord(
+            SqlState::S01S02_OPTION_VALUE_CHANGED,
+            MakeErrorMessage("Unrecognized bool value. Using default value.",
+                             key, value));
+      }
+      return;
+    }
+
+    cfg.SetAdaptivePageSize(res == BoolParseResult::Type::AI_TRUE);
   } else if (diag) {
     std::stringstream stream;
 
@@ -87,6 +87,9 @@ Connection::Connection(Environment* env)
 }
 
 Connection::~Connection() {
+  // the asynchronous function uses the connection
+  asyncOperation_.Wait();
+
   Close();
 
   // Before the application terminates, the SDK must be shut down.
@@ -106,6 +109,10 @@ const config::ConnectionInfo& Connection::GetInfo() const {
 
 void Connection::GetInfo(config::ConnectionInfo::InfoType type, void* buf,
                          short buflen, short* reslen) {
+  if (RejectIfAsyncRunning()) {
+    return;
+  }
+
   LOG_INFO_MSG("SQLGetInfo called: "
                << type << " (" << config::ConnectionInfo::InfoTypeToString(type)
                << "), " << std::hex << reinterpret_cast< size_t >(buf) << ", "
@@ -134,20 +141,28 @@ SqlResult::Type Connection::InternalGetInfo(
 }
 
 void Connection::Establish(const std::string& connectStr, void* parentWindow) {
-  IGNITE_ODBC_API_CALL(InternalEstablish(connectStr, parentWindow));
+  // the connection window is not created by a worker thread
+  if (parentWindow && !asyncOperation_.IsRunning()) {
+    IGNITE_ODBC_API_CALL(InternalEstablish(connectStr, parentWindow));
+    return;
+  }
+
+  AsyncApiCall(SQL_API_SQLDRIVERCONNECT, [this, connectStr, parentWindow]() {
+    return InternalEstablish(connectStr, parentWindow);
+  });
 }
 
 SqlResult::Type Connection::InternalEstablish(const std::string& connectStr,
                                               void* parentWindow) {
   LOG_DEBUG_MSG("InternalEstablish is called");
   config::ConnectionStringParser parser(config_);
-  parser.ParseConnectionString(connectStr, &GetDiagnosticRecords());
+  parser.ParseConnectionString(connectStr, &diagnosticRecords);
 
   if (config_.IsDsnSet()) {
     std::string dsn = config_.GetDsn();
     LOG_DEBUG_MSG("dsn is " << dsn);
 
-    ReadDsnConfiguration(dsn.c_str(), config_, &GetDiagnosticRecords());
+    ReadDsnConfiguration(dsn.c_str(), config_, &diagnosticRecords);
   }
 
 #ifdef _WIN32
@@ -167,7 +182,8 @@ SqlResult::Type Connection::InternalEstablish(const std::string& connectStr,
 }
 
 void Connection::Establish(const config::Configuration& cfg) {
-  IGNITE_ODBC_API_CALL(InternalEstablish(cfg));
+  AsyncApiCall(SQL_API_SQLCONNECT,
+               [this, cfg]() { return InternalEstablish(cfg); });
 }
 
 SqlResult::Type Connection::InternalEstablish(
@@ -192,6 +208,24 @@ SqlResult::Type Connection::InternalEstablish(
   IgniteError err;
   bool connected = TryRestoreConnection(cfg, err);
 
+  if (connected) {
+    metaCache_ = std::make_shared< meta::ColumnMetaCache >(
+        static_cast< size_t >(config_.GetMetadataCacheSize()),
+        std::chrono::seconds(config_.GetMetadataCacheTTL()));
+    resultBufferBudget_ = std::make_shared< ResultBufferBudget >(
+        static_cast< size_t >(config_.GetMaxResultBufferMB()) * 1024 * 1024);
+    backgroundWorkers_ = std::make_shared< BackgroundWorkers >();
+    if (config_.GetResultCacheTTL() > 0) {
+      std::string cachePath = config_.GetResultCachePath();
+      if (cachePath.empty()) {
+        cachePath = ResultCache::GetDefaultDirectory();
+      }
+      resultCache_ = std::make_shared< ResultCache >(
+          cachePath, std::chrono::seconds(config_.GetResultCacheTTL()),
+          ResultCache::MakeIdentity(config_));
+    }
+  }
+
   if (!connected) {
     std::string errMessage = "Failed to establish connection to Timestream.\n";
     errMessage.append(err.GetText());
@@ -200,7 +234,7 @@ SqlResult::Type Connection::InternalEstablish(
     return SqlResult::AI_ERROR;
   }
 
-  bool errors = GetDiagnosticRecords().GetStatusRecordsNumber() > 0;
+  bool errors = diagnosticRecords.GetStatusRecordsNumber() > 0;
 
   LOG_DEBUG_MSG("errors is " << errors);
 
@@ -208,7 +242,7 @@ SqlResult::Type Connection::InternalEstablish(
 }
 
 void Connection::Release() {
-  IGNITE_ODBC_API_CALL(InternalRelease());
+  AsyncApiCall(SQL_API_SQLDISCONNECT, [this]() { return InternalRelease(); });
 }
 
 void Connection::Deregister() {
@@ -220,6 +254,23 @@ Connection::GetQueryClient() const {
   return queryClient_;
 }
 
+std::shared_ptr< meta::ColumnMetaCache > Connection::GetMetaCache() const {
+  return metaCache_;
+}
+
+std::shared_ptr< ResultBufferBudget > Connection::GetResultBufferBudget()
+    const {
+  return resultBufferBudget_;
+}
+
+std::shared_ptr< ResultCache > Connection::GetResultCache() const {
+  return resultCache_;
+}
+
+std::shared_ptr< BackgroundWorkers > Connection::GetBackgroundWorkers() const {
+  return backgroundWorkers_;
+}
+
 SqlResult::Type Connection::InternalRelease() {
   LOG_DEBUG_MSG("InternalRelease is called");
   if (!queryClient_) {
@@ -240,6 +291,12 @@ SqlResult::Type Connection::InternalRelease() {
 }
 
 void Connection::Close() {
+  // the workers of the closed queries use the query client
+  if (backgroundWorkers_) {
+    backgroundWorkers_->JoinAll();
+    backgroundWorkers_.reset();
+  }
+
   if (queryClient_) {
     queryClient_.reset();
   }
@@ -247,9 +304,64 @@ void Connection::Close() {
   if (samlCredProvider_) {
     samlCredProvider_.reset();
   }
+
+  if (metaCache_) {
+    metaCache_.reset();
+  }
+
+  if (resultBufferBudget_) {
+    resultBufferBudget_.reset();
+  }
+
+  if (resultCache_) {
+    resultCache_.reset();
+  }
+}
+
+void Connection::AsyncApiCall(
+    SQLUSMALLINT function, const std::function< SqlResult::Type() >& call) {
+  if (asyncOperation_.IsRunning()) {
+    // the records of the function are not touched until it completes
+    if (function != asyncOperation_.GetFunction()) {
+      RejectIfAsyncRunning();
+      return;
+    }
+
+    if (!asyncOperation_.IsCompleted()) {
+      asyncOperation_.SetPollResult(SqlResult::AI_STILL_EXECUTING);
+      return;
+    }
+
+    diagnosticRecords.SetHeaderRecord(asyncOperation_.Collect());
+    return;
+  }
+
+  if (asyncDbcFunctionsEnable_ != SQL_ASYNC_DBC_ENABLE_ON) {
+    IGNITE_ODBC_API_CALL(call());
+    return;
+  }
+
+  diagnosticRecords.Reset();
+  asyncOperation_.Start(function, call);
+}
+
+bool Connection::RejectIfAsyncRunning() {
+  if (!asyncOperation_.IsRunning()) {
+    return false;
+  }
+
+  // the records of the function are not touched until it completes
+  asyncOperation_.SetPollError(
+      SqlState::SHY010_SEQUENCE_ERROR,
+      "Another function is executing asynchronously.");
+  return true;
 }
 
 Statement* Connection::CreateStatement() {
+  if (RejectIfAsyncRunning()) {
+    return nullptr;
+  }
+
   Statement* statement;
 
   IGNITE_ODBC_API_CALL(InternalCreateStatement(statement));
@@ -300,6 +412,10 @@ int32_t Connection::GetEnvODBCVer() {
 
 void Connection::GetAttribute(int attr, void* buf, SQLINTEGER bufLen,
                               SQLINTEGER* valueLen) {
+  if (RejectIfAsyncRunning()) {
+    return;
+  }
+
   IGNITE_ODBC_API_CALL(InternalGetAttribute(attr, buf, bufLen, valueLen));
 }
 
@@ -373,8 +489,19 @@ SqlResult::Type Connection::InternalGetAttribute(int attr, void* buf,
     case SQL_ATTR_ASYNC_ENABLE: {
       SQLUINTEGER* val = reinterpret_cast< SQLUINTEGER* >(buf);
 
-      // Asynchronous execution is not supported
-      *val = SQL_ASYNC_ENABLE_OFF;
+      // default of the statements allocated on the connection
+      *val = static_cast< SQLUINTEGER >(stmtAttr_.asyncEnable);
+
+      if (valueLen)
+        *valueLen = SQL_IS_INTEGER;
+
+      break;
+    }
+
+    case SQL_ATTR_ASYNC_DBC_FUNCTIONS_ENABLE: {
+      SQLUINTEGER* val = reinterpret_cast< SQLUINTEGER* >(buf);
+
+      *val = static_cast< SQLUINTEGER >(asyncDbcFunctionsEnable_);
 
       if (valueLen)
         *valueLen = SQL_IS_INTEGER;
@@ -382,6 +509,39 @@ SqlResult::Type Connection::InternalGetAttribute(int attr, void* buf,
       break;
     }
 
+    case SQL_ATTR_ASYNC_DBC_EVENT: {
+      SQLPOINTER* val = reinterpret_cast< SQLPOINTER* >(buf);
+
+      *val = asyncOperation_.GetEventHandle();
+
+      if (valueLen)
+        *valueLen = SQL_IS_POINTER;
+
+      break;
+    }
+
+    case SQL_ATTR_ASYNC_DBC_NOTIFICATION_CALLBACK: {
+      SQLPOINTER* val = reinterpret_cast< SQLPOINTER* >(buf);
+
+      *val = reinterpret_cast< SQLPOINTER >(asyncOperation_.GetCallback());
+
+      if (valueLen)
+        *valueLen = SQL_IS_POINTER;
+
+      break;
+    }
+
+    case SQL_ATTR_ASYNC_DBC_NOTIFICATION_CONTEXT: {
+      SQLPOINTER* val = reinterpret_cast< SQLPOINTER* >(buf);
+
+      *val = asyncOperation_.GetContext();
+
+      if (valueLen)
+        *valueLen = SQL_IS_POINTER;
+
+      break;
+    }
+
     case SQL_ATTR_TSLOG_DEBUG: {
       SQLUINTEGER* val = reinterpret_cast< SQLUINTEGER* >(buf);
 
@@ -409,6 +569,10 @@ SqlResult::Type Connection::InternalGetAttribute(int attr, void* buf,
 }
 
 void Connection::SetAttribute(int attr, void* value, SQLINTEGER valueLen) {
+  if (RejectIfAsyncRunning()) {
+    return;
+  }
+
   IGNITE_ODBC_API_CALL(InternalSetAttribute(attr, value, valueLen));
 }
 
@@ -481,6 +645,47 @@ SqlResult::Type Connection::InternalSetAttribute(int attr, void* value,
       LOG_INFO_MSG("login timeout is not implemented yet and this value is ignored.");
       break;
     }
+
+    case SQL_ATTR_ASYNC_ENABLE: {
+      return InternalSetStmtAttribute(
+          SQL_ASYNC_ENABLE,
+          static_cast< SQLULEN >(reinterpret_cast< ptrdiff_t >(value)));
+    }
+
+    case SQL_ATTR_ASYNC_DBC_FUNCTIONS_ENABLE: {
+      SqlUlen mode = reinterpret_cast< SqlUlen >(value);
+
+      if (mode != SQL_ASYNC_DBC_ENABLE_OFF && mode != SQL_ASYNC_DBC_ENABLE_ON) {
+        AddStatusRecord(SqlState::SHY024_INVALID_ATTRIBUTE_VALUE,
+                        "Invalid argument value");
+
+        return SqlResult::AI_ERROR;
+      }
+
+      asyncDbcFunctionsEnable_ = mode;
+
+      break;
+    }
+
+    case SQL_ATTR_ASYNC_DBC_EVENT: {
+      asyncOperation_.SetEventHandle(value);
+
+      break;
+    }
+
+    case SQL_ATTR_ASYNC_DBC_NOTIFICATION_CALLBACK: {
+      asyncOperation_.SetCallback(
+          reinterpret_cast< AsyncNotificationCallback >(value));
+
+      break;
+    }
+
+    case SQL_ATTR_ASYNC_DBC_NOTIFICATION_CONTEXT: {
+      asyncOperation_.SetContext(value);
+
+      break;
+    }
+
     default: {
       AddStatusRecord(SqlState::SHYC00_OPTIONAL_FEATURE_NOT_IMPLEMENTED,
                       "Specified attribute is not supported.");
@@ -759,6 +964,10 @@ Connection::CreateTSQueryClient(
 }
 
 Descriptor* Connection::CreateDescriptor() {
+  if (RejectIfAsyncRunning()) {
+    return nullptr;
+  }
+
   Descriptor* desc;
 
   IGNITE_ODBC_API_CALL(InternalCreateDescriptor(desc));
@@ -837,6 +1046,10 @@ void Connection::RemoveCursorName(const Statement* stmt) {
 
 #if defined(__APPLE__)
 void Connection::GetFunctions(SQLUSMALLINT funcId, SQLUSMALLINT* valueBuf) {
+  if (RejectIfAsyncRunning()) {
+    return;
+  }
+
   IGNITE_ODBC_API_CALL(InternalGetFunctions(funcId, valueBuf));
 }
 
@@ -1361,6 +1574,10 @@ void Connection::SetODBC2FunctionsValue(SQLUSMALLINT* valueBuf) {
 #endif //__APPLE__
 
 void Connection::SetStmtAttribute(SQLUSMALLINT option, SQLULEN value) {
+  if (RejectIfAsyncRunning()) {
+    return;
+  }
+
   IGNITE_ODBC_API_CALL(InternalSetStmtAttribute(option, value));
 }
 
@@ -1388,9 +1605,9 @@ SqlResult::Type Connection::InternalSetStmtAttribute(SQLUSMALLINT option,
       break;
     }
     case SQL_CURSOR_TYPE: {
-      if (value != SQL_CURSOR_FORWARD_ONLY) {
+      if (value != SQL_CURSOR_FORWARD_ONLY && value != SQL_CURSOR_STATIC) {
         AddStatusRecord(SqlState::SHYC00_OPTIONAL_FEATURE_NOT_IMPLEMENTED,
-                        "Only forward cursors are currently supported");
+                        "Only forward-only and static cursors are supported");
 
         return SqlResult::AI_ERROR;
       }
@@ -1413,14 +1630,29 @@ SqlResult::Type Connection::InternalSetStmtAttribute(SQLUSMALLINT option,
       stmtAttr_.rowsetSize = value;
       break;
     }
+    case SQL_MAX_ROWS: {
+      stmtAttr_.maxRows = value;
+      break;
+    }
+    case SQL_QUERY_TIMEOUT: {
+      stmtAttr_.queryTimeout = value;
+      break;
+    }
+    case SQL_ASYNC_ENABLE: {
+      if (value != SQL_ASYNC_ENABLE_OFF && value != SQL_ASYNC_ENABLE_ON) {
+        AddStatusRecord(SqlState::SHY024_INVALID_ATTRIBUTE_VALUE,
+                        "Invalid argument value");
+
+        return SqlResult::AI_ERROR;
+      }
+      stmtAttr_.asyncEnable = value;
+      break;
+    }
 
     // ignored attributes
     case SQL_NOSCAN:
-    case SQL_QUERY_TIMEOUT:
-    case SQL_MAX_ROWS:
     case SQL_MAX_LENGTH:
-    case SQL_KEYSET_SIZE:
-    case SQL_ASYNC_ENABLE: {
+    case SQL_KEYSET_SIZE: {
       AddStatusRecord(SqlState::S01000_GENERAL_WARNING,
                       "Specified attribute is ignored.",
                       timestream::odbc::LogLevel::Type::WARNING_LEVEL);
@@ -1442,6 +1674,10 @@ SqlResult::Type Connection::InternalSetStmtAttribute(SQLUSMALLINT option,
 }
 
 void Connection::SetConnectOption(SQLUSMALLINT option, SQLULEN value) {
+  if (RejectIfAsyncRunning()) {
+    return;
+  }
+
   IGNITE_ODBC_API_CALL(InternalSetConnectOption(option, value));
 }
 
@@ -1486,6 +1722,10 @@ SqlResult::Type Connection::InternalSetConnectOption(SQLUSMALLINT option,
 }
 
 void Connection::GetConnectOption(SQLUSMALLINT option, SQLPOINTER value) {
+  if (RejectIfAsyncRunning()) {
+    return;
+  }
+
   IGNITE_ODBC_API_CALL(InternalGetConnectOption(option, value));
 }
 
@@ -0,0 +1,154 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#include "timestream/odbc/conversion_plan.h"
+
+#include "timestream/odbc/log.h"
+#include "timestream/odbc/system/odbc_constants.h"
+
+using Aws::TimestreamQuery::Model::ScalarType;
+using timestream::odbc::app::ApplicationDataBuffer;
+using timestream::odbc::app::ConversionResult;
+using timestream::odbc::type_traits::OdbcNativeType;
+
+namespace {
+using timestream::odbc::ColumnarPage;
+using timestream::odbc::ConversionPlan;
+
+/**
+ * Put a decoded value to a buffer of any type.
+ */
+ConversionResult::Type PutDecoded(const ColumnarPage& page, uint32_t columnIdx,
+                                  size_t rowIdx,
+                                  ApplicationDataBuffer& dataBuf) {
+  return page.ReadToBuffer(columnIdx, rowIdx, dataBuf);
+}
+
+/**
+ * Converter of decoded integer values to a buffer of C type Tbuf.
+ */
+template < typename Tbuf >
+struct IntConverter {
+  static ConversionResult::Type Convert(const ColumnarPage& page,
+                                        uint32_t columnIdx, size_t rowIdx,
+                                        ApplicationDataBuffer& dataBuf) {
+    if (page.IsNull(columnIdx, rowIdx)) {
+      return dataBuf.PutNull();
+    }
+    return dataBuf.PutNumAs< Tbuf >(page.GetInt(columnIdx, rowIdx));
+  }
+};
+
+/**
+ * Converter of decoded double values to a buffer of C type Tbuf.
+ */
+template < typename Tbuf >
+struct DoubleConverter {
+  static ConversionResult::Type Convert(const ColumnarPage& page,
+                                        uint32_t columnIdx, size_t rowIdx,
+                                        ApplicationDataBuffer& dataBuf) {
+    if (page.IsNull(columnIdx, rowIdx)) {
+      return dataBuf.PutNull();
+    }
+    return dataBuf.PutNumAs< Tbuf >(page.GetDouble(columnIdx, rowIdx));
+  }
+};
+
+/**
+ * Find converter of decoded numeric values to a numeric buffer type.
+ * Put is IntConverter or DoubleConverter.
+ *
+ * @param targetType Type of the bound buffer.
+ * @return Converter, null if the buffer type is not numeric.
+ */
+template < template < typename > class Put >
+ConversionPlan::Converter FindNumConverter(OdbcNativeType::Type targetType) {
+  switch (targetType) {
+    case OdbcNativeType::AI_SIGNED_TINYINT:
+      return &Put< signed char >::Convert;
+    case OdbcNativeType::AI_BIT:
+    case OdbcNativeType::AI_UNSIGNED_TINYINT:
+      return &Put< unsigned char >::Convert;
+    case OdbcNativeType::AI_SIGNED_SHORT:
+      return &Put< SQLSMALLINT >::Convert;
+    case OdbcNativeType::AI_UNSIGNED_SHORT:
+      return &Put< SQLUSMALLINT >::Convert;
+    case OdbcNativeType::AI_SIGNED_LONG:
+      return &Put< SQLINTEGER >::Convert;
+    case OdbcNativeType::AI_UNSIGNED_LONG:
+      return &Put< SQLUINTEGER >::Convert;
+    case OdbcNativeType::AI_SIGNED_BIGINT:
+      return &Put< SQLBIGINT >::Convert;
+    case OdbcNativeType::AI_UNSIGNED_BIGINT:
+      return &Put< SQLUBIGINT >::Convert;
+    case OdbcNativeType::AI_FLOAT:
+      return &Put< SQLREAL >::Convert;
+    case OdbcNativeType::AI_DOUBLE:
+      return &Put< SQLDOUBLE >::Convert;
+    default:
+      return nullptr;
+  }
+}
+}  // namespace
+
+namespace timestream {
+namespace odbc {
+ConversionPlan::ConversionPlan()
+    : resolved_(false),
+      targetType_(OdbcNativeType::AI_UNSUPPORTED),
+      converter_(nullptr) {
+  // No-op.
+}
+
+void ConversionPlan::Resolve(ScalarType scalarType,
+                             OdbcNativeType::Type targetType) {
+  LOG_DEBUG_MSG("Resolve is called with scalar type "
+                << static_cast< int >(scalarType) << ", target type "
+                << targetType);
+  converter_ = FindConverter(scalarType, targetType);
+  targetType_ = targetType;
+  resolved_ = true;
+}
+
+ConversionPlan::Converter ConversionPlan::FindConverter(
+    ScalarType scalarType, OdbcNativeType::Type targetType) {
+  Converter converter = nullptr;
+  switch (scalarType) {
+    case ScalarType::BOOLEAN:
+    case ScalarType::INTEGER:
+    case ScalarType::BIGINT:
+      converter = FindNumConverter< IntConverter >(targetType);
+      break;
+    case ScalarType::DOUBLE:
+      converter = FindNumConverter< DoubleConverter >(targetType);
+      break;
+    case ScalarType::TIMESTAMP:
+    case ScalarType::DATE:
+    case ScalarType::TIME:
+      // the text of a temporal value is copied to a character buffer
+      if (targetType == OdbcNativeType::AI_CHAR
+          || targetType == OdbcNativeType::AI_WCHAR) {
+        return nullptr;
+      }
+      break;
+    default:
+      break;
+  }
+
+  return converter ? converter : &PutDecoded;
+}
+}  // namespace odbc
+}  // namespace timestream
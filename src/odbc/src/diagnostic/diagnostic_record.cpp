@@ -48,6 +48,9 @@ const std::string STATE_01S01 = "01S01";
 /** SQL state 01S02 constant. */
 const std::string STATE_01S02 = "01S02";
 
+/** SQL state 01S06 constant. */
+const std::string STATE_01S06 = "01S06";
+
 /** SQL state 01S07 constant. */
 const std::string STATE_01S07 = "01S07";
 
@@ -305,6 +308,9 @@ const std::string& DiagnosticRecord::GetSqlState() const {
     case SqlState::S01S02_OPTION_VALUE_CHANGED:
       return STATE_01S02;
 
+    case SqlState::S01S06_FETCH_BEFORE_FIRST_ROWSET:
+      return STATE_01S06;
+
     case SqlState::S01S07_FRACTIONAL_TRUNCATION:
       return STATE_01S07;
 
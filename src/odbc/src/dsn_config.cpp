@@ -293,6 +293,68 @@ void ReadDsnConfiguration(const char* dsn, Configuration& config,
 
   if (maxRowPerPage.IsSet() && !config.IsMaxRowPerPageSet())
     config.SetMaxRowPerPage(maxRowPerPage.GetValue());
+
+  SettableValue< int32_t > prefetchPages =
+      ReadDsnInt(dsn, ConnectionStringParser::Key::prefetchPages);
+
+  if (prefetchPages.IsSet() && !config.IsPrefetchPagesSet())
+    config.SetPrefetchPages(prefetchPages.GetValue());
+
+  SettableValue< int32_t > metadataCacheSize =
+      ReadDsnInt(dsn, ConnectionStringParser::Key::metadataCacheSize);
+
+  if (metadataCacheSize.IsSet() && !config.IsMetadataCacheSizeSet())
+    config.SetMetadataCacheSize(metadataCacheSize.GetValue());
+
+  SettableValue< int32_t > metadataCacheTTL =
+      ReadDsnInt(dsn, ConnectionStringParser::Key::metadataCacheTTL);
+
+  if (metadataCacheTTL.IsSet() && !config.IsMetadataCacheTTLSet())
+    config.SetMetadataCacheTTL(metadataCacheTTL.GetValue());
+
+  SettableValue< int32_t > maxResultBufferMB =
+      ReadDsnInt(dsn, ConnectionStringParser::Key::maxResultBufferMB);
+
+  if (maxResultBufferMB.IsSet() && !config.IsMaxResultBufferMBSet())
+    config.SetMaxResultBufferMB(maxResultBufferMB.GetValue());
+
+  SettableValue< int32_t > queryFanOut =
+      ReadDsnInt(dsn, ConnectionStringParser::Key::queryFanOut);
+
+  if (queryFanOut.IsSet() && !config.IsQueryFanOutSet())
+    config.SetQueryFanOut(queryFanOut.GetValue());
+
+  SettableValue< bool > fanOutOrdered =
+      ReadDsnBool(dsn, ConnectionStringParser::Key::fanOutOrdered,
+                  config.IsFanOutOrdered());
+
+  if (fanOutOrdered.IsSet() && !config.IsFanOutOrderedSet())
+    config.SetFanOutOrdered(fanOutOrdered.GetValue());
+
+  SettableValue< int32_t > resultCacheTTL =
+      ReadDsnInt(dsn, ConnectionStringParser::Key::resultCacheTTL);
+
+  if (resultCacheTTL.IsSet() && !config.IsResultCacheTTLSet())
+    config.SetResultCacheTTL(resultCacheTTL.GetValue());
+
+  SettableValue< std::string > resultCachePath =
+      ReadDsnString(dsn, ConnectionStringParser::Key::resultCachePath);
+
+  if (resultCachePath.IsSet() && !config.IsResultCachePathSet())
+    config.SetResultCachePath(resultCachePath.GetValue());
+
+  SettableValue< int32_t > scrollBufferMB =
+      ReadDsnInt(dsn, ConnectionStringParser::Key::scrollBufferMB);
+
+  if (scrollBufferMB.IsSet() && !config.IsScrollBufferMBSet())
+    config.SetScrollBufferMB(scrollBufferMB.GetValue());
+
+  SettableValue< bool > adaptivePageSize =
+      ReadDsnBool(dsn, ConnectionStringParser::Key::adaptivePageSize,
+                  config.IsAdaptivePageSize());
+
+  if (adaptivePageSize.IsSet() && !config.IsAdaptivePageSizeSet())
+    config.SetAdaptivePageSize(adaptivePageSize.GetValue());
 }
 
 bool WriteDsnConfiguration(const config::Configuration& config,
@@ -141,30 +141,31 @@ Aws::TimestreamQuery::Model::ScalarType ColumnMeta::GetScalarDataType(
   }
 }
 
-void ColumnMeta::Read(app::ColumnBindingMap& columnBindings, int32_t position) {
+void ColumnMeta::Read(app::ColumnBindingTable& columnBindings,
+                      int32_t position) {
   LOG_DEBUG_MSG("Read is called");
-  auto itr = columnBindings.find(1);
-  if (itr == columnBindings.end()) {
+  app::ApplicationDataBuffer* buffer = columnBindings.Find(1);
+  if (!buffer) {
     LOG_ERROR_MSG("Could not find the first column");
     return;
   }
-  columnName = itr->second.GetString(STRING_BUFFER_SIZE);
+  columnName = buffer->GetString(STRING_BUFFER_SIZE);
 
-  itr = columnBindings.find(2);
-  if (itr == columnBindings.end()) {
+  buffer = columnBindings.Find(2);
+  if (!buffer) {
     LOG_ERROR_MSG("Could not find the second column");
     return;
   }
 
   dataType = static_cast< int16_t >(
-      GetScalarDataType(itr->second.GetString(STRING_BUFFER_SIZE)));
+      GetScalarDataType(buffer->GetString(STRING_BUFFER_SIZE)));
 
-  itr = columnBindings.find(3);
-  if (itr == columnBindings.end()) {
+  buffer = columnBindings.Find(3);
+  if (!buffer) {
     LOG_ERROR_MSG("Could not find the third column");
     return;
   }
-  remarks = itr->second.GetString(STRING_BUFFER_SIZE);
+  remarks = buffer->GetString(STRING_BUFFER_SIZE);
   if (remarks.value() == "MEASURE_VALUE" || remarks.value() == "MULTI") {
     // These are measure values which could be nullable.
     nullability = Nullability::NULLABLE;
@@ -0,0 +1,139 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#include "timestream/odbc/meta/column_meta_cache.h"
+
+#include <cctype>
+
+namespace timestream {
+namespace odbc {
+namespace meta {
+ColumnMetaCache::ColumnMetaCache(size_t capacity, std::chrono::seconds ttl)
+    : capacity_(ttl.count() > 0 ? capacity : 0), ttl_(ttl) {
+  // No-op.
+}
+
+bool ColumnMetaCache::Get(const std::string& sql, ColumnMetaVector& meta) {
+  if (capacity_ == 0) {
+    return false;
+  }
+
+  std::string key = NormalizeSql(sql);
+  std::lock_guard< std::mutex > lock(mutex_);
+
+  auto it = index_.find(key);
+  if (it == index_.end()) {
+    LOG_DEBUG_MSG("Result set metadata is not cached");
+    return false;
+  }
+
+  if (it->second->expiry <= std::chrono::steady_clock::now()) {
+    LOG_DEBUG_MSG("Cached result set metadata is expired");
+    entries_.erase(it->second);
+    index_.erase(it);
+    return false;
+  }
+
+  // move the entry to the front as the most recently used one
+  entries_.splice(entries_.begin(), entries_, it->second);
+  meta = it->second->meta;
+
+  return true;
+}
+
+void ColumnMetaCache::Put(const std::string& sql,
+                          const ColumnMetaVector& meta) {
+  if (capacity_ == 0) {
+    return;
+  }
+
+  std::string key = NormalizeSql(sql);
+  std::lock_guard< std::mutex > lock(mutex_);
+
+  auto it = index_.find(key);
+  if (it != index_.end()) {
+    entries_.erase(it->second);
+    index_.erase(it);
+  }
+
+  entries_.push_front(
+      Entry{key, meta, std::chrono::steady_clock::now() + ttl_});
+  index_[key] = entries_.begin();
+
+  while (entries_.size() > capacity_) {
+    LOG_DEBUG_MSG("Evict least recently used result set metadata");
+    index_.erase(entries_.back().key);
+    entries_.pop_back();
+  }
+}
+
+void ColumnMetaCache::Invalidate(const std::string& sql) {
+  std::string key = NormalizeSql(sql);
+  std::lock_guard< std::mutex > lock(mutex_);
+
+  auto it = index_.find(key);
+  if (it != index_.end()) {
+    entries_.erase(it->second);
+    index_.erase(it);
+  }
+}
+
+void ColumnMetaCache::Clear() {
+  std::lock_guard< std::mutex > lock(mutex_);
+
+  entries_.clear();
+  index_.clear();
+}
+
+size_t ColumnMetaCache::Size() {
+  std::lock_guard< std::mutex > lock(mutex_);
+
+  return entries_.size();
+}
+
+std::string ColumnMetaCache::NormalizeSql(const std::string& sql) {
+  std::string normalized;
+  normalized.reserve(sql.size());
+
+  // the quote character of current literal or identifier, 0 if none
+  char quote = 0;
+  bool pendingSpace = false;
+  for (char ch : sql) {
+    if (quote != 0) {
+      normalized.push_back(ch);
+      if (ch == quote) {
+        // an escaped quote is handled as two adjacent literals
+        quote = 0;
+      }
+    } else if (std::isspace(static_cast< unsigned char >(ch))) {
+      pendingSpace = !normalized.empty();
+    } else {
+      if (pendingSpace) {
+        normalized.push_back(' ');
+        pendingSpace = false;
+      }
+      if (ch == '\'' || ch == '"') {
+        quote = ch;
+      }
+      normalized.push_back(ch);
+    }
+  }
+
+  return normalized;
+}
+}  // namespace meta
+}  // namespace odbc
+}  // namespace timestream
@@ -0,0 +1,262 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#include "timestream/odbc/number_parser.h"
+
+#include <cmath>
+#include <limits>
+#include <locale>
+#include <sstream>
+#include <string>
+
+namespace {
+/** Max number of significant digits kept in the mantissa of a double. */
+const int MAX_MANTISSA_DIGITS = 19;
+
+/** Largest mantissa a double represents exactly, 2^53. */
+const uint64_t MAX_EXACT_MANTISSA = 1ULL << 53;
+
+/** Largest power of ten a double represents exactly. */
+const int MAX_EXACT_POW10 = 22;
+
+/** Powers of ten a double represents exactly. */
+const double EXACT_POW10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,
+                              1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                              1e12, 1e13, 1e14, 1e15, 1e16, 1e17,
+                              1e18, 1e19, 1e20, 1e21, 1e22};
+
+/**
+ * Check if a character is a decimal digit.
+ *
+ * @param ch Character.
+ * @return True if the character is a digit.
+ */
+bool IsDigit(char ch) {
+  return static_cast< unsigned char >(ch - '0') <= 9;
+}
+
+/**
+ * Read a word ignoring the case of ASCII letters.
+ *
+ * @param pos Position of the text, moved after the word on success.
+ * @param last End of the text.
+ * @param word Expected word in lower case.
+ * @return True if the word is read.
+ */
+bool ReadWord(const char*& pos, const char* last, const char* word) {
+  const char* cur = pos;
+  for (; *word; word++, cur++) {
+    if (cur == last || (*cur | 0x20) != *word) {
+      return false;
+    }
+  }
+  pos = cur;
+  return true;
+}
+
+/**
+ * Read an integer with a magnitude up to a limit.
+ *
+ * @param first Beginning of the text.
+ * @param last End of the text.
+ * @param maxPositive Max positive value.
+ * @param value Value output.
+ * @return End of the read number, first on failure.
+ */
+const char* ReadInteger(const char* first, const char* last,
+                        uint64_t maxPositive, int64_t& value) {
+  const char* pos = first;
+  bool negative = false;
+  if (pos != last && (*pos == '-' || *pos == '+')) {
+    negative = *pos == '-';
+    pos++;
+  }
+
+  const char* digits = pos;
+  uint64_t limit = maxPositive + (negative ? 1 : 0);
+  uint64_t result = 0;
+  for (; pos != last && IsDigit(*pos); pos++) {
+    uint64_t digit = static_cast< uint64_t >(*pos - '0');
+    if (result > (limit - digit) / 10) {
+      return first;
+    }
+    result = result * 10 + digit;
+  }
+  if (pos == digits) {
+    return first;
+  }
+
+  // negate in unsigned arithmetic so the min value does not overflow
+  value = static_cast< int64_t >(negative ? 0 - result : result);
+  return pos;
+}
+
+/**
+ * Parse a double which is not exactly representable from its mantissa and
+ * power of ten. The classic locale stream rounds correctly, and it is only
+ * used for the rare long or large values.
+ *
+ * @param first Beginning of the number.
+ * @param last End of the number.
+ * @param value Value output.
+ * @return True on success.
+ */
+bool ParseDoubleSlow(const char* first, const char* last, double& value) {
+  std::istringstream stream(std::string(first, last));
+  stream.imbue(std::locale::classic());
+  double result = 0.0;
+  stream >> result;
+  if (stream.fail() || std::isinf(result)) {
+    return false;
+  }
+
+  value = result;
+  return true;
+}
+}  // namespace
+
+namespace timestream {
+namespace odbc {
+bool NumberParser::ParseInt32(const char* str, size_t len, int32_t& value) {
+  int64_t result;
+  const char* last = str + len;
+  if (len == 0
+      || ReadInteger(str, last, std::numeric_limits< int32_t >::max(),
+                     result)
+             != last) {
+    return false;
+  }
+
+  value = static_cast< int32_t >(result);
+  return true;
+}
+
+bool NumberParser::ParseInt64(const char* str, size_t len, int64_t& value) {
+  const char* last = str + len;
+  return len != 0 && ReadInt64(str, last, value) == last;
+}
+
+bool NumberParser::ParseDouble(const char* str, size_t len, double& value) {
+  const char* last = str + len;
+  return len != 0 && ReadDouble(str, last, value) == last;
+}
+
+const char* NumberParser::ReadInt64(const char* first, const char* last,
+                                    int64_t& value) {
+  return ReadInteger(first, last, std::numeric_limits< int64_t >::max(),
+                     value);
+}
+
+const char* NumberParser::ReadDouble(const char* first, const char* last,
+                                     double& value) {
+  const char* pos = first;
+  bool negative = false;
+  if (pos != last && (*pos == '-' || *pos == '+')) {
+    negative = *pos == '-';
+    pos++;
+  }
+
+  if (ReadWord(pos, last, "inf")) {
+    ReadWord(pos, last, "inity");
+    value = negative ? -std::numeric_limits< double >::infinity()
+                     : std::numeric_limits< double >::infinity();
+    return pos;
+  }
+  if (ReadWord(pos, last, "nan")) {
+    value = std::numeric_limits< double >::quiet_NaN();
+    return pos;
+  }
+
+  // the mantissa keeps the leading significant digits, the digits which do
+  // not fit move the decimal exponent instead
+  uint64_t mantissa = 0;
+  int significant = 0;
+  int64_t exponent = 0;
+  bool truncated = false;
+  bool hasDigits = false;
+  for (; pos != last && IsDigit(*pos); pos++) {
+    hasDigits = true;
+    if (significant < MAX_MANTISSA_DIGITS) {
+      mantissa = mantissa * 10 + static_cast< uint64_t >(*pos - '0');
+      significant += mantissa != 0 ? 1 : 0;
+    } else {
+      truncated |= *pos != '0';
+      exponent++;
+    }
+  }
+  if (pos != last && *pos == '.') {
+    pos++;
+    for (; pos != last && IsDigit(*pos); pos++) {
+      hasDigits = true;
+      if (significant < MAX_MANTISSA_DIGITS) {
+        mantissa = mantissa * 10 + static_cast< uint64_t >(*pos - '0');
+        significant += mantissa != 0 ? 1 : 0;
+        exponent--;
+      } else {
+        truncated |= *pos != '0';
+      }
+    }
+  }
+  if (!hasDigits) {
+    return first;
+  }
+
+  // an exponent without digits is not part of the number
+  if (pos != last && (*pos == 'e' || *pos == 'E')) {
+    const char* exponentPos = pos + 1;
+    bool negativeExponent = false;
+    if (exponentPos != last && (*exponentPos == '-' || *exponentPos == '+')) {
+      negativeExponent = *exponentPos == '-';
+      exponentPos++;
+    }
+    if (exponentPos != last && IsDigit(*exponentPos)) {
+      int64_t explicitExponent = 0;
+      for (; exponentPos != last && IsDigit(*exponentPos); exponentPos++) {
+        if (explicitExponent < 100000) {
+          explicitExponent = explicitExponent * 10 + (*exponentPos - '0');
+        }
+      }
+      exponent += negativeExponent ? -explicitExponent : explicitExponent;
+      pos = exponentPos;
+    }
+  }
+
+  if (mantissa == 0) {
+    value = negative ? -0.0 : 0.0;
+    return pos;
+  }
+
+  // both the mantissa and the power of ten are exact doubles, so a single
+  // multiplication or division rounds correctly
+  if (!truncated && mantissa <= MAX_EXACT_MANTISSA
+      && exponent >= -MAX_EXACT_POW10 && exponent <= MAX_EXACT_POW10) {
+    double result = static_cast< double >(mantissa);
+    if (exponent < 0) {
+      result /= EXACT_POW10[-exponent];
+    } else {
+      result *= EXACT_POW10[exponent];
+    }
+    value = negative ? -result : result;
+    return pos;
+  }
+
+  if (!ParseDoubleSlow(first, pos, value)) {
+    return first;
+  }
+  return pos;
+}
+}  // namespace odbc
+}  // namespace timestream
@@ -602,6 +602,10 @@ SQLRETURN SQLColumns(SQLHSTMT stmt, SQLWCHAR* catalogName,
                            << ", schema: " << schema.get_value_or("")
                            << ", table: " << table << ", column: " << column);
 
+  if (statement->RejectIfAsyncRunning()) {
+    return statement->GetDiagnosticRecords().GetReturnCode();
+  }
+
   if (catalog && catalog->empty() && schema && schema->empty()) {
     statement->AddStatusRecord(SqlState::S01000_GENERAL_WARNING,
                                "catalogName and schemaName are empty strings.");
@@ -1185,6 +1189,11 @@ SQLRETURN SQLGetData(SQLHSTMT stmt, SQLUSMALLINT colNum, SQLSMALLINT targetType,
   ApplicationDataBuffer dataBuffer(driverType, targetValue, bufferLength,
                                    strLengthOrIndicator);
 
+  // the cell offset is not reset while an asynchronous operation is running
+  if (statement->RejectIfAsyncRunning()) {
+    return statement->GetDiagnosticRecords().GetReturnCode();
+  }
+
   // Cell offsets are used between SQLGetData calls to return
   // variable-length data in parts. Statement keeps the cell offset
   // between repeated calls on the same column.
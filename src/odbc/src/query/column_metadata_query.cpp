@@ -276,7 +276,7 @@ const meta::ColumnMetaVector* ColumnMetadataQuery::GetMeta() {
 }
 
 SqlResult::Type ColumnMetadataQuery::FetchNextRow(
-    app::ColumnBindingMap& columnBindings) {
+    app::ColumnBindingTable& columnBindings) {
   LOG_DEBUG_MSG("FetchNextRow is called");
   if (!executed) {
     diag.AddStatusRecord(SqlState::SHY010_SEQUENCE_ERROR,
@@ -294,10 +294,8 @@ SqlResult::Type ColumnMetadataQuery::FetchNextRow(
     return SqlResult::AI_NO_DATA;
   }
 
-  app::ColumnBindingMap::iterator it;
-
-  for (it = columnBindings.begin(); it != columnBindings.end(); ++it)
-    GetColumn(it->first, it->second);
+  for (uint16_t columnIdx : columnBindings.GetBoundColumns())
+    GetColumn(columnIdx, columnBindings.GetBuffer(columnIdx));
 
   return SqlResult::AI_SUCCESS;
 }
@@ -490,7 +488,7 @@ SqlResult::Type ColumnMetadataQuery::GetColumnsWithDatabaseSearchPattern(
       return SqlResult::AI_SUCCESS_WITH_INFO;
     }
 
-    app::ColumnBindingMap columnBindings;
+    app::ColumnBindingTable columnBindings;
     SqlLen buflen = STRING_BUFFER_SIZE;
     // According to Timestream, database name could only contain
     // letters, digits, dashes, periods or underscores. It could
@@ -499,7 +497,7 @@ SqlResult::Type ColumnMetadataQuery::GetColumnsWithDatabaseSearchPattern(
     ApplicationDataBuffer buf1(
         timestream::odbc::type_traits::OdbcNativeType::Type::AI_CHAR,
         databaseName, buflen, nullptr);
-    columnBindings[databaseType] = buf1;
+    columnBindings.Bind(databaseType, buf1);
 
     // According to Timestream, table name could only contain
     // letters, digits, dashes, periods or underscores. It could
@@ -508,7 +506,7 @@ SqlResult::Type ColumnMetadataQuery::GetColumnsWithDatabaseSearchPattern(
     ApplicationDataBuffer buf2(
         timestream::odbc::type_traits::OdbcNativeType::Type::AI_CHAR,
         &tableName, buflen, nullptr);
-    columnBindings[TableMetadataQuery::ResultColumn::TABLE_NAME] = buf2;
+    columnBindings.Bind(TableMetadataQuery::ResultColumn::TABLE_NAME, buf2);
 
     LOG_ERROR_MSG("table is " << databaseName << "." << tableName);
     while (tableMetadataQuery_->FetchNextRow(columnBindings)
@@ -565,26 +563,26 @@ SqlResult::Type ColumnMetadataQuery::MakeRequestGetColumnsMetaPerTable(
     return SqlResult::AI_NO_DATA;
   }
 
-  app::ColumnBindingMap columnBindings;
+  app::ColumnBindingTable columnBindings;
   SqlLen buflen = STRING_BUFFER_SIZE;
   // column name could be a unicode string
   SQLWCHAR columnName[STRING_BUFFER_SIZE];
   ApplicationDataBuffer buf1(
       timestream::odbc::type_traits::OdbcNativeType::Type::AI_WCHAR, columnName,
       buflen, nullptr);
-  columnBindings[1] = buf1;
+  columnBindings.Bind(1, buf1);
 
   char dataType[64];
   ApplicationDataBuffer buf2(
       timestream::odbc::type_traits::OdbcNativeType::Type::AI_CHAR, &dataType,
       buflen, nullptr);
-  columnBindings[2] = buf2;
+  columnBindings.Bind(2, buf2);
 
   char remarks[64];
   ApplicationDataBuffer buf3(
       timestream::odbc::type_traits::OdbcNativeType::Type::AI_CHAR, &remarks,
       buflen, nullptr);
-  columnBindings[3] = buf3;
+  columnBindings.Bind(3, buf3);
 
   LOG_DEBUG_MSG("column is " << columnName << ", dataType is " << dataType
                              << ", remarks is " << remarks);
@@ -79,7 +79,7 @@ const meta::ColumnMetaVector* ColumnPrivilegesQuery::GetMeta() {
 }
 
 SqlResult::Type ColumnPrivilegesQuery::FetchNextRow(
-    app::ColumnBindingMap& columnBindings) {
+    app::ColumnBindingTable& columnBindings) {
   diag.AddStatusRecord(
       SqlState::S01000_GENERAL_WARNING,
       "SQLColumnPrivileges is not supported. No data is returned.",
@@ -19,28 +19,143 @@
  */
 
 #include "timestream/odbc/query/data_query.h"
+#include "timestream/odbc/query/page_sizer.h"
+#include "timestream/odbc/query/time_range_splitter.h"
 
 #include "timestream/odbc/connection.h"
 #include "timestream/odbc/log.h"
 #include "ignite/odbc/odbc_error.h"
 
+#include <chrono>
+#include <limits>
+
+#include <aws/timestream-query/TimestreamQueryErrors.h>
 #include <aws/timestream-query/model/Type.h>
 #include <aws/timestream-query/model/CancelQueryRequest.h>
+#include <aws/timestream-query/model/PrepareQueryRequest.h>
+
+namespace {
+/** Max size of a result which is written to the result cache. */
+const size_t MAX_CACHED_RESULT_BYTES = 64 * 1024 * 1024;
+
+/** Max number of rows of a page returned by Timestream. */
+const int64_t MAX_PAGE_ROWS = 1000;
+
+/**
+ * Size the next page of a request to the rows which are still needed, so
+ * the rows after the limit are not returned.
+ *
+ * @param request Query request.
+ * @param remaining Number of rows still needed.
+ * @param maxRowPerPage Max number of rows of a page, zero if it is not set.
+ */
+void LimitPageRows(QueryRequest& request, int64_t remaining,
+                   int32_t maxRowPerPage) {
+  int64_t pageRows = maxRowPerPage > 0 ? maxRowPerPage : MAX_PAGE_ROWS;
+  if (request.MaxRowsHasBeenSet()) {
+    // the page could be sized smaller by the adaptive page size
+    pageRows = std::min< int64_t >(pageRows, request.GetMaxRows());
+  }
+  if (remaining < pageRows) {
+    request.SetMaxRows(static_cast< int >(std::max< int64_t >(remaining, 1)));
+  }
+}
+
+/**
+ * Cancel a query whose remaining pages are not needed. Failures are only
+ * logged as the fetched pages are still valid.
+ *
+ * @param client Timestream query client.
+ * @param queryId Query ID.
+ */
+void CancelRemainingPages(
+    const std::shared_ptr< Aws::TimestreamQuery::TimestreamQueryClient >&
+        client,
+    const Aws::String& queryId) {
+  if (queryId.empty()) {
+    return;
+  }
+
+  Aws::TimestreamQuery::Model::CancelQueryRequest request;
+  request.SetQueryId(queryId);
+  auto outcome = client->CancelQuery(request);
+  if (outcome.IsSuccess()) {
+    LOG_DEBUG_MSG("Query ID: " << queryId
+                               << " is cancelled as its pages are not needed");
+  } else {
+    LOG_DEBUG_MSG("Query ID: " << queryId << " can't cancel. "
+                               << outcome.GetError().GetMessage());
+  }
+}
+
+/**
+ * Check if a PrepareQuery error means the operation could not be used,
+ * e.g. it is not permitted to the user or not known to the endpoint. Other
+ * errors such as a ValidationException are errors of the query itself.
+ *
+ * @param error PrepareQuery error.
+ * @return True if the operation could not be used.
+ */
+bool IsPrepareQueryUnavailable(
+    const Aws::TimestreamQuery::TimestreamQueryError& error) {
+  using Aws::TimestreamQuery::TimestreamQueryErrors;
+  switch (error.GetErrorType()) {
+    case TimestreamQueryErrors::ACCESS_DENIED:
+    case TimestreamQueryErrors::INVALID_ACTION:
+      return true;
+    default:
+      break;
+  }
+  const Aws::String& name = error.GetExceptionName();
+  return name == "AccessDeniedException"
+         || name == "UnknownOperationException";
+}
+}  // namespace
 
 namespace timestream {
 namespace odbc {
 namespace query {
 DataQuery::DataQuery(diagnostic::DiagnosableAdapter& diag,
-                     Connection& connection, const std::string& sql)
+                     Connection& connection, const std::string& sql,
+                     bool scrollable)
     : Query(diag, timestream::odbc::query::QueryType::DATA),
       connection_(connection),
       sql_(sql),
       resultMetaAvailable_(false),
       resultMeta_(),
+      conversionPlans_(),
       request_(),
       result_(nullptr),
+      resultBytes_(0),
+      queryId_(),
       cursor_(nullptr),
       queryClient_(connection.GetQueryClient()),
+      context_(std::make_shared< DataQueryContext >(
+          static_cast< size_t >(
+              connection.GetConfiguration().GetPrefetchPages()),
+          connection.GetResultBufferBudget(), 0,
+          connection.GetConfiguration().IsMaxRowPerPageSet()
+              ? connection.GetConfiguration().GetMaxRowPerPage()
+              : 0,
+          connection.GetConfiguration().IsAdaptivePageSize()
+              && !connection.GetConfiguration().IsMaxRowPerPageSet())),
+      workers_(),
+      parts_(1),
+      finishedParts_(0),
+      currentPart_(0),
+      ordered_(true),
+      cachePages_(),
+      cacheBytes_(0),
+      isCaching_(false),
+      scrollable_(scrollable),
+      maxRows_(0),
+      queryTimeout_(0),
+      waitFailed_(false),
+      interrupted_(false),
+      pageStore_(),
+      position_(0),
+      cursorPage_(nullptr),
+      pageStartTime_(),
       hasAsyncFetch(false),
       rowCounter(0) {
   // No-op.
@@ -49,14 +164,14 @@ DataQuery::DataQuery(diagnostic::DiagnosableAdapter& diag,
 DataQuery::~DataQuery() {
   LOG_DEBUG_MSG("~DataQuery is called");
 
-  if (result_.get())
+  if (result_.get() || !workers_.empty())
     InternalClose();
 }
 
 SqlResult::Type DataQuery::Execute() {
   LOG_DEBUG_MSG("Execute is called");
 
-  if (result_.get())
+  if (result_.get() || !workers_.empty())
     InternalClose();
 
   SqlResult::Type retval = MakeRequestExecute();
@@ -65,11 +180,36 @@ SqlResult::Type DataQuery::Execute() {
   return retval;
 }
 
+void DataQuery::SetMaxRows(int64_t maxRows) {
+  maxRows_ = maxRows;
+}
+
+void DataQuery::SetQueryTimeout(int32_t queryTimeout) {
+  queryTimeout_ = queryTimeout;
+}
+
+void DataQuery::Interrupt() {
+  LOG_DEBUG_MSG("Interrupt is called");
+  interrupted_ = true;
+
+  // the context is replaced when the query is closed by the executing thread
+  std::shared_ptr< DataQueryContext > context = std::atomic_load(&context_);
+  {
+    // the waiting thread checks the flag before it waits or is notified
+    std::lock_guard< std::mutex > locker(context->mutex_);
+  }
+  context->cv_.notify_all();
+}
+
+void DataQuery::ClearInterrupt() {
+  interrupted_ = false;
+}
+
 SqlResult::Type DataQuery::Cancel() {
   LOG_DEBUG_MSG("Cancel is called");
 
   if (hasAsyncFetch) {
-    if (!result_) {
+    if (queryId_.empty()) {
       LOG_ERROR_MSG("no result found");
       diag.AddStatusRecord(SqlState::SHY000_GENERAL_ERROR,
                            "query is not executed");
@@ -78,7 +218,7 @@ SqlResult::Type DataQuery::Cancel() {
 
     // Try to cancel current query
     Aws::TimestreamQuery::Model::CancelQueryRequest cancel_request;
-    cancel_request.SetQueryId(result_->GetQueryId());
+    cancel_request.SetQueryId(queryId_);
 
     auto outcome = connection_.GetQueryClient()->CancelQuery(cancel_request);
     std::string message("");
@@ -97,6 +237,12 @@ SqlResult::Type DataQuery::Cancel() {
       }
     }
     LOG_DEBUG_MSG(message.c_str());
+
+    // the query is not cancelled again when the query is closed
+    std::lock_guard< std::mutex > locker(context_->mutex_);
+    std::vector< Aws::String >& queryIds = context_->queryIds_;
+    queryIds.erase(std::remove(queryIds.begin(), queryIds.end(), queryId_),
+                   queryIds.end());
   }
 
   InternalClose();
@@ -107,6 +253,14 @@ SqlResult::Type DataQuery::Cancel() {
 const meta::ColumnMetaVector* DataQuery::GetMeta() {
   LOG_DEBUG_MSG("GetMeta is called");
 
+  std::shared_ptr< meta::ColumnMetaCache > metaCache =
+      connection_.GetMetaCache();
+  if (!resultMetaAvailable_ && metaCache
+      && metaCache->Get(sql_, resultMeta_)) {
+    LOG_DEBUG_MSG("Result set metadata is found in cache");
+    resultMetaAvailable_ = true;
+  }
+
   if (!resultMetaAvailable_) {
     MakeRequestResultsetMeta();
 
@@ -121,41 +275,209 @@ const meta::ColumnMetaVector* DataQuery::GetMeta() {
 }
 
 /**
- * Fetch one page asynchronously. It will be
- * executed in an asynchronous thread.
+ * Fetch pages asynchronously until the last page is fetched, the max rows
+ * of the result are fetched or the main thread is exiting. It is executed
+ * in a worker thread of the query and keeps at most context->prefetchPages_
+ * pages of its time sub-range in context->queue_.
  *
  * @return void.
  */
-void AsyncFetchOnePage(
+void AsyncFetchPages(
     const std::shared_ptr< Aws::TimestreamQuery::TimestreamQueryClient > client,
-    const QueryRequest& request, DataQueryContext& context_) {
-  LOG_DEBUG_MSG("AsyncFetchOnePage is called");
-  Aws::TimestreamQuery::Model::QueryOutcome result;
-  result = client->Query(request);
+    QueryRequest request, size_t part, int64_t fetchedRows,
+    const std::shared_ptr< DataQueryContext > context) {
+  LOG_DEBUG_MSG("AsyncFetchPages is called");
+  // This thread could only continue when context->queue_ has room and the
+  // memory budget is not exhausted, or the main thread is exiting. One page
+  // is always allowed so the query could make progress.
+  auto canFetch = [&]() {
+    if (context->isClosing_) {
+      return true;
+    }
+    size_t queued = context->GetQueuedPages(part);
+    if (queued >= context->prefetchPages_) {
+      return false;
+    }
+    return queued == 0 || !context->budget_ || context->budget_->HasRoom();
+  };
+
+  // query ID of the query to be cancelled by this thread
+  Aws::String queryId;
+  std::unique_lock< std::mutex > locker(context->mutex_);
+  do {
+    // the budget could be released by other statements of the connection
+    // which do not notify this context, so check it periodically
+    while (!context->cv_.wait_for(locker, std::chrono::milliseconds(100),
+                                  canFetch)) {
+    }
+
+    if (context->isClosing_) {
+      break;
+    }
+
+    locker.unlock();
+    if (context->maxRows_ > 0) {
+      LimitPageRows(request, context->maxRows_ - fetchedRows,
+                    context->maxRowPerPage_);
+    }
+    FetchedPage page;
+    page.part = part;
+    auto fetchStart = std::chrono::steady_clock::now();
+    page.outcome = client->Query(request);
+    std::chrono::duration< double > latency =
+        std::chrono::steady_clock::now() - fetchStart;
+    if (page.outcome.IsSuccess()) {
+      // decode the page here so the main thread only copies the values
+      page.columns =
+          std::make_shared< ColumnarPage >(page.outcome.GetResult());
+      page.bytes =
+          ResultBufferBudget::EstimateSize(page.outcome.GetResult())
+          + page.columns->GetSize();
+    }
+    locker.lock();
+
+    Aws::String pageQueryId;
+    if (page.outcome.IsSuccess()) {
+      pageQueryId = page.outcome.GetResult().GetQueryId();
+    }
+    bool isKnown = std::find(context->queryIds_.begin(),
+                             context->queryIds_.end(), pageQueryId)
+                   != context->queryIds_.end();
+
+    // no more pages after an error or the last page
+    bool isLast = !page.outcome.IsSuccess()
+                  || page.outcome.GetResult().GetNextToken().empty();
+
+    if (context->isClosing_) {
+      LOG_DEBUG_MSG("Main thread is exiting, drop the fetched page");
+      // the main thread only cancels the queries it knows about
+      if (!isLast && !isKnown) {
+        queryId = pageQueryId;
+      }
+      break;
+    }
+
+    if (!isLast) {
+      request.SetNextToken(page.outcome.GetResult().GetNextToken());
+      size_t rows = page.outcome.GetResult().GetRows().size();
+      if (context->adaptivePageSize_) {
+        request.SetMaxRows(PageSizer::NextPageRows(
+            request.GetMaxRows(), rows, page.bytes, latency.count(),
+            context->drainRate_));
+      }
+      fetchedRows += rows;
+      if (context->maxRows_ > 0 && fetchedRows >= context->maxRows_) {
+        queryId = pageQueryId;
+        isLast = true;
+      } else if (!isKnown) {
+        context->queryIds_.push_back(pageQueryId);
+      }
+    }
+    page.isLast = isLast;
+
+    if (context->budget_) {
+      context->budget_->Acquire(page.bytes);
+    }
+    context->queue_.push_back(std::move(page));
+    context->cv_.notify_all();
+
+    if (isLast) {
+      LOG_DEBUG_MSG("Last page is fetched");
+      break;
+    }
+  } while (true);
+  locker.unlock();
+
+  // the server stops scanning for the rows which are not needed
+  CancelRemainingPages(client, queryId);
 
-  std::unique_lock< std::mutex > locker(context_.mutex_);
-  context_.cv_.wait(locker, [&]() {
-    // This thread could only continue when context_.queue_ is empty
-    // or the main thread is exiting.
-    return context_.queue_.empty() || context_.isClosing_;
-  });
+  locker.lock();
+  context->runningWorkers_--;
+}
 
-  if (context_.queue_.empty()) {
-    LOG_DEBUG_MSG("Result queue is empty");
-    // context_.queue_ hold one element at most
-    context_.queue_.push(result);
-    context_.cv_.notify_one();
+/**
+ * Cancel the queries of a closed query. It is executed in a worker thread
+ * so closing the query does not wait for the responses.
+ *
+ * @return void.
+ */
+void CancelClosedQueries(
+    const std::shared_ptr< Aws::TimestreamQuery::TimestreamQueryClient > client,
+    const std::vector< Aws::String > queryIds,
+    const std::shared_ptr< DataQueryContext > context) {
+  LOG_DEBUG_MSG("CancelClosedQueries is called");
+  for (const Aws::String& queryId : queryIds) {
+    CancelRemainingPages(client, queryId);
   }
+
+  std::lock_guard< std::mutex > locker(context->mutex_);
+  context->runningWorkers_--;
 }
 
 SqlResult::Type DataQuery::SwitchCursor() {
   LOG_DEBUG_MSG("SwitchCursor is called");
-  std::unique_lock< std::mutex > locker(context_.mutex_);
-  context_.cv_.wait(locker, [&]() { return !context_.queue_.empty(); });
-  Aws::TimestreamQuery::Model::QueryOutcome outcome = context_.queue_.front();
-  context_.queue_.pop();
+
+  // the rate the rows of the current page are delivered at sizes the next
+  // pages, the time waiting for a page is not counted
+  double drainRate = 0;
+  if (context_->adaptivePageSize_ && result_
+      && pageStartTime_ != std::chrono::steady_clock::time_point()) {
+    std::chrono::duration< double > elapsed =
+        std::chrono::steady_clock::now() - pageStartTime_;
+    if (elapsed.count() > 0) {
+      drainRate = result_->GetRows().size() / elapsed.count();
+    }
+  }
+
+  // all rows of the current page are delivered, release it before waiting
+  // for the next page so it does not count against the budget
+  ReleasePage();
+
+  std::unique_lock< std::mutex > locker(context_->mutex_);
+  if (drainRate > 0) {
+    context_->drainRate_ = drainRate;
+  }
+  std::deque< FetchedPage >::iterator next;
+  auto isPageReady = [&]() {
+    // in time order only the pages of the current sub-range could be read
+    next = std::find_if(context_->queue_.begin(), context_->queue_.end(),
+                        [&](const FetchedPage& page) {
+                          return !ordered_ || page.part == currentPart_;
+                        });
+    return next != context_->queue_.end();
+  };
+  auto canSwitch = [&]() { return interrupted_ || isPageReady(); };
+  if (queryTimeout_ <= 0) {
+    context_->cv_.wait(locker, canSwitch);
+  } else if (!context_->cv_.wait_for(
+                 locker, std::chrono::seconds(queryTimeout_), canSwitch)) {
+    locker.unlock();
+    LOG_ERROR_MSG("Query timeout of " << queryTimeout_
+                                      << " seconds expired for query "
+                                      << sql_);
+    diag.AddStatusRecord(SqlState::SHYT00_TIMEOUT_EXPIRED,
+                         "Query timeout expired");
+    waitFailed_ = true;
+    // the running queries are cancelled on the server by InternalClose
+    // and by the workers waiting for their first page
+    InternalClose();
+    return SqlResult::AI_ERROR;
+  }
+  if (interrupted_) {
+    locker.unlock();
+    // the cancellation is reported by the statement
+    LOG_INFO_MSG("Waiting for a page is interrupted for query " << sql_);
+    waitFailed_ = true;
+    InternalClose();
+    return SqlResult::AI_ERROR;
+  }
+  FetchedPage page = std::move(*next);
+  context_->queue_.erase(next);
   locker.unlock();
+  // wake up the worker thread as the queue has room now
+  context_->cv_.notify_all();
 
+  Aws::TimestreamQuery::Model::QueryOutcome& outcome = page.outcome;
   if (!outcome.IsSuccess()) {
     auto& error = outcome.GetError();
     LOG_ERROR_MSG("ERROR: " << error.GetExceptionName() << ": "
@@ -163,70 +485,80 @@ SqlResult::Type DataQuery::SwitchCursor() {
                             << ", number of rows fetched: " << rowCounter);
     cursor_.reset();
     hasAsyncFetch = false;  // no async fetch any more
+    isCaching_ = false;     // an incomplete result is not cached
+    cachePages_.clear();
     return SqlResult::Type::AI_ERROR;
   }
 
-  result_ = std::make_shared< QueryResult >(outcome.GetResult());
-  const Aws::Vector< Row >& rows = outcome.GetResult().GetRows();
-  const Aws::String& token = outcome.GetResult().GetNextToken();
-  if (rows.empty()) {
-    LOG_INFO_MSG(
-        "Data fetching is finished, number of rows fetched: " << rowCounter);
-    return SqlResult::AI_NO_DATA;
+  result_ = std::make_shared< QueryResult >(outcome.GetResultWithOwnership());
+  resultBytes_ = page.bytes;
+  if (queryId_.empty()) {
+    queryId_ = result_->GetQueryId();
   }
 
+  const Aws::Vector< Row >& rows = result_->GetRows();
+  if (page.isLast) {
+    // the time sub-range of the page is fetched to the last page
+    finishedParts_++;
+    currentPart_++;
+  }
+  bool isLast = finishedParts_ == parts_;
+  CachePage(*result_, isLast);
+
   // switch to rows in next page
-  cursor_.reset(new TimestreamCursor(rows, resultMeta_));
-  cursor_->Increment();  // The cursor_ needs to be incremented before using it
-                         // for the first time
+  cursor_.reset(new TimestreamCursor(result_, resultMeta_, page.columns));
+  cursorPage_ = result_.get();
+  pageStartTime_ = std::chrono::steady_clock::now();
+  if (pageStore_) {
+    pageStore_->Add(result_, page.columns);
+  }
+  if (rows.empty() && !isLast) {
+    LOG_DEBUG_MSG("Skip empty page");
+    return SwitchCursor();
+  }
 
-  if (token.empty()) {
+  if (isLast) {
     hasAsyncFetch = false;  // no async fetch any more
     LOG_INFO_MSG(
         "Data fetching is finished, number of rows fetched: " << rowCounter);
-  } else {
-    if (!threads_.empty()) {
-      std::thread& itr = threads_.front();
-      // wait for the last thread to end. The join() should be done before the
-      // thread is popped from the queue. The thread could not be joined after
-      // it is popped from the queue, as it could cause crash.
-      LOG_DEBUG_MSG("Waiting for thread " << itr.get_id() << " to end");
-      if (itr.joinable()) {
-        itr.join();
-      }
-      threads_.pop();
-    } else {
-      LOG_DEBUG_MSG("The threads queue is empty");
-    }
-
-    request_.SetNextToken(token);
-    std::thread next(AsyncFetchOnePage, queryClient_, std::ref(request_),
-                     std::ref(context_));
-    LOG_DEBUG_MSG("New thread " << next.get_id() << " is started");
-    addThreads(next);
   }
 
-  return SqlResult::AI_SUCCESS;
+  // keep the empty cursor so the cursor is still open
+  return rows.empty() ? SqlResult::AI_NO_DATA : SqlResult::AI_SUCCESS;
 }
 
-SqlResult::Type DataQuery::FetchNextRow(app::ColumnBindingMap& columnBindings) {
+SqlResult::Type DataQuery::FetchNextRow(
+    app::ColumnBindingTable& columnBindings) {
   LOG_DEBUG_MSG("FetchNextRow is called");
-  if (!cursor_) {
+  if (pageStore_) {
+    // the row is read from the page store, so the pages before it are kept
+    SqlResult::Type result = SeekRow(position_ + 1);
+    if (result != SqlResult::AI_SUCCESS) {
+      return result;
+    }
+    position_++;
+  } else if (!cursor_) {
     diag.AddStatusRecord(SqlState::S01000_GENERAL_WARNING,
                          "Cursor does not point to any data.",
                          timestream::odbc::LogLevel::Type::WARNING_LEVEL);
     return SqlResult::AI_NO_DATA;
-  }
-
-  if (!cursor_->Increment()) {
+  } else if (maxRows_ > 0 && rowCounter >= maxRows_) {
+    LOG_INFO_MSG("Exit due to max rows " << maxRows_ << " are fetched.");
+    return SqlResult::AI_NO_DATA;
+  } else if (!cursor_->Increment()) {
     if (hasAsyncFetch) {
       SqlResult::Type result = SwitchCursor();
       if (result != SqlResult::AI_SUCCESS) {
-        diag.AddStatusRecord(SqlState::S24000_INVALID_CURSOR_STATE,
-                             "Invalid cursor state.",
-                             timestream::odbc::LogLevel::Type::WARNING_LEVEL);
+        // a timeout is reported by SwitchCursor, which closes the cursor
+        if (!waitFailed_) {
+          diag.AddStatusRecord(
+              SqlState::S24000_INVALID_CURSOR_STATE, "Invalid cursor state.",
+              timestream::odbc::LogLevel::Type::WARNING_LEVEL);
+        }
         return result;
       }
+      cursor_->Increment();  // The cursor_ needs to be incremented before
+                             // using it for the first time
     } else {
       LOG_INFO_MSG(
           "Exit due to cursor has reached the "
@@ -235,16 +567,16 @@ SqlResult::Type DataQuery::FetchNextRow(app::ColumnBindingMap& columnBindings) {
     }
   }
 
-  for (uint32_t i = 1; i < cursor_->GetColumnSize() + 1; ++i) {
-    app::ColumnBindingMap::iterator it = columnBindings.find(i);
-
-    if (it == columnBindings.end())
+  uint32_t columnSize = static_cast< uint32_t >(cursor_->GetColumnSize());
+  for (uint16_t columnIdx : columnBindings.GetBoundColumns()) {
+    if (columnIdx < 1 || columnIdx > columnSize)
       continue;
 
-    app::ConversionResult::Type convRes =
-        cursor_->ReadColumnToBuffer(i, it->second);
+    app::ApplicationDataBuffer& dataBuf = columnBindings.GetBuffer(columnIdx);
+    app::ConversionResult::Type convRes = cursor_->ReadColumnToBuffer(
+        columnIdx, dataBuf, GetConversionPlan(columnIdx, dataBuf));
 
-    SqlResult::Type result = ProcessConversionResult(convRes, 0, i);
+    SqlResult::Type result = ProcessConversionResult(convRes, 0, columnIdx);
 
     if (result == SqlResult::AI_ERROR) {
       LOG_ERROR_MSG("Exit due to data reading error");
@@ -256,6 +588,96 @@ SqlResult::Type DataQuery::FetchNextRow(app::ColumnBindingMap& columnBindings) {
   return SqlResult::AI_SUCCESS;
 }
 
+void DataQuery::FetchRowset(app::ColumnBindingTable& columnBindings,
+                            std::vector< SqlResult::Type >& rowResults) {
+  LOG_DEBUG_MSG("FetchRowset is called with rowset size "
+                << rowResults.size());
+  size_t rowIdx = 0;
+  while (rowIdx < rowResults.size()) {
+    size_t count = 0;
+    if (!pageStore_ && cursor_) {
+      count = std::min(cursor_->GetRowsAhead(), rowResults.size() - rowIdx);
+      if (maxRows_ > 0) {
+        int64_t left = std::max(maxRows_ - rowCounter, int64_t(0));
+        count = std::min(count, static_cast< size_t >(left));
+      }
+    }
+
+    if (count > 0) {
+      FillRowsFromPage(columnBindings, rowIdx, count, rowResults);
+      rowIdx += count;
+      continue;
+    }
+
+    // the row is in the next page or in the page store
+    columnBindings.SetElementOffset(rowIdx);
+    SqlResult::Type result = FetchNextRow(columnBindings);
+    rowResults[rowIdx++] = result;
+    if (result == SqlResult::AI_NO_DATA) {
+      std::fill(rowResults.begin() + rowIdx, rowResults.end(),
+                SqlResult::AI_NO_DATA);
+      break;
+    }
+  }
+}
+
+void DataQuery::FillRowsFromPage(app::ColumnBindingTable& columnBindings,
+                                 size_t first, size_t count,
+                                 std::vector< SqlResult::Type >& rowResults) {
+  LOG_DEBUG_MSG("FillRowsFromPage is called with first "
+                << first << ", count " << count);
+  size_t pageRowIdx = cursor_->GetNextRowIndex();
+  std::fill(rowResults.begin() + first, rowResults.begin() + first + count,
+            SqlResult::AI_SUCCESS);
+
+  uint32_t columnSize = static_cast< uint32_t >(cursor_->GetColumnSize());
+  for (uint16_t columnIdx : columnBindings.GetBoundColumns()) {
+    if (columnIdx < 1 || columnIdx > columnSize)
+      continue;
+
+    app::ApplicationDataBuffer& dataBuf = columnBindings.GetBuffer(columnIdx);
+    const ConversionPlan& plan = GetConversionPlan(columnIdx, dataBuf);
+    for (size_t i = 0; i < count; ++i) {
+      dataBuf.SetElementOffset(first + i);
+      app::ConversionResult::Type convRes =
+          cursor_->ReadColumnToBuffer(columnIdx, pageRowIdx + i, dataBuf, plan);
+
+      SqlResult::Type result = ProcessConversionResult(
+          convRes, static_cast< int32_t >(first + i + 1), columnIdx);
+      if (result == SqlResult::AI_ERROR) {
+        LOG_ERROR_MSG("Data reading error in row " << first + i + 1);
+        rowResults[first + i] = SqlResult::AI_ERROR;
+      }
+    }
+  }
+
+  cursor_->SetPosition(pageRowIdx + count - 1);
+
+  // rows with errors are not counted, as in FetchNextRow
+  rowCounter += static_cast< int >(
+      std::count_if(rowResults.begin() + first,
+                    rowResults.begin() + first + count,
+                    [](SqlResult::Type res) {
+                      return res != SqlResult::AI_ERROR;
+                    }));
+}
+
+const ConversionPlan& DataQuery::GetConversionPlan(
+    uint32_t columnIdx, const app::ApplicationDataBuffer& dataBuf) {
+  if (conversionPlans_.size() != resultMeta_.size()) {
+    conversionPlans_.assign(resultMeta_.size(), ConversionPlan());
+  }
+
+  // the plan is resolved on the first fetch and when the column is bound
+  // to a buffer of another type
+  ConversionPlan& plan = conversionPlans_[columnIdx - 1];
+  if (!plan.IsResolvedFor(dataBuf.GetType())) {
+    plan.Resolve(resultMeta_[columnIdx - 1].GetScalarType(),
+                 dataBuf.GetType());
+  }
+  return plan;
+}
+
 SqlResult::Type DataQuery::GetColumn(uint16_t columnIdx,
                                      app::ApplicationDataBuffer& buffer) {
   LOG_DEBUG_MSG("GetColumn is called");
@@ -296,25 +718,163 @@ SqlResult::Type DataQuery::Close() {
 SqlResult::Type DataQuery::InternalClose() {
   LOG_DEBUG_MSG("InternalClose is called");
 
-  // stop all asynchronous threads
-  context_.isClosing_ = true;
-  while (!threads_.empty()) {
-    std::thread& itr = threads_.front();
-    // wait for the last thread to end. The join() should be done before the
-    // thread is popped from the queue. The thread could not be joined after
-    // it is popped from the queue, as it could cause crash.
-    if (itr.joinable()) {
-      itr.join();
+  // stop the worker threads, the pages in the queue are released here and
+  // the pages in flight are dropped by the workers
+  std::vector< Aws::String > queryIds;
+  {
+    std::lock_guard< std::mutex > locker(context_->mutex_);
+    context_->isClosing_ = true;
+    while (!context_->queue_.empty()) {
+      if (context_->budget_) {
+        context_->budget_->Release(context_->queue_.front().bytes);
+      }
+      context_->queue_.pop_front();
     }
-    threads_.pop();
+    queryIds.swap(context_->queryIds_);
   }
+  context_->cv_.notify_all();
+
+  if (!workers_.empty()) {
+    // a worker could be waiting for a page for up to the request timeout,
+    // so the queries are cancelled on the server and the workers are left
+    // to exit in the background
+    if (!queryIds.empty()) {
+      std::lock_guard< std::mutex > locker(context_->mutex_);
+      context_->runningWorkers_++;
+      workers_.emplace_back(CancelClosedQueries, queryClient_,
+                            std::move(queryIds), context_);
+    }
 
-  result_.reset();
+    std::shared_ptr< BackgroundWorkers > backgroundWorkers =
+        connection_.GetBackgroundWorkers();
+    if (backgroundWorkers) {
+      std::shared_ptr< DataQueryContext > context = context_;
+      backgroundWorkers->Add(workers_, [context]() {
+        std::lock_guard< std::mutex > locker(context->mutex_);
+        return context->runningWorkers_ == 0;
+      });
+    } else {
+      for (std::thread& worker : workers_) {
+        worker.join();
+      }
+    }
+    workers_.clear();
+
+    // the closed context is kept by the workers until they exit, a new
+    // context is used so the query could be executed again
+    std::atomic_store(
+        &context_,
+        std::make_shared< DataQueryContext >(
+            context_->prefetchPages_, context_->budget_, context_->maxRows_,
+            context_->maxRowPerPage_, context_->adaptivePageSize_));
+  } else {
+    context_->isClosing_ = false;
+  }
+  hasAsyncFetch = false;
+
+  ReleasePage();
+  queryId_.clear();
+  cachePages_.clear();
+  cacheBytes_ = 0;
+  isCaching_ = false;
+  pageStore_.reset();
+  position_ = 0;
+
+  return SqlResult::AI_SUCCESS;
+}
+
+void DataQuery::ReleasePage() {
   cursor_.reset();
+  cursorPage_ = nullptr;
+  result_.reset();
+  if (context_->budget_) {
+    context_->budget_->Release(resultBytes_);
+  }
+  resultBytes_ = 0;
+}
+
+SqlResult::Type DataQuery::SeekRow(int64_t rowNum) {
+  LOG_DEBUG_MSG("SeekRow is called with " << rowNum);
+
+  // the rows after the max rows are never returned
+  int64_t needed = maxRows_ > 0 ? std::min(rowNum, maxRows_) : rowNum;
+
+  // only the rows after the fetched pages are queried
+  while (pageStore_->GetRowCount() < needed && hasAsyncFetch) {
+    SqlResult::Type result = SwitchCursor();
+    if (result == SqlResult::AI_ERROR) {
+      if (!waitFailed_) {
+        diag.AddStatusRecord(SqlState::S24000_INVALID_CURSOR_STATE,
+                             "Invalid cursor state.",
+                             timestream::odbc::LogLevel::Type::WARNING_LEVEL);
+      }
+      return result;
+    }
+  }
 
+  if (rowNum < 1 || rowNum > needed || rowNum > pageStore_->GetRowCount()) {
+    return SqlResult::AI_NO_DATA;
+  }
+
+  std::shared_ptr< QueryResult > page;
+  std::shared_ptr< const ColumnarPage > columns;
+  size_t rowIdx = 0;
+  if (!pageStore_->Find(rowNum - 1, page, columns, rowIdx)) {
+    diag.AddStatusRecord(SqlState::SHY000_GENERAL_ERROR,
+                         "Failed to read the buffered result page.");
+    return SqlResult::AI_ERROR;
+  }
+
+  if (!cursor_ || cursorPage_ != page.get()) {
+    cursor_.reset(new TimestreamCursor(page, resultMeta_, columns));
+    cursorPage_ = page.get();
+  }
+  cursor_->SetPosition(rowIdx);
   return SqlResult::AI_SUCCESS;
 }
 
+SqlResult::Type DataQuery::MoveTo(int64_t rowNum) {
+  LOG_DEBUG_MSG("MoveTo is called with " << rowNum);
+
+  if (!pageStore_) {
+    return Query::MoveTo(rowNum);
+  }
+
+  if (rowNum < 1) {
+    position_ = 0;
+    return SqlResult::AI_NO_DATA;
+  }
+
+  SqlResult::Type result = SeekRow(rowNum);
+  if (result != SqlResult::AI_ERROR) {
+    position_ = rowNum - 1;
+  }
+  return result;
+}
+
+SqlResult::Type DataQuery::GetRowCount(int64_t& count) {
+  LOG_DEBUG_MSG("GetRowCount is called");
+
+  if (!pageStore_) {
+    return Query::GetRowCount(count);
+  }
+
+  SqlResult::Type result = SeekRow(std::numeric_limits< int64_t >::max());
+  if (result == SqlResult::AI_ERROR) {
+    return result;
+  }
+  count = pageStore_->GetRowCount();
+  if (maxRows_ > 0) {
+    count = std::min(count, maxRows_);
+  }
+
+  // fetching the pages moves cursor_ to the last page
+  if (position_ > 0 && position_ <= count) {
+    result = SeekRow(position_);
+  }
+  return result == SqlResult::AI_ERROR ? result : SqlResult::AI_SUCCESS;
+}
+
 bool DataQuery::DataAvailable() const {
   return cursor_ != nullptr;
 }
@@ -326,6 +886,11 @@ int64_t DataQuery::AffectedRows() const {
 }
 
 int64_t DataQuery::RowNumber() const {
+  if (pageStore_ && cursor_ && cursor_->HasData()) {
+    LOG_DEBUG_MSG("Row number returned: " << position_);
+    return position_;
+  }
+
   if (!cursor_ || !cursor_->HasData()) {
     diag.AddStatusRecord(SqlState::S01000_GENERAL_WARNING,
                          "Cursor does not point to any data.",
@@ -348,16 +913,69 @@ SqlResult::Type DataQuery::MakeRequestExecute() {
   LOG_DEBUG_MSG("MakeRequestExecute is called");
 
   LOG_INFO_MSG("sql query: " << sql_);
+  const config::Configuration& config = connection_.GetConfiguration();
+  parts_ = 1;
+  finishedParts_ = 0;
+  currentPart_ = 0;
+  ordered_ = config.IsFanOutOrdered();
+  context_->maxRows_ = maxRows_;
+  cachePages_.clear();
+  cacheBytes_ = 0;
+  isCaching_ = false;
+  position_ = 0;
+  rowCounter = 0;
+  waitFailed_ = false;
+  if (scrollable_) {
+    std::string spillDirectory = config.GetResultCachePath();
+    if (spillDirectory.empty()) {
+      spillDirectory = ResultCache::GetDefaultDirectory();
+    }
+    pageStore_.reset(new ResultPageStore(
+        static_cast< size_t >(config.GetScrollBufferMB()) * 1024 * 1024,
+        spillDirectory));
+  }
+
+  std::shared_ptr< ResultCache > resultCache = connection_.GetResultCache();
+  if (resultCache) {
+    std::vector< QueryResult > pages;
+    if (resultCache->Get(sql_, pages)) {
+      return MakeRequestExecuteCached(pages);
+    }
+    // a result cut at the max rows is not the result of the query
+    isCaching_ = maxRows_ == 0;
+  }
+
+  std::vector< std::string > subQueries;
+  if (TimeRangeSplitter::Split(sql_, config.GetQueryFanOut(), subQueries)) {
+    return MakeRequestExecuteFanOut(subQueries);
+  }
+
+  if (queryTimeout_ > 0) {
+    // the first page is fetched by a worker so the wait for it is bounded
+    return MakeRequestExecuteFanOut(std::vector< std::string >(1, sql_));
+  }
+
+  request_ = QueryRequest();
   request_.SetQueryString(sql_);
   if (connection_.GetConfiguration().IsMaxRowPerPageSet()) {
     LOG_DEBUG_MSG("MaxRowPerPage is set to "
                   << connection_.GetConfiguration().GetMaxRowPerPage());
     request_.SetMaxRows(connection_.GetConfiguration().GetMaxRowPerPage());
   }
+  if (context_->adaptivePageSize_) {
+    // a small first page returns the first rows quickly
+    request_.SetMaxRows(PageSizer::firstPageRows);
+  }
+  if (maxRows_ > 0) {
+    LimitPageRows(request_, maxRows_, context_->maxRowPerPage_);
+  }
 
+  std::chrono::duration< double > latency(0);
   do {
+    auto fetchStart = std::chrono::steady_clock::now();
     Aws::TimestreamQuery::Model::QueryOutcome outcome =
         connection_.GetQueryClient()->Query(request_);
+    latency = std::chrono::steady_clock::now() - fetchStart;
 
     if (!outcome.IsSuccess()) {
       auto error = outcome.GetError();
@@ -367,16 +985,24 @@ SqlResult::Type DataQuery::MakeRequestExecute() {
       diag.AddStatusRecord(
           SqlState::SHY000_GENERAL_ERROR,
           "AWS API Failure: Failed to execute query \"" + sql_ + "\"");
+      InvalidateMeta();
       InternalClose();
       return SqlResult::AI_ERROR;
     }
 
     // outcome is successful, update result_
-    result_ = std::make_shared< QueryResult >(outcome.GetResult());
+    ReleasePage();
+    result_ = std::make_shared< QueryResult >(outcome.GetResultWithOwnership());
+    queryId_ = result_->GetQueryId();
+    resultBytes_ = ResultBufferBudget::EstimateSize(*result_);
+    if (context_->budget_) {
+      context_->budget_->Acquire(resultBytes_);
+    }
     if (result_->GetRows().empty()) {
       if (result_->GetNextToken().empty()) {
         // result is empty
         LOG_DEBUG_MSG("QueryResult is empty, returning no data");
+        CachePage(*result_, true);
         return SqlResult::AI_NO_DATA;
       }
       request_.SetNextToken(result_->GetNextToken());
@@ -386,15 +1012,32 @@ SqlResult::Type DataQuery::MakeRequestExecute() {
     }
   } while (true);
 
-  cursor_.reset(new TimestreamCursor(result_->GetRows(), resultMeta_));
+  bool isLast = result_->GetNextToken().empty();
+  int64_t fetchedRows = static_cast< int64_t >(result_->GetRows().size());
+  if (!isLast && maxRows_ > 0 && fetchedRows >= maxRows_) {
+    LOG_DEBUG_MSG("Max rows are fetched in the first page");
+    CancelRemainingPages(queryClient_, queryId_);
+    isLast = true;
+  }
 
-  if (!result_->GetNextToken().empty()) {
+  CachePage(*result_, isLast);
+  pageStartTime_ = std::chrono::steady_clock::now();
+  if (!isLast) {
     LOG_DEBUG_MSG(
-        "Next token is not empty, starting async thread to fetch next page");
+        "Next token is not empty, starting worker thread to fetch next pages");
     request_.SetNextToken(result_->GetNextToken());
-    std::thread next(AsyncFetchOnePage, queryClient_, std::ref(request_),
-                     std::ref(context_));
-    addThreads(next);
+    if (context_->adaptivePageSize_) {
+      request_.SetMaxRows(PageSizer::NextPageRows(
+          request_.GetMaxRows(), result_->GetRows().size(), resultBytes_,
+          latency.count(), 0));
+    }
+    {
+      std::lock_guard< std::mutex > locker(context_->mutex_);
+      context_->queryIds_.push_back(queryId_);
+      context_->runningWorkers_++;
+    }
+    workers_.emplace_back(AsyncFetchPages, queryClient_, request_, 0,
+                          fetchedRows, context_);
     hasAsyncFetch = true;
   }
 
@@ -402,6 +1045,135 @@ SqlResult::Type DataQuery::MakeRequestExecute() {
   return retval;
 }
 
+SqlResult::Type DataQuery::MakeRequestExecuteFanOut(
+    const std::vector< std::string >& subQueries) {
+  if (subQueries.size() > 1) {
+    LOG_INFO_MSG("sql query is split into " << subQueries.size()
+                                            << " time ranges");
+  }
+
+  const config::Configuration& config = connection_.GetConfiguration();
+  parts_ = subQueries.size();
+  {
+    std::lock_guard< std::mutex > locker(context_->mutex_);
+    context_->runningWorkers_ += parts_;
+  }
+  for (size_t i = 0; i < parts_; i++) {
+    LOG_DEBUG_MSG("time range query " << i << ": " << subQueries[i]);
+    QueryRequest request;
+    request.SetQueryString(subQueries[i]);
+    if (config.IsMaxRowPerPageSet()) {
+      request.SetMaxRows(config.GetMaxRowPerPage());
+    } else if (context_->adaptivePageSize_) {
+      request.SetMaxRows(PageSizer::firstPageRows);
+    }
+    if (maxRows_ > 0) {
+      LimitPageRows(request, maxRows_, context_->maxRowPerPage_);
+    }
+    workers_.emplace_back(AsyncFetchPages, queryClient_, std::move(request), i,
+                          int64_t(0), context_);
+  }
+  hasAsyncFetch = true;
+
+  SqlResult::Type retval = SwitchCursor();
+  if (retval == SqlResult::AI_ERROR) {
+    if (!waitFailed_) {
+      diag.AddStatusRecord(
+          SqlState::SHY000_GENERAL_ERROR,
+          "AWS API Failure: Failed to execute query \"" + sql_ + "\"");
+      InvalidateMeta();
+    }
+    InternalClose();
+    return SqlResult::AI_ERROR;
+  }
+
+  // Always refresh the metadata from the query result, metadata read by
+  // GetMeta() could be out of date if it is from the metadata cache.
+  ReadColumnMetadataVector(result_->GetColumnInfo());
+
+  LOG_DEBUG_MSG("retval is " << retval);
+  return retval;
+}
+
+SqlResult::Type DataQuery::MakeRequestExecuteCached(
+    std::vector< QueryResult >& pages) {
+  LOG_INFO_MSG("sql query result is read from the result cache, "
+               << pages.size() << " pages");
+
+  // the cached result is complete, so all pages are queued at once
+  {
+    std::lock_guard< std::mutex > locker(context_->mutex_);
+    for (size_t i = 1; i < pages.size(); i++) {
+      FetchedPage page;
+      page.outcome =
+          Aws::TimestreamQuery::Model::QueryOutcome(std::move(pages[i]));
+      page.isLast = page.outcome.GetResult().GetNextToken().empty();
+      page.columns =
+          std::make_shared< ColumnarPage >(page.outcome.GetResult());
+      page.bytes = ResultBufferBudget::EstimateSize(page.outcome.GetResult())
+                   + page.columns->GetSize();
+      if (context_->budget_) {
+        context_->budget_->Acquire(page.bytes);
+      }
+      context_->queue_.push_back(std::move(page));
+    }
+  }
+
+  result_ = std::make_shared< QueryResult >(std::move(pages.front()));
+  queryId_ = result_->GetQueryId();
+  resultBytes_ = ResultBufferBudget::EstimateSize(*result_);
+  if (context_->budget_) {
+    context_->budget_->Acquire(resultBytes_);
+  }
+  hasAsyncFetch = !result_->GetNextToken().empty();
+
+  SqlResult::Type retval = MakeRequestFetch();
+  return retval;
+}
+
+void DataQuery::CachePage(const QueryResult& page, bool isLast) {
+  if (!isCaching_) {
+    return;
+  }
+
+  // the replay starts the cursor at the first cached page, so the empty
+  // pages skipped by the fetch are not cached either
+  if (page.GetRows().empty() && !isLast) {
+    return;
+  }
+
+  cachePages_.push_back(ResultCache::SerializePage(page, isLast));
+  cacheBytes_ += cachePages_.back().size();
+  if (cacheBytes_ > MAX_CACHED_RESULT_BYTES) {
+    LOG_DEBUG_MSG("Result is too large to be cached");
+    isCaching_ = false;
+    cachePages_.clear();
+    return;
+  }
+
+  if (isLast) {
+    std::shared_ptr< ResultCache > resultCache = connection_.GetResultCache();
+    if (resultCache) {
+      resultCache->Put(sql_, cachePages_);
+    }
+    isCaching_ = false;
+    cachePages_.clear();
+    cacheBytes_ = 0;
+  }
+}
+
+void DataQuery::InvalidateMeta() {
+  // the table of the query could be dropped or altered, the metadata is
+  // read from Timestream again when the query is described
+  std::shared_ptr< meta::ColumnMetaCache > metaCache =
+      connection_.GetMetaCache();
+  if (metaCache) {
+    LOG_DEBUG_MSG("Result set metadata is removed from cache");
+    metaCache->Invalidate(sql_);
+  }
+  resultMetaAvailable_ = false;
+}
+
 SqlResult::Type DataQuery::MakeRequestFetch() {
   LOG_DEBUG_MSG("MakeRequestFetch is called");
 
@@ -411,11 +1183,9 @@ SqlResult::Type DataQuery::MakeRequestFetch() {
     return SqlResult::AI_ERROR;
   }
 
-  const Aws::Vector< ColumnInfo >& columnInfo = result_->GetColumnInfo();
-
-  if (!resultMetaAvailable_) {
-    ReadColumnMetadataVector(columnInfo);
-  }
+  // Always refresh the metadata from the query result, metadata read by
+  // GetMeta() could be out of date if it is from the metadata cache.
+  ReadColumnMetadataVector(result_->GetColumnInfo());
 
   SqlResult::Type retval = SqlResult::AI_SUCCESS;
 
@@ -423,7 +1193,11 @@ SqlResult::Type DataQuery::MakeRequestFetch() {
     retval = SqlResult::AI_NO_DATA;
   } else {
     LOG_DEBUG_MSG("Result has " << result_->GetRows().size() << " rows");
-    cursor_.reset(new TimestreamCursor(result_->GetRows(), resultMeta_));
+    cursor_.reset(new TimestreamCursor(result_, resultMeta_));
+    cursorPage_ = result_.get();
+    if (pageStore_) {
+      pageStore_->Add(result_, nullptr);
+    }
   }
 
   LOG_DEBUG_MSG("retval is " << retval);
@@ -434,8 +1208,50 @@ SqlResult::Type DataQuery::MakeRequestFetch() {
 SqlResult::Type DataQuery::MakeRequestResultsetMeta() {
   LOG_DEBUG_MSG("MakeRequestResultsetMeta is called");
 
+  // PrepareQuery only validates the query, the result set metadata is
+  // returned without running the query.
+  Aws::TimestreamQuery::Model::PrepareQueryRequest prepareRequest;
+  prepareRequest.SetQueryString(sql_);
+  prepareRequest.SetValidateOnly(true);
+
+  Aws::TimestreamQuery::Model::PrepareQueryOutcome prepareOutcome =
+      connection_.GetQueryClient()->PrepareQuery(prepareRequest);
+
+  if (prepareOutcome.IsSuccess()) {
+    const Aws::Vector< SelectColumn >& columns =
+        prepareOutcome.GetResult().GetColumns();
+
+    Aws::Vector< ColumnInfo > columnInfo;
+    columnInfo.reserve(columns.size());
+    for (const SelectColumn& column : columns) {
+      columnInfo.emplace_back();
+      columnInfo.back().SetName(column.GetName());
+      columnInfo.back().SetType(column.GetType());
+    }
+
+    ReadColumnMetadataVector(columnInfo);
+
+    return SqlResult::AI_SUCCESS;
+  }
+
+  auto const& prepareError = prepareOutcome.GetError();
+  if (!IsPrepareQueryUnavailable(prepareError)) {
+    diag.AddStatusRecord(SqlState::SHY000_GENERAL_ERROR,
+                         "AWS API ERROR: " + prepareError.GetExceptionName()
+                             + ": " + prepareError.GetMessage()
+                             + " for query " + sql_);
+    return SqlResult::AI_ERROR;
+  }
+
+  LOG_WARNING_MSG("PrepareQuery is unavailable: "
+                  << prepareError.GetExceptionName() << ": "
+                  << prepareError.GetMessage() << " for query " << sql_
+                  << ", falling back to Query with one row per page");
+
   QueryRequest request;
   request.SetQueryString(sql_);
+  // only the column metadata is needed, limit the rows returned.
+  request.SetMaxRows(1);
 
   Aws::TimestreamQuery::Model::QueryOutcome outcome =
       connection_.GetQueryClient()->Query(request);
@@ -451,11 +1267,16 @@ SqlResult::Type DataQuery::MakeRequestResultsetMeta() {
     return SqlResult::AI_ERROR;
   }
   // outcome is successful
-  QueryResult result = outcome.GetResult();
-  const Aws::Vector< ColumnInfo >& columnInfo = result.GetColumnInfo();
+  const Aws::Vector< ColumnInfo >& columnInfo =
+      outcome.GetResult().GetColumnInfo();
 
   ReadColumnMetadataVector(columnInfo);
 
+  // the rows are not needed, the query is not kept running on the server
+  if (!outcome.GetResult().GetNextToken().empty()) {
+    CancelRemainingPages(queryClient_, outcome.GetResult().GetQueryId());
+  }
+
   return SqlResult::AI_SUCCESS;
 }
 
@@ -465,6 +1286,7 @@ void DataQuery::ReadColumnMetadataVector(
 
   using timestream::odbc::meta::ColumnMeta;
   resultMeta_.clear();
+  conversionPlans_.clear();
 
   if (tsVector.empty()) {
     LOG_ERROR_MSG("Exit due to column vector is empty");
@@ -472,11 +1294,17 @@ void DataQuery::ReadColumnMetadataVector(
     return;
   }
 
-  for (ColumnInfo tsMetadata : tsVector) {
+  for (const ColumnInfo& tsMetadata : tsVector) {
     resultMeta_.emplace_back(ColumnMeta());
     resultMeta_.back().ReadMetadata(tsMetadata);
   }
   resultMetaAvailable_ = true;
+
+  std::shared_ptr< meta::ColumnMetaCache > metaCache =
+      connection_.GetMetaCache();
+  if (metaCache) {
+    metaCache->Put(sql_, resultMeta_);
+  }
 }
 
 SqlResult::Type DataQuery::ProcessConversionResult(
@@ -548,6 +1376,7 @@ void DataQuery::SetResultsetMeta(const meta::ColumnMetaVector& value) {
   // assign `resultMeta_` with contents of `value`
   resultMeta_.assign(value.begin(), value.end());
   resultMetaAvailable_ = true;
+  conversionPlans_.clear();
 
   // the nested forloops are for logging purposes
   for (size_t i = 0; i < resultMeta_.size(); ++i) {
@@ -91,7 +91,7 @@ const meta::ColumnMetaVector* ForeignKeysQuery::GetMeta() {
 }
 
 SqlResult::Type ForeignKeysQuery::FetchNextRow(
-    app::ColumnBindingMap& columnBindings) {
+    app::ColumnBindingTable& columnBindings) {
   diag.AddStatusRecord(SqlState::S01000_GENERAL_WARNING,
                        "SQLForeignKeys is not supported. No data is returned.",
                        LogLevel::Type::WARNING_LEVEL);
@@ -0,0 +1,53 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#include "timestream/odbc/query/page_sizer.h"
+
+#include <algorithm>
+
+namespace timestream {
+namespace odbc {
+namespace query {
+const int32_t PageSizer::firstPageRows = 100;
+const int32_t PageSizer::maxPageRows = 1000;
+const int32_t PageSizer::growthFactor = 4;
+const size_t PageSizer::targetPageBytes = 4 * 1024 * 1024;
+
+int32_t PageSizer::NextPageRows(int32_t pageRows, size_t rows, size_t bytes,
+                                double latency, double drainRate) {
+  int64_t next = std::max(pageRows, 1);
+
+  // a consumer which takes longer to drain a page than it takes to fetch
+  // one is kept busy by the prefetched pages, larger pages do not help it
+  bool isConsumerSlower =
+      drainRate > 0 && rows > 0 && rows / drainRate >= latency;
+  if (!isConsumerSlower) {
+    next *= growthFactor;
+  }
+
+  // wide rows make a page large in memory before it hits the row limit
+  if (rows > 0 && bytes > 0) {
+    int64_t widthLimit = static_cast< int64_t >(
+        static_cast< double >(targetPageBytes) * rows / bytes);
+    next = std::min(next, std::max< int64_t >(widthLimit, 1));
+  }
+
+  return static_cast< int32_t >(
+      std::min< int64_t >(next, static_cast< int64_t >(maxPageRows)));
+}
+}  // namespace query
+}  // namespace odbc
+}  // namespace timestream
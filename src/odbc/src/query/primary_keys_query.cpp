@@ -74,7 +74,7 @@ const meta::ColumnMetaVector* PrimaryKeysQuery::GetMeta() {
 }
 
 SqlResult::Type PrimaryKeysQuery::FetchNextRow(
-    app::ColumnBindingMap& columnBindings) {
+    app::ColumnBindingTable& columnBindings) {
   diag.AddStatusRecord(SqlState::S01000_GENERAL_WARNING,
                        "SQLPrimaryKeys is not supported. No data is returned.",
                        LogLevel::Type::WARNING_LEVEL);
@@ -101,7 +101,7 @@ const meta::ColumnMetaVector* ProcedureColumnsQuery::GetMeta() {
 }
 
 SqlResult::Type ProcedureColumnsQuery::FetchNextRow(
-    app::ColumnBindingMap& columnBindings) {
+    app::ColumnBindingTable& columnBindings) {
   diag.AddStatusRecord(
       SqlState::S01000_GENERAL_WARNING,
       "SQLProcedureColumns is not supported. No data is returned.",
@@ -82,7 +82,7 @@ const meta::ColumnMetaVector* ProceduresQuery::GetMeta() {
 }
 
 SqlResult::Type ProceduresQuery::FetchNextRow(
-    app::ColumnBindingMap& columnBindings) {
+    app::ColumnBindingTable& columnBindings) {
   diag.AddStatusRecord(SqlState::S01000_GENERAL_WARNING,
                        "SQLProcedures is not supported. No data is returned.",
                        LogLevel::Type::WARNING_LEVEL);
@@ -76,7 +76,7 @@ const meta::ColumnMetaVector* SpecialColumnsQuery::GetMeta() {
   return &columnsMeta;
 }
 
-SqlResult::Type SpecialColumnsQuery::FetchNextRow(app::ColumnBindingMap&) {
+SqlResult::Type SpecialColumnsQuery::FetchNextRow(app::ColumnBindingTable&) {
   diag.AddStatusRecord(
       SqlState::S01000_GENERAL_WARNING,
       "SQLSpecialColumns is not supported. No data is returned.",
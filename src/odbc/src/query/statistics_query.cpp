@@ -105,7 +105,7 @@ const meta::ColumnMetaVector* StatisticsQuery::GetMeta() {
 }
 
 SqlResult::Type StatisticsQuery::FetchNextRow(
-    app::ColumnBindingMap& columnBindings) {
+    app::ColumnBindingTable& columnBindings) {
   diag.AddStatusRecord(SqlState::S01000_GENERAL_WARNING,
                        "SQLStatistics is not supported. No data is returned.",
                        LogLevel::Type::WARNING_LEVEL);
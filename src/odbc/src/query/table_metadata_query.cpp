@@ -212,7 +212,7 @@ const meta::ColumnMetaVector* TableMetadataQuery::GetMeta() {
 }
 
 SqlResult::Type TableMetadataQuery::FetchNextRow(
-    app::ColumnBindingMap& columnBindings) {
+    app::ColumnBindingTable& columnBindings) {
   LOG_DEBUG_MSG("FetchNextRow is called");
   if (!executed) {
     diag.AddStatusRecord(SqlState::SHY010_SEQUENCE_ERROR,
@@ -232,10 +232,8 @@ SqlResult::Type TableMetadataQuery::FetchNextRow(
     return SqlResult::AI_NO_DATA;
   }
 
-  app::ColumnBindingMap::iterator it;
-
-  for (it = columnBindings.begin(); it != columnBindings.end(); ++it)
-    GetColumn(it->first, it->second);
+  for (uint16_t columnIdx : columnBindings.GetBoundColumns())
+    GetColumn(columnIdx, columnBindings.GetBuffer(columnIdx));
 
   return SqlResult::AI_SUCCESS;
 }
@@ -539,7 +537,7 @@ SqlResult::Type TableMetadataQuery::getMatchedDatabases(
     return result;
   }
 
-  app::ColumnBindingMap columnBindings;
+  app::ColumnBindingTable columnBindings;
   SqlLen buflen = STRING_BUFFER_SIZE;
   // According to Timestream, table name could only contain
   // letters, digits, dashes, periods or underscores. It could
@@ -547,7 +545,7 @@ SqlResult::Type TableMetadataQuery::getMatchedDatabases(
   char databaseName[STRING_BUFFER_SIZE]{};
   ApplicationDataBuffer buf(OdbcNativeType::Type::AI_CHAR, &databaseName,
                             buflen, nullptr);
-  columnBindings[1] = buf;
+  columnBindings.Bind(1, buf);
 
   while (dataQuery_->FetchNextRow(columnBindings) == SqlResult::AI_SUCCESS) {
     databaseNames.emplace_back(std::string(databaseName));
@@ -580,7 +578,7 @@ SqlResult::Type TableMetadataQuery::getMatchedTables(
     return result;
   }
 
-  app::ColumnBindingMap columnBindings;
+  app::ColumnBindingTable columnBindings;
   SqlLen buflen = STRING_BUFFER_SIZE;
   // According to Timestream, table name could only contain
   // letters, digits, dashes, periods or underscores. It could
@@ -588,7 +586,7 @@ SqlResult::Type TableMetadataQuery::getMatchedTables(
   char tableName[STRING_BUFFER_SIZE]{};
   ApplicationDataBuffer buf(OdbcNativeType::Type::AI_CHAR, &tableName, buflen,
                             nullptr);
-  columnBindings[1] = buf;
+  columnBindings.Bind(1, buf);
 
   while (dataQuery_->FetchNextRow(columnBindings) == SqlResult::AI_SUCCESS) {
     tableNames.emplace_back(std::string(tableName));
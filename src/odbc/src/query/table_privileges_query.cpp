@@ -76,7 +76,7 @@ const meta::ColumnMetaVector* TablePrivilegesQuery::GetMeta() {
 }
 
 SqlResult::Type TablePrivilegesQuery::FetchNextRow(
-    app::ColumnBindingMap& columnBindings) {
+    app::ColumnBindingTable& columnBindings) {
   diag.AddStatusRecord(
       SqlState::S01000_GENERAL_WARNING,
       "SQLTablePrivileges is not supported. No data is returned.",
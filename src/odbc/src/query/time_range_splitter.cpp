@@ -0,0 +1,298 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#include "timestream/odbc/query/time_range_splitter.h"
+
+#include <cctype>
+#include <set>
+
+#include "timestream/odbc/log.h"
+#include "timestream/odbc/temporal_parser.h"
+
+namespace {
+/** Keywords of the queries which could not be split. */
+const std::set< std::string > UNSUPPORTED_KEYWORDS = {
+    "group", "order",     "limit", "offset", "distinct", "having", "union",
+    "except", "intersect", "join", "over",   "with",     "or",     "unnest"};
+
+/** Aggregate functions. */
+const std::set< std::string > AGGREGATE_FUNCTIONS = {
+    "count",
+    "count_if",
+    "sum",
+    "avg",
+    "min",
+    "max",
+    "min_by",
+    "max_by",
+    "arbitrary",
+    "array_agg",
+    "approx_distinct",
+    "approx_percentile",
+    "bool_and",
+    "bool_or",
+    "every",
+    "geometric_mean",
+    "histogram",
+    "map_agg",
+    "stddev",
+    "stddev_pop",
+    "stddev_samp",
+    "variance",
+    "var_pop",
+    "var_samp",
+    "interpolate_linear",
+    "interpolate_fill",
+    "interpolate_loci",
+    "interpolate_spline_cubic",
+    "create_time_series"};
+
+bool IsWordChar(char ch) {
+  return std::isalnum(static_cast< unsigned char >(ch)) || ch == '_';
+}
+
+std::string MakeRange(int64_t begin, int64_t end, bool inclusive) {
+  return "(time >= from_nanoseconds(" + std::to_string(begin)
+         + ") AND time " + (inclusive ? "<=" : "<") + " from_nanoseconds("
+         + std::to_string(end) + "))";
+}
+}  // namespace
+
+namespace timestream {
+namespace odbc {
+namespace query {
+bool TimeRangeSplitter::Split(const std::string& sql, int32_t parts,
+                              std::vector< std::string >& subQueries) {
+  subQueries.clear();
+  if (parts < 2) {
+    return false;
+  }
+
+  std::vector< Token > tokens;
+  if (!Tokenize(sql, tokens)) {
+    LOG_DEBUG_MSG("Query is not split, failed to tokenize");
+    return false;
+  }
+
+  // depth of each token in parentheses
+  std::vector< int > depths(tokens.size());
+  int depth = 0;
+  int selects = 0;
+  size_t where = std::string::npos;
+  for (size_t i = 0; i < tokens.size(); i++) {
+    const Token& token = tokens[i];
+    if (IsWord(token, ")")) {
+      depth--;
+    }
+    depths[i] = depth;
+    if (IsWord(token, "(")) {
+      depth++;
+    }
+    if (token.isLiteral) {
+      continue;
+    }
+
+    if (token.text == "select") {
+      selects++;
+    }
+    if (token.text == "where" && depth == 0) {
+      where = i;
+    }
+
+    bool isAggregate = i + 1 < tokens.size() && tokens[i + 1].text == "("
+                       && AGGREGATE_FUNCTIONS.count(token.text) > 0;
+    if (UNSUPPORTED_KEYWORDS.count(token.text) > 0 || isAggregate) {
+      LOG_DEBUG_MSG("Query is not split due to " << token.text);
+      return false;
+    }
+  }
+
+  if (selects != 1 || depth != 0) {
+    LOG_DEBUG_MSG("Query is not split, it is not a single select");
+    return false;
+  }
+
+  if (where == std::string::npos) {
+    LOG_DEBUG_MSG("Query is not split, no where clause is found");
+    return false;
+  }
+
+  // the where clause lasts to the end of the query, a negated or
+  // conditional predicate could not be restricted to a sub-range
+  for (size_t i = where + 1; i < tokens.size(); i++) {
+    if (IsWord(tokens[i], "not") || IsWord(tokens[i], "case")) {
+      LOG_DEBUG_MSG("Query is not split due to " << tokens[i].text);
+      return false;
+    }
+  }
+
+  // find "{WHERE | AND} time BETWEEN <literal> AND <literal>" which is a
+  // top level conjunct of the where clause
+  size_t rangeBegin = std::string::npos;
+  size_t rangeEnd = std::string::npos;
+  int64_t begin = 0;
+  int64_t end = 0;
+  for (size_t i = where + 1; i + 1 < tokens.size(); i++) {
+    if (!IsWord(tokens[i], "time") || !IsWord(tokens[i + 1], "between")
+        || depths[i] != 0
+        || (!IsWord(tokens[i - 1], "where") && !IsWord(tokens[i - 1], "and"))) {
+      continue;
+    }
+
+    size_t pos = i + 2;
+    if (rangeBegin != std::string::npos || !ReadTimestamp(tokens, pos, begin)
+        || pos >= tokens.size() || !IsWord(tokens[pos], "and")
+        || !ReadTimestamp(tokens, ++pos, end)) {
+      LOG_DEBUG_MSG("Query is not split, time range is not supported");
+      return false;
+    }
+
+    // the range must not be compared with something else
+    if (pos < tokens.size() && !IsWord(tokens[pos], "and")
+        && !IsWord(tokens[pos], ";")) {
+      LOG_DEBUG_MSG("Query is not split, time range is not supported");
+      return false;
+    }
+
+    rangeBegin = tokens[i].begin;
+    rangeEnd = tokens[pos - 1].end;
+  }
+
+  if (rangeBegin == std::string::npos) {
+    LOG_DEBUG_MSG("Query is not split, no time range is found");
+    return false;
+  }
+
+  int64_t step = (end - begin) / parts;
+  if (end <= begin || step == 0) {
+    LOG_DEBUG_MSG("Query is not split, time range is too small");
+    return false;
+  }
+
+  std::string prefix = sql.substr(0, rangeBegin);
+  std::string suffix = sql.substr(rangeEnd);
+  for (int32_t i = 0; i < parts; i++) {
+    bool isLast = i == parts - 1;
+    int64_t partEnd = isLast ? end : begin + (i + 1) * step;
+    subQueries.push_back(prefix + MakeRange(begin + i * step, partEnd, isLast)
+                         + suffix);
+  }
+
+  LOG_DEBUG_MSG("Query is split into " << parts << " time ranges");
+  return true;
+}
+
+bool TimeRangeSplitter::ParseTimestamp(const std::string& value,
+                                       int64_t& nanos) {
+  SQL_TIMESTAMP_STRUCT timestamp = SQL_TIMESTAMP_STRUCT();
+  if (!TemporalParser::ParseTimestamp(value.data(), value.size(),
+                                      timestamp)) {
+    // a date is the start of the day
+    SQL_DATE_STRUCT date;
+    if (!TemporalParser::ParseDate(value.data(), value.size(), date)) {
+      return false;
+    }
+    timestamp.year = date.year;
+    timestamp.month = date.month;
+    timestamp.day = date.day;
+  }
+
+  nanos = TemporalParser::ToEpochSeconds(timestamp) * 1000000000
+          + timestamp.fraction;
+  return true;
+}
+
+bool TimeRangeSplitter::Tokenize(const std::string& sql,
+                                 std::vector< Token >& tokens) {
+  size_t i = 0;
+  while (i < sql.size()) {
+    char ch = sql[i];
+    if (std::isspace(static_cast< unsigned char >(ch))) {
+      i++;
+    } else if (ch == '-' && i + 1 < sql.size() && sql[i + 1] == '-') {
+      i = sql.find('\n', i);
+      if (i == std::string::npos) {
+        i = sql.size();
+      }
+    } else if (ch == '/' && i + 1 < sql.size() && sql[i + 1] == '*') {
+      i = sql.find("*/", i + 2);
+      if (i == std::string::npos) {
+        return false;
+      }
+      i += 2;
+    } else if (ch == '\'' || ch == '"') {
+      // quoted literal or identifier, a doubled quote is an escaped quote
+      Token token{"", i, 0, ch == '\''};
+      size_t j = i + 1;
+      while (true) {
+        if (j >= sql.size()) {
+          return false;
+        }
+        if (sql[j] == ch) {
+          if (j + 1 < sql.size() && sql[j + 1] == ch) {
+            token.text.push_back(ch);
+            j += 2;
+            continue;
+          }
+          break;
+        }
+        token.text.push_back(sql[j++]);
+      }
+      if (!token.isLiteral) {
+        // keep the quotes so a quoted identifier never matches a keyword
+        token.text = '"' + token.text + '"';
+      }
+      token.end = j + 1;
+      tokens.push_back(token);
+      i = j + 1;
+    } else if (IsWordChar(ch)) {
+      Token token{"", i, 0, false};
+      for (; i < sql.size() && IsWordChar(sql[i]); i++) {
+        token.text.push_back(static_cast< char >(
+            std::tolower(static_cast< unsigned char >(sql[i]))));
+      }
+      token.end = i;
+      tokens.push_back(token);
+    } else {
+      tokens.push_back(Token{std::string(1, ch), i, i + 1, false});
+      i++;
+    }
+  }
+
+  return true;
+}
+
+bool TimeRangeSplitter::IsWord(const Token& token, const std::string& word) {
+  return !token.isLiteral && token.text == word;
+}
+
+bool TimeRangeSplitter::ReadTimestamp(const std::vector< Token >& tokens,
+                                      size_t& pos, int64_t& nanos) {
+  if (pos < tokens.size() && IsWord(tokens[pos], "timestamp")) {
+    pos++;
+  }
+
+  if (pos >= tokens.size() || !tokens[pos].isLiteral
+      || !ParseTimestamp(tokens[pos].text, nanos)) {
+    return false;
+  }
+
+  pos++;
+  return true;
+}
+}  // namespace query
+}  // namespace odbc
+}  // namespace timestream
@@ -219,9 +219,9 @@ const meta::ColumnMetaVector* TypeInfoQuery::GetMeta() {
 }
 
 SqlResult::Type TypeInfoQuery::FetchNextRow(
-    app::ColumnBindingMap& columnBindings) {
+    app::ColumnBindingTable& columnBindings) {
   LOG_DEBUG_MSG("FetchNextRow is called with columnBindings size "
-                << columnBindings.size());
+                << columnBindings.GetSize());
   if (!executed) {
     diag.AddStatusRecord(SqlState::SHY010_SEQUENCE_ERROR,
                          "Query was not executed.");
@@ -238,10 +238,8 @@ SqlResult::Type TypeInfoQuery::FetchNextRow(
     return SqlResult::AI_NO_DATA;
   }
 
-  app::ColumnBindingMap::iterator it;
-
-  for (it = columnBindings.begin(); it != columnBindings.end(); ++it)
-    GetColumn(it->first, it->second);
+  for (uint16_t columnIdx : columnBindings.GetBoundColumns())
+    GetColumn(columnIdx, columnBindings.GetBuffer(columnIdx));
 
   return SqlResult::AI_SUCCESS;
 }
@@ -0,0 +1,88 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#include "timestream/odbc/result_buffer_budget.h"
+
+#include <aws/timestream-query/model/ColumnInfo.h>
+#include <aws/timestream-query/model/Row.h>
+#include <aws/timestream-query/model/TimeSeriesDataPoint.h>
+
+using Aws::TimestreamQuery::Model::ColumnInfo;
+using Aws::TimestreamQuery::Model::Datum;
+using Aws::TimestreamQuery::Model::QueryResult;
+using Aws::TimestreamQuery::Model::Row;
+using Aws::TimestreamQuery::Model::TimeSeriesDataPoint;
+
+namespace timestream {
+namespace odbc {
+ResultBufferBudget::ResultBufferBudget(size_t maxBytes)
+    : maxBytes_(maxBytes), used_(0) {
+  // No-op.
+}
+
+bool ResultBufferBudget::HasRoom() const {
+  return maxBytes_ == 0 || used_.load() < maxBytes_;
+}
+
+void ResultBufferBudget::Acquire(size_t bytes) {
+  used_ += bytes;
+}
+
+void ResultBufferBudget::Release(size_t bytes) {
+  used_ -= bytes;
+}
+
+size_t ResultBufferBudget::EstimateSize(const QueryResult& result) {
+  size_t size = sizeof(QueryResult);
+  size += result.GetColumnInfo().capacity() * sizeof(ColumnInfo);
+  size += result.GetRows().capacity() * sizeof(Row);
+  for (const Row& row : result.GetRows()) {
+    for (const Datum& datum : row.GetData()) {
+      size += EstimateSize(datum);
+    }
+  }
+
+  return size;
+}
+
+size_t ResultBufferBudget::EstimateSize(const Datum& datum) {
+  size_t size = sizeof(Datum) + datum.GetScalarValue().capacity();
+
+  if (datum.TimeSeriesValueHasBeenSet()) {
+    for (const TimeSeriesDataPoint& point : datum.GetTimeSeriesValue()) {
+      size += sizeof(TimeSeriesDataPoint) + point.GetTime().capacity();
+      if (point.ValueHasBeenSet()) {
+        size += EstimateSize(point.GetValue());
+      }
+    }
+  }
+
+  if (datum.ArrayValueHasBeenSet()) {
+    for (const Datum& value : datum.GetArrayValue()) {
+      size += EstimateSize(value);
+    }
+  }
+
+  if (datum.RowValueHasBeenSet()) {
+    for (const Datum& value : datum.GetRowValue().GetData()) {
+      size += EstimateSize(value);
+    }
+  }
+
+  return size;
+}
+}  // namespace odbc
+}  // namespace timestream
@@ -0,0 +1,483 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#include "timestream/odbc/result_cache.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#include <direct.h>
+#include <process.h>
+#else
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <atomic>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <aws/core/AmazonWebServiceResult.h>
+#include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/timestream-query/model/ColumnInfo.h>
+#include <aws/timestream-query/model/Row.h>
+
+#include "timestream/odbc/config/configuration.h"
+#include "timestream/odbc/log.h"
+#include "timestream/odbc/meta/column_meta_cache.h"
+
+using Aws::TimestreamQuery::Model::ColumnInfo;
+using Aws::TimestreamQuery::Model::QueryResult;
+using Aws::TimestreamQuery::Model::Row;
+using Aws::Utils::Json::JsonValue;
+
+namespace {
+/** Magic of the cache file format, the version is its last character. */
+const char FILE_MAGIC[8] = {'T', 'S', 'R', 'C', 'A', 'C', 'H', '1'};
+
+/** Suffix of the cache file names. */
+const std::string FILE_SUFFIX = ".tsrc";
+
+/** Next token of the cached pages which are not the last. */
+const char NEXT_PAGE_TOKEN[] = "cached";
+
+/** Counter making the temporary file names of a process unique. */
+std::atomic< uint64_t > tempFileCounter(0);
+
+/**
+ * Reader of the mapped cache file with bounds checking.
+ */
+class FileReader {
+ public:
+  FileReader(const char* data, size_t size)
+      : data_(data), size_(size), pos_(0) {
+  }
+
+  bool ReadUInt64(uint64_t& value) {
+    if (size_ - pos_ < sizeof(value)) {
+      return false;
+    }
+    memcpy(&value, data_ + pos_, sizeof(value));
+    pos_ += sizeof(value);
+    return true;
+  }
+
+  bool ReadBytes(std::string& value) {
+    uint64_t length = 0;
+    if (!ReadUInt64(length) || size_ - pos_ < length) {
+      return false;
+    }
+    value.assign(data_ + pos_, static_cast< size_t >(length));
+    pos_ += static_cast< size_t >(length);
+    return true;
+  }
+
+  bool ReadMagic() {
+    if (size_ - pos_ < sizeof(FILE_MAGIC)
+        || memcmp(data_ + pos_, FILE_MAGIC, sizeof(FILE_MAGIC)) != 0) {
+      return false;
+    }
+    pos_ += sizeof(FILE_MAGIC);
+    return true;
+  }
+
+ private:
+  const char* data_;
+  size_t size_;
+  size_t pos_;
+};
+
+void WriteUInt64(std::ofstream& out, uint64_t value) {
+  out.write(reinterpret_cast< const char* >(&value), sizeof(value));
+}
+
+void WriteBytes(std::ofstream& out, const std::string& value) {
+  WriteUInt64(out, value.size());
+  out.write(value.data(), value.size());
+}
+
+uint64_t GetEpochSeconds() {
+  return std::chrono::duration_cast< std::chrono::seconds >(
+             std::chrono::system_clock::now().time_since_epoch())
+      .count();
+}
+
+/**
+ * FNV-1a hash, it must be the same in all processes so std::hash could not
+ * be used.
+ */
+uint64_t HashKey(const std::string& key) {
+  uint64_t hash = 14695981039346656037ULL;
+  for (char ch : key) {
+    hash ^= static_cast< unsigned char >(ch);
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+bool MoveCacheFile(const std::string& from, const std::string& to) {
+#ifdef _WIN32
+  return MoveFileExA(from.c_str(), to.c_str(), MOVEFILE_REPLACE_EXISTING)
+         != 0;
+#else
+  return std::rename(from.c_str(), to.c_str()) == 0;
+#endif
+}
+
+std::string JoinPath(const std::string& directory, const std::string& name) {
+#ifdef _WIN32
+  const char separator = '\\';
+#else
+  const char separator = '/';
+#endif
+  std::string path = directory;
+  if (!path.empty() && path.back() != '/' && path.back() != separator) {
+    path.push_back(separator);
+  }
+  return path + name;
+}
+
+/**
+ * List the names of the cache files of a directory.
+ */
+std::vector< std::string > ListCacheFiles(const std::string& directory) {
+  std::vector< std::string > names;
+  auto isCacheFile = [](const std::string& name) {
+    return name.size() > FILE_SUFFIX.size()
+           && name.compare(name.size() - FILE_SUFFIX.size(),
+                           FILE_SUFFIX.size(), FILE_SUFFIX)
+                  == 0;
+  };
+#ifdef _WIN32
+  WIN32_FIND_DATAA data;
+  HANDLE handle =
+      FindFirstFileA(JoinPath(directory, "*" + FILE_SUFFIX).c_str(), &data);
+  if (handle == INVALID_HANDLE_VALUE) {
+    return names;
+  }
+  do {
+    if (isCacheFile(data.cFileName)) {
+      names.emplace_back(data.cFileName);
+    }
+  } while (FindNextFileA(handle, &data));
+  FindClose(handle);
+#else
+  DIR* dir = opendir(directory.c_str());
+  if (!dir) {
+    return names;
+  }
+  while (struct dirent* entry = readdir(dir)) {
+    if (isCacheFile(entry->d_name)) {
+      names.emplace_back(entry->d_name);
+    }
+  }
+  closedir(dir);
+#endif
+  return names;
+}
+
+uint64_t GetCurrentPid() {
+#ifdef _WIN32
+  return static_cast< uint64_t >(_getpid());
+#else
+  return static_cast< uint64_t >(getpid());
+#endif
+}
+}  // namespace
+
+namespace timestream {
+namespace odbc {
+ResultCache::ResultCache(const std::string& directory,
+                         std::chrono::seconds ttl, const std::string& identity)
+    : directory_(directory),
+      ttl_(ttl),
+      identity_(identity),
+      available_(EnsureDirectory(directory)) {
+  if (!available_) {
+    LOG_WARNING_MSG("Result cache directory " << directory_
+                                              << " could not be used");
+  }
+}
+
+bool ResultCache::Get(const std::string& sql,
+                      std::vector< QueryResult >& pages) {
+  pages.clear();
+  if (ttl_.count() <= 0 || !available_) {
+    return false;
+  }
+
+  std::string key = MakeKey(sql);
+  std::string path = JoinPath(directory_, GetFileName(key));
+  std::vector< std::string > serialized;
+  bool expired = false;
+  try {
+    boost::interprocess::file_mapping mapping(path.c_str(),
+                                              boost::interprocess::read_only);
+    boost::interprocess::mapped_region region(mapping,
+                                              boost::interprocess::read_only);
+    FileReader reader(static_cast< const char* >(region.get_address()),
+                      region.get_size());
+
+    uint64_t expiry = 0;
+    std::string fileKey;
+    uint64_t pageCount = 0;
+    if (!reader.ReadMagic() || !reader.ReadUInt64(expiry)
+        || !reader.ReadBytes(fileKey) || !reader.ReadUInt64(pageCount)) {
+      LOG_WARNING_MSG("Result cache file " << path << " is corrupted");
+      return false;
+    }
+
+    if (fileKey != key) {
+      LOG_DEBUG_MSG("Result cache file " << path << " is for another query");
+      return false;
+    }
+
+    expired = expiry <= GetEpochSeconds();
+    for (uint64_t i = 0; !expired && i < pageCount; i++) {
+      serialized.emplace_back();
+      if (!reader.ReadBytes(serialized.back())) {
+        LOG_WARNING_MSG("Result cache file " << path << " is corrupted");
+        return false;
+      }
+    }
+  } catch (const boost::interprocess::interprocess_exception& e) {
+    // the file does not exist in most cases
+    LOG_DEBUG_MSG("Result cache file " << path
+                                       << " is not read: " << e.what());
+    return false;
+  }
+
+  if (expired) {
+    LOG_DEBUG_MSG("Result cache file " << path << " is expired");
+    std::remove(path.c_str());
+    return false;
+  }
+
+  pages.resize(serialized.size());
+  for (size_t i = 0; i < serialized.size(); i++) {
+    if (!DeserializePage(serialized[i], pages[i])) {
+      LOG_WARNING_MSG("Result cache file " << path << " is corrupted");
+      pages.clear();
+      return false;
+    }
+  }
+
+  LOG_DEBUG_MSG("Result cache file " << path << " has " << pages.size()
+                                     << " pages");
+  return !pages.empty();
+}
+
+bool ResultCache::Put(const std::string& sql,
+                      const std::vector< std::string >& pages) {
+  if (ttl_.count() <= 0 || !available_ || pages.empty()) {
+    return false;
+  }
+
+  std::string key = MakeKey(sql);
+  std::string path = JoinPath(directory_, GetFileName(key));
+  std::string tempPath = MakeTempPath(directory_, GetFileName(key));
+
+  {
+    std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+    if (!out) {
+      LOG_WARNING_MSG("Failed to create result cache file " << tempPath);
+      return false;
+    }
+#ifndef _WIN32
+    chmod(tempPath.c_str(), S_IRUSR | S_IWUSR);
+#endif
+
+    out.write(FILE_MAGIC, sizeof(FILE_MAGIC));
+    WriteUInt64(out, GetEpochSeconds() + ttl_.count());
+    WriteBytes(out, key);
+    WriteUInt64(out, pages.size());
+    for (const std::string& page : pages) {
+      WriteBytes(out, page);
+    }
+
+    out.close();
+    if (out.fail()) {
+      LOG_WARNING_MSG("Failed to write result cache file " << tempPath);
+      std::remove(tempPath.c_str());
+      return false;
+    }
+  }
+
+  // readers either see the previous entry or the complete new one
+  if (!MoveCacheFile(tempPath, path)) {
+    LOG_WARNING_MSG("Failed to replace result cache file " << path);
+    std::remove(tempPath.c_str());
+    return false;
+  }
+
+  LOG_DEBUG_MSG("Result cache file " << path << " is written with "
+                                     << pages.size() << " pages");
+
+  // entries of queries which are not run again are never read, so they
+  // would only be removed here
+  RemoveExpired();
+  return true;
+}
+
+void ResultCache::RemoveExpired() const {
+  uint64_t now = GetEpochSeconds();
+  for (const std::string& name : ListCacheFiles(directory_)) {
+    std::string path = JoinPath(directory_, name);
+    char magic[sizeof(FILE_MAGIC)];
+    uint64_t expiry = 0;
+    {
+      std::ifstream in(path, std::ios::binary);
+      in.read(magic, sizeof(magic));
+      in.read(reinterpret_cast< char* >(&expiry), sizeof(expiry));
+      if (!in || memcmp(magic, FILE_MAGIC, sizeof(FILE_MAGIC)) != 0) {
+        // the file is removed by another process or is not a cache file
+        continue;
+      }
+    }
+
+    if (expiry <= now) {
+      LOG_DEBUG_MSG("Result cache file " << path << " is expired");
+      std::remove(path.c_str());
+    }
+  }
+}
+
+std::string ResultCache::SerializePage(const QueryResult& page,
+                                       bool isLast) {
+  const Aws::Vector< Row >& rows = page.GetRows();
+  Aws::Utils::Array< JsonValue > rowsJson(rows.size());
+  for (size_t i = 0; i < rows.size(); i++) {
+    rowsJson[i] = rows[i].Jsonize();
+  }
+
+  const Aws::Vector< ColumnInfo >& columnInfo = page.GetColumnInfo();
+  Aws::Utils::Array< JsonValue > columnInfoJson(columnInfo.size());
+  for (size_t i = 0; i < columnInfo.size(); i++) {
+    columnInfoJson[i] = columnInfo[i].Jsonize();
+  }
+
+  JsonValue json;
+  json.WithString("QueryId", page.GetQueryId());
+  if (!isLast) {
+    // the token could not be used to continue the query, only mark that
+    // more pages follow
+    json.WithString("NextToken", NEXT_PAGE_TOKEN);
+  }
+  json.WithArray("Rows", std::move(rowsJson));
+  json.WithArray("ColumnInfo", std::move(columnInfoJson));
+
+  return json.View().WriteCompact();
+}
+
+bool ResultCache::DeserializePage(const std::string& serialized,
+                                  QueryResult& page) {
+  JsonValue json(serialized);
+  if (!json.WasParseSuccessful()) {
+    LOG_DEBUG_MSG("Failed to parse result page: " << json.GetErrorMessage());
+    return false;
+  }
+
+  page = QueryResult(Aws::AmazonWebServiceResult< JsonValue >(
+      json, Aws::Http::HeaderValueCollection()));
+  return true;
+}
+
+std::string ResultCache::MakeIdentity(const config::Configuration& config) {
+  std::stringstream identity;
+  identity << AuthType::ToString(config.GetAuthType()) << '\n'
+           << config.GetRegion() << '\n'
+           << config.GetEndpoint() << '\n'
+           << config.GetAccessKeyId() << '\n'
+           << config.GetProfileName() << '\n'
+           << config.GetIdPHost() << '\n'
+           << config.GetIdPUserName() << '\n'
+           << config.GetRoleArn() << '\n'
+           << config.GetAADTenant();
+  return identity.str();
+}
+
+std::string ResultCache::GetDefaultDirectory() {
+#ifdef _WIN32
+  char buffer[MAX_PATH + 1];
+  DWORD length = GetTempPathA(MAX_PATH + 1, buffer);
+  std::string temp = length > 0 ? std::string(buffer, length) : ".\\";
+  return temp + "timestream-odbc-cache";
+#else
+  // the runtime directory is private to the user, the temporary directory
+  // is shared so the directory name is made per user
+  const char* baseDir = std::getenv("XDG_RUNTIME_DIR");
+  if (!baseDir || !*baseDir) {
+    baseDir = std::getenv("TMPDIR");
+  }
+  std::string temp = baseDir && *baseDir ? baseDir : "/tmp";
+  if (temp.back() != '/') {
+    temp.push_back('/');
+  }
+  return temp + "timestream-odbc-cache-" + std::to_string(geteuid());
+#endif
+}
+
+bool ResultCache::EnsureDirectory(const std::string& directory) {
+#ifdef _WIN32
+  int res = _mkdir(directory.c_str());
+  return res == 0 || errno == EEXIST;
+#else
+  // the results could only be read by the owner
+  if (mkdir(directory.c_str(), 0700) != 0 && errno != EEXIST) {
+    return false;
+  }
+
+  // an existing directory could be created by another user to plant files
+  struct stat status;
+  if (lstat(directory.c_str(), &status) != 0) {
+    return false;
+  }
+  if (!S_ISDIR(status.st_mode) || status.st_uid != geteuid()
+      || (status.st_mode & 0777) != 0700) {
+    LOG_WARNING_MSG("Directory " << directory
+                                 << " is not a directory with mode 0700 "
+                                    "owned by the current user");
+    return false;
+  }
+  return true;
+#endif
+}
+
+std::string ResultCache::MakeTempPath(const std::string& directory,
+                                      const std::string& name) {
+  return JoinPath(directory, name) + "." + std::to_string(GetCurrentPid())
+         + "." + std::to_string(tempFileCounter++) + ".tmp";
+}
+
+std::string ResultCache::MakeKey(const std::string& sql) const {
+  return identity_ + '\n' + meta::ColumnMetaCache::NormalizeSql(sql);
+}
+
+std::string ResultCache::GetFileName(const std::string& key) {
+  char name[17];
+  snprintf(name, sizeof(name), "%016llx",
+           static_cast< unsigned long long >(HashKey(key)));
+  return name + FILE_SUFFIX;
+}
+}  // namespace odbc
+}  // namespace timestream
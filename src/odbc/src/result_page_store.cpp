@@ -0,0 +1,189 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#include "timestream/odbc/result_page_store.h"
+
+#include <cstdio>
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include "timestream/odbc/log.h"
+#include "timestream/odbc/result_buffer_budget.h"
+#include "timestream/odbc/result_cache.h"
+
+using Aws::TimestreamQuery::Model::QueryResult;
+
+namespace timestream {
+namespace odbc {
+ResultPageStore::ResultPageStore(size_t memoryLimit,
+                                 const std::string& spillDirectory)
+    : memoryLimit_(memoryLimit),
+      memoryUsed_(0),
+      rowCount_(0),
+      nextSpill_(0),
+      spillDirectory_(spillDirectory),
+      spillSize_(0),
+      loadedIdx_(0) {
+  // No-op.
+}
+
+ResultPageStore::~ResultPageStore() {
+  if (spillFile_.is_open()) {
+    spillFile_.close();
+  }
+  if (!spillPath_.empty()) {
+    std::remove(spillPath_.c_str());
+  }
+}
+
+void ResultPageStore::Add(std::shared_ptr< QueryResult > page,
+                          std::shared_ptr< const ColumnarPage > columns) {
+  if (!page || page->GetRows().empty()) {
+    return;
+  }
+
+  Entry entry;
+  entry.firstRow = rowCount_;
+  entry.rowCount = page->GetRows().size();
+  entry.bytes = ResultBufferBudget::EstimateSize(*page)
+                + (columns ? columns->GetSize() : 0);
+  entry.page = std::move(page);
+  entry.columns = std::move(columns);
+  entry.offset = 0;
+  entry.length = 0;
+
+  rowCount_ += entry.rowCount;
+  memoryUsed_ += entry.bytes;
+  entries_.push_back(std::move(entry));
+
+  // the newest page is never spilled as the cursor is usually on it
+  while (memoryLimit_ > 0 && memoryUsed_ > memoryLimit_
+         && nextSpill_ + 1 < entries_.size()) {
+    if (!Spill(entries_[nextSpill_])) {
+      memoryLimit_ = 0;
+      break;
+    }
+    nextSpill_++;
+  }
+}
+
+bool ResultPageStore::Find(int64_t row, std::shared_ptr< QueryResult >& page,
+                           std::shared_ptr< const ColumnarPage >& columns,
+                           size_t& rowIdx) {
+  if (row < 0 || row >= rowCount_) {
+    return false;
+  }
+
+  size_t low = 0;
+  size_t high = entries_.size();
+  while (high - low > 1) {
+    size_t mid = low + (high - low) / 2;
+    if (entries_[mid].firstRow <= row) {
+      low = mid;
+    } else {
+      high = mid;
+    }
+  }
+
+  const Entry& entry = entries_[low];
+  rowIdx = static_cast< size_t >(row - entry.firstRow);
+  if (entry.page) {
+    page = entry.page;
+    columns = entry.columns;
+    return true;
+  }
+
+  if (!loadedPage_ || loadedIdx_ != low) {
+    if (!Load(entry, loadedPage_, loadedColumns_)) {
+      loadedPage_.reset();
+      loadedColumns_.reset();
+      return false;
+    }
+    loadedIdx_ = low;
+  }
+  page = loadedPage_;
+  columns = loadedColumns_;
+  return true;
+}
+
+bool ResultPageStore::Spill(Entry& entry) {
+  if (!spillFile_.is_open()) {
+    if (!ResultCache::EnsureDirectory(spillDirectory_)) {
+      LOG_WARNING_MSG("Failed to create scroll buffer directory "
+                      << spillDirectory_);
+      return false;
+    }
+    spillPath_ = ResultCache::MakeTempPath(spillDirectory_, "scroll");
+    spillFile_.open(spillPath_, std::ios::binary | std::ios::trunc);
+    if (!spillFile_) {
+      LOG_WARNING_MSG("Failed to open scroll buffer file " << spillPath_);
+      spillPath_.clear();
+      return false;
+    }
+  }
+
+  std::string serialized = ResultCache::SerializePage(*entry.page, true);
+  spillFile_.write(serialized.data(), serialized.size());
+  spillFile_.flush();
+  if (!spillFile_) {
+    LOG_WARNING_MSG("Failed to write scroll buffer file " << spillPath_);
+    return false;
+  }
+
+  entry.offset = spillSize_;
+  entry.length = serialized.size();
+  spillSize_ += serialized.size();
+
+  entry.page.reset();
+  entry.columns.reset();
+  memoryUsed_ -= entry.bytes;
+  LOG_DEBUG_MSG("Spilled " << entry.rowCount << " rows at row "
+                           << entry.firstRow << " to " << spillPath_);
+  return true;
+}
+
+bool ResultPageStore::Load(const Entry& entry,
+                           std::shared_ptr< QueryResult >& page,
+                           std::shared_ptr< const ColumnarPage >& columns) {
+  std::string serialized;
+  try {
+    boost::interprocess::file_mapping mapping(spillPath_.c_str(),
+                                              boost::interprocess::read_only);
+    boost::interprocess::mapped_region region(
+        mapping, boost::interprocess::read_only, entry.offset,
+        static_cast< size_t >(entry.length));
+    serialized.assign(static_cast< const char* >(region.get_address()),
+                      region.get_size());
+  } catch (const boost::interprocess::interprocess_exception& e) {
+    LOG_ERROR_MSG("Failed to read scroll buffer file " << spillPath_ << ": "
+                                                       << e.what());
+    return false;
+  }
+
+  auto loaded = std::make_shared< QueryResult >();
+  if (!ResultCache::DeserializePage(serialized, *loaded)
+      || loaded->GetRows().size() != entry.rowCount) {
+    LOG_ERROR_MSG("Scroll buffer file " << spillPath_ << " is corrupted");
+    return false;
+  }
+
+  columns = std::make_shared< ColumnarPage >(*loaded);
+  page = std::move(loaded);
+  return true;
+}
+}  // namespace odbc
+}  // namespace timestream
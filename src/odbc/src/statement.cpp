@@ -21,6 +21,7 @@
 #include "timestream/odbc/statement.h"
 
 #include <boost/optional.hpp>
+#include <algorithm>
 #include <limits>
 
 #include "timestream/odbc/connection.h"
@@ -53,7 +54,15 @@ Statement::Statement(Connection& parent)
       cellOffset(0),
       currentColNum(0),
       rowArraySize(1),
-      rowsetSize(1) {
+      rowsetSize(1),
+      cursorType(SQL_CURSOR_FORWARD_ONLY),
+      rowsetStart(0),
+      maxRows(0),
+      queryTimeout(0),
+      asyncEnable(SQL_ASYNC_ENABLE_OFF),
+      asyncOperation(),
+      queryMutex(),
+      queryInterrupted(false) {
   // Create and initialize implicit descriptors. Here we created the 4 implicit
   // descriptors. But besides implicit ARD, they are not in use because there is
   // no clear document about how to set and use them. This could be done in
@@ -86,6 +95,8 @@ Statement::Statement(Connection& parent)
 }
 
 Statement::~Statement() {
+  // the asynchronous operation uses the statement
+  asyncOperation.Wait();
 }
 
 void Statement::RestoreDescriptor(DescType type) {
@@ -101,6 +112,10 @@ void Statement::RestoreDescriptor(DescType type) {
 void Statement::BindColumn(uint16_t columnIdx, int16_t targetType,
                            void* targetValue, SqlLen bufferLength,
                            SqlLen* strLengthOrIndicator) {
+  if (RejectIfAsyncRunning()) {
+    return;
+  }
+
   IGNITE_ODBC_API_CALL(InternalBindColumn(columnIdx, targetType, targetValue,
                                           bufferLength, strLengthOrIndicator));
 }
@@ -206,15 +221,15 @@ void Statement::SetDescriptorFields(uint16_t columnIdx, int16_t targetType,
 
 void Statement::SafeBindColumn(uint16_t columnIdx,
                                const app::ApplicationDataBuffer& buffer) {
-  columnBindings[columnIdx] = buffer;
+  columnBindings.Bind(columnIdx, buffer);
 }
 
 void Statement::SafeUnbindColumn(uint16_t columnIdx) {
-  columnBindings.erase(columnIdx);
+  columnBindings.Unbind(columnIdx);
 }
 
 void Statement::SafeUnbindAllColumns() {
-  columnBindings.clear();
+  columnBindings.Clear();
 }
 
 void Statement::SetColumnBindOffsetPtr(SqlUlen* ptr) {
@@ -226,6 +241,10 @@ SqlUlen* Statement::GetColumnBindOffsetPtr() {
 }
 
 int32_t Statement::GetColumnNumber() {
+  if (RejectIfAsyncRunning()) {
+    return 0;
+  }
+
   int32_t res;
 
   IGNITE_ODBC_API_CALL(InternalGetColumnNumber(res));
@@ -265,6 +284,10 @@ SqlResult::Type Statement::InternalGetColumnNumber(int32_t& res) {
 }
 
 void Statement::SetAttribute(int attr, void* value, SQLINTEGER valueLen) {
+  if (RejectIfAsyncRunning()) {
+    return;
+  }
+
   IGNITE_ODBC_API_CALL(InternalSetAttribute(attr, value, valueLen));
 }
 
@@ -272,6 +295,42 @@ SqlResult::Type Statement::InternalSetAttribute(int attr, void* value,
                                                 SQLINTEGER) {
   LOG_DEBUG_MSG("InternalSetAttribute is called with attr " << attr);
   switch (attr) {
+    case SQL_ATTR_ASYNC_ENABLE: {
+      SqlUlen mode = reinterpret_cast< SqlUlen >(value);
+
+      if (mode != SQL_ASYNC_ENABLE_OFF && mode != SQL_ASYNC_ENABLE_ON) {
+        AddStatusRecord(SqlState::SHY024_INVALID_ATTRIBUTE_VALUE,
+                        "Invalid argument value");
+
+        return SqlResult::AI_ERROR;
+      }
+
+      asyncEnable = mode;
+
+      LOG_DEBUG_MSG("asyncEnable: " << asyncEnable);
+
+      break;
+    }
+
+    case SQL_ATTR_ASYNC_STMT_EVENT: {
+      asyncOperation.SetEventHandle(value);
+
+      break;
+    }
+
+    case SQL_ATTR_ASYNC_STMT_NOTIFICATION_CALLBACK: {
+      asyncOperation.SetCallback(
+          reinterpret_cast< AsyncNotificationCallback >(value));
+
+      break;
+    }
+
+    case SQL_ATTR_ASYNC_STMT_NOTIFICATION_CONTEXT: {
+      asyncOperation.SetContext(value);
+
+      break;
+    }
+
     case SQL_ATTR_CONCURRENCY: {
       SqlUlen concurrency = reinterpret_cast< SqlUlen >(value);
 
@@ -285,16 +344,34 @@ SqlResult::Type Statement::InternalSetAttribute(int attr, void* value,
       break;
     }
 
+    case SQL_ATTR_CURSOR_SCROLLABLE: {
+      SqlUlen scrollable = reinterpret_cast< SqlUlen >(value);
+
+      if (scrollable != SQL_SCROLLABLE && scrollable != SQL_NONSCROLLABLE) {
+        AddStatusRecord(SqlState::SHY024_INVALID_ATTRIBUTE_VALUE,
+                        "Invalid argument value");
+
+        return SqlResult::AI_ERROR;
+      }
+
+      cursorType = scrollable == SQL_SCROLLABLE ? SQL_CURSOR_STATIC
+                                                : SQL_CURSOR_FORWARD_ONLY;
+
+      break;
+    }
+
     case SQL_ATTR_CURSOR_TYPE: {
-      SqlUlen cursorType = reinterpret_cast< SqlUlen >(value);
+      SqlUlen type = reinterpret_cast< SqlUlen >(value);
 
-      if (cursorType != SQL_CURSOR_FORWARD_ONLY) {
+      if (type != SQL_CURSOR_FORWARD_ONLY && type != SQL_CURSOR_STATIC) {
         AddStatusRecord(SqlState::SHYC00_OPTIONAL_FEATURE_NOT_IMPLEMENTED,
-                        "Only forward cursors are currently supported");
+                        "Only forward-only and static cursors are supported");
 
         return SqlResult::AI_ERROR;
       }
 
+      cursorType = type;
+
       break;
     }
 
@@ -391,6 +468,22 @@ SqlResult::Type Statement::InternalSetAttribute(int attr, void* value,
       break;
     }
 
+    case SQL_ATTR_MAX_ROWS: {
+      maxRows = reinterpret_cast< SqlUlen >(value);
+
+      LOG_DEBUG_MSG("maxRows: " << maxRows);
+
+      break;
+    }
+
+    case SQL_ATTR_QUERY_TIMEOUT: {
+      queryTimeout = reinterpret_cast< SqlUlen >(value);
+
+      LOG_DEBUG_MSG("queryTimeout: " << queryTimeout);
+
+      break;
+    }
+
     case SQL_ATTR_PARAM_BIND_OFFSET_PTR: {
       apdi->GetHeader().bindOffsetPtr = reinterpret_cast<SQLLEN*>(value);
       break;
@@ -459,10 +552,17 @@ void Statement::SetAttribute(StatementAttributes& stmtAttr) {
   SetAttribute(SQL_ATTR_RETRIEVE_DATA, reinterpret_cast<SQLPOINTER>(stmtAttr.retrieveData), 0);
   SetAttribute(SQL_ATTR_ROW_ARRAY_SIZE, reinterpret_cast<SQLPOINTER>(stmtAttr.rowArraySize), 0);
   SetAttribute(SQL_ROWSET_SIZE, reinterpret_cast<SQLPOINTER>(stmtAttr.rowsetSize), 0);
+  SetAttribute(SQL_ATTR_MAX_ROWS, reinterpret_cast<SQLPOINTER>(stmtAttr.maxRows), 0);
+  SetAttribute(SQL_ATTR_QUERY_TIMEOUT, reinterpret_cast<SQLPOINTER>(stmtAttr.queryTimeout), 0);
+  SetAttribute(SQL_ATTR_ASYNC_ENABLE, reinterpret_cast<SQLPOINTER>(stmtAttr.asyncEnable), 0);
 }
 
 void Statement::GetAttribute(int attr, void* buf, SQLINTEGER bufLen,
                              SQLINTEGER* valueLen) {
+  if (RejectIfAsyncRunning()) {
+    return;
+  }
+
   IGNITE_ODBC_API_CALL(InternalGetAttribute(attr, buf, bufLen, valueLen));
 }
 
@@ -476,6 +576,50 @@ SqlResult::Type Statement::InternalGetAttribute(int attr, void* buf, SQLINTEGER,
   }
 
   switch (attr) {
+    case SQL_ATTR_ASYNC_ENABLE: {
+      SqlUlen* val = reinterpret_cast< SqlUlen* >(buf);
+
+      *val = asyncEnable;
+
+      if (valueLen)
+        *valueLen = SQL_IS_UINTEGER;
+
+      break;
+    }
+
+    case SQL_ATTR_ASYNC_STMT_EVENT: {
+      SQLPOINTER* val = reinterpret_cast< SQLPOINTER* >(buf);
+
+      *val = asyncOperation.GetEventHandle();
+
+      if (valueLen)
+        *valueLen = SQL_IS_POINTER;
+
+      break;
+    }
+
+    case SQL_ATTR_ASYNC_STMT_NOTIFICATION_CALLBACK: {
+      SQLPOINTER* val = reinterpret_cast< SQLPOINTER* >(buf);
+
+      *val = reinterpret_cast< SQLPOINTER >(asyncOperation.GetCallback());
+
+      if (valueLen)
+        *valueLen = SQL_IS_POINTER;
+
+      break;
+    }
+
+    case SQL_ATTR_ASYNC_STMT_NOTIFICATION_CONTEXT: {
+      SQLPOINTER* val = reinterpret_cast< SQLPOINTER* >(buf);
+
+      *val = asyncOperation.GetContext();
+
+      if (valueLen)
+        *valueLen = SQL_IS_POINTER;
+
+      break;
+    }
+
     case SQL_ATTR_APP_ROW_DESC: {
       SQLPOINTER* val = reinterpret_cast< SQLPOINTER* >(buf);
 
@@ -530,7 +674,8 @@ SqlResult::Type Statement::InternalGetAttribute(int attr, void* buf, SQLINTEGER,
     case SQL_ATTR_CURSOR_SCROLLABLE: {
       SqlUlen* val = reinterpret_cast< SqlUlen* >(buf);
 
-      *val = SQL_NONSCROLLABLE;
+      *val = cursorType == SQL_CURSOR_STATIC ? SQL_SCROLLABLE
+                                             : SQL_NONSCROLLABLE;
 
       break;
     }
@@ -546,7 +691,7 @@ SqlResult::Type Statement::InternalGetAttribute(int attr, void* buf, SQLINTEGER,
     case SQL_ATTR_CURSOR_TYPE: {
       SqlUlen* val = reinterpret_cast< SqlUlen* >(buf);
 
-      *val = SQL_CURSOR_FORWARD_ONLY;
+      *val = cursorType;
 
       break;
     }
@@ -607,6 +752,28 @@ SqlResult::Type Statement::InternalGetAttribute(int attr, void* buf, SQLINTEGER,
       break;
     }
 
+    case SQL_ATTR_MAX_ROWS: {
+      SqlUlen* val = reinterpret_cast< SqlUlen* >(buf);
+
+      *val = maxRows;
+
+      if (valueLen)
+        *valueLen = SQL_IS_UINTEGER;
+
+      break;
+    }
+
+    case SQL_ATTR_QUERY_TIMEOUT: {
+      SqlUlen* val = reinterpret_cast< SqlUlen* >(buf);
+
+      *val = queryTimeout;
+
+      if (valueLen)
+        *valueLen = SQL_IS_UINTEGER;
+
+      break;
+    }
+
     case SQL_ATTR_ROWS_FETCHED_PTR: {
       SqlUlen** val = reinterpret_cast< SqlUlen** >(buf);
 
@@ -683,6 +850,10 @@ SqlResult::Type Statement::InternalGetAttribute(int attr, void* buf, SQLINTEGER,
 }
 
 void Statement::GetStmtOption(SQLUSMALLINT option, SQLPOINTER value) {
+  if (RejectIfAsyncRunning()) {
+    return;
+  }
+
   IGNITE_ODBC_API_CALL(InternalGetStmtOption(option, value));
 }
 
@@ -698,9 +869,12 @@ SqlResult::Type Statement::InternalGetStmtOption(SQLUSMALLINT option,
 
   switch (option) {
     case SQL_ATTR_ROW_ARRAY_SIZE:
+    case SQL_ASYNC_ENABLE:
     case SQL_BIND_TYPE:
     case SQL_CONCURRENCY:
     case SQL_CURSOR_TYPE:
+    case SQL_MAX_ROWS:
+    case SQL_QUERY_TIMEOUT:
     case SQL_RETRIEVE_DATA:
     case SQL_ROWSET_SIZE:
     default: {
@@ -711,6 +885,10 @@ SqlResult::Type Statement::InternalGetStmtOption(SQLUSMALLINT option,
 
 void Statement::GetColumnData(uint16_t columnIdx,
                               app::ApplicationDataBuffer& buffer) {
+  if (RejectIfAsyncRunning()) {
+    return;
+  }
+
   IGNITE_ODBC_API_CALL(InternalGetColumnData(columnIdx, buffer));
 }
 
@@ -729,6 +907,10 @@ SqlResult::Type Statement::InternalGetColumnData(
 }
 
 void Statement::PrepareSqlQuery(const std::string& query) {
+  if (RejectIfAsyncRunning()) {
+    return;
+  }
+
   IGNITE_ODBC_API_CALL(InternalPrepareSqlQuery(query));
 }
 
@@ -741,13 +923,21 @@ SqlResult::Type Statement::InternalPrepareSqlQuery(const std::string& query) {
   if (currentQuery.get())
     currentQuery->Close();
 
-  currentQuery.reset(new query::DataQuery(*this, connection, query));
+  // the query is replaced on the worker thread of SQLExecDirect while
+  // SQLCancel could interrupt it
+  std::lock_guard< std::mutex > locker(queryMutex);
+  currentQuery.reset(new query::DataQuery(*this, connection, query,
+                                          cursorType == SQL_CURSOR_STATIC));
+  if (queryInterrupted) {
+    currentQuery->Interrupt();
+  }
 
   return SqlResult::AI_SUCCESS;
 }
 
 void Statement::ExecuteSqlQuery(const std::string& query) {
-  IGNITE_ODBC_API_CALL(InternalExecuteSqlQuery(query));
+  AsyncApiCall(SQL_API_SQLEXECDIRECT,
+               [this, query]() { return InternalExecuteSqlQuery(query); });
 }
 
 SqlResult::Type Statement::InternalExecuteSqlQuery(const std::string& query) {
@@ -761,7 +951,8 @@ SqlResult::Type Statement::InternalExecuteSqlQuery(const std::string& query) {
 }
 
 void Statement::ExecuteSqlQuery() {
-  IGNITE_ODBC_API_CALL(InternalExecuteSqlQuery());
+  AsyncApiCall(SQL_API_SQLEXECUTE,
+               [this]() { return InternalExecuteSqlQuery(); });
 }
 
 SqlResult::Type Statement::InternalExecuteSqlQuery() {
@@ -772,6 +963,11 @@ SqlResult::Type Statement::InternalExecuteSqlQuery() {
     return SqlResult::AI_ERROR;
   }
 
+  rowsetStart = 0;
+  // the attributes could be changed after the query is prepared
+  currentQuery->SetMaxRows(static_cast< int64_t >(maxRows));
+  currentQuery->SetQueryTimeout(static_cast< int32_t >(std::min< SqlUlen >(
+      queryTimeout, std::numeric_limits< int32_t >::max())));
   SqlResult::Type retval = currentQuery->Execute();
   // For SQLExecute() when the query result is empty according to Microsoft
   // document it should be SUCCESS. SQL_NO_DATA is only used for DML statements.
@@ -785,6 +981,24 @@ SqlResult::Type Statement::InternalExecuteSqlQuery() {
 }
 
 void Statement::CancelSqlQuery() {
+  if (asyncOperation.IsRunning()) {
+    // the operation is cancelled when it completes, the polling call
+    // returns the cancellation. SQLCancel could be called from another
+    // thread, it only sets the poll result of its own thread.
+    LOG_DEBUG_MSG("Asynchronous operation is cancelled");
+    asyncOperation.Cancel();
+    asyncOperation.SetPollResult(SqlResult::AI_SUCCESS);
+
+    // stop waiting for the server, the queries running on the server are
+    // cancelled when the interrupted query is closed
+    std::lock_guard< std::mutex > locker(queryMutex);
+    queryInterrupted = true;
+    if (currentQuery.get()) {
+      currentQuery->Interrupt();
+    }
+    return;
+  }
+
   IGNITE_ODBC_API_CALL(InternalCancelSqlQuery());
 }
 
@@ -804,6 +1018,10 @@ void Statement::ExecuteGetColumnsMetaQuery(
     const boost::optional< std::string >& schema,
     const boost::optional< std::string >& table,
     const boost::optional< std::string >& column) {
+  if (RejectIfAsyncRunning()) {
+    return;
+  }
+
   IGNITE_ODBC_API_CALL(
       InternalExecuteGetColumnsMetaQuery(catalog, schema, table, column));
 }
@@ -827,6 +1045,10 @@ void Statement::ExecuteGetTablesMetaQuery(
     const boost::optional< std::string >& schema,
     const boost::optional< std::string >& table,
     const boost::optional< std::string >& tableType) {
+  if (RejectIfAsyncRunning()) {
+    return;
+  }
+
   IGNITE_ODBC_API_CALL(
       InternalExecuteGetTablesMetaQuery(catalog, schema, table, tableType));
 }
@@ -847,6 +1069,10 @@ SqlResult::Type Statement::InternalExecuteGetTablesMetaQuery(
 }
 
 void Statement::ExecuteGetForeignKeysQuery() {
+  if (RejectIfAsyncRunning()) {
+    return;
+  }
+
   IGNITE_ODBC_API_CALL(InternalExecuteGetForeignKeysQuery());
 }
 
@@ -860,6 +1086,10 @@ SqlResult::Type Statement::InternalExecuteGetForeignKeysQuery() {
 }
 
 void Statement::ExecuteGetPrimaryKeysQuery() {
+  if (RejectIfAsyncRunning()) {
+    return;
+  }
+
   IGNITE_ODBC_API_CALL(InternalExecuteGetPrimaryKeysQuery());
 }
 
@@ -873,6 +1103,10 @@ SqlResult::Type Statement::InternalExecuteGetPrimaryKeysQuery() {
 }
 
 void Statement::ExecuteSpecialColumnsQuery() {
+  if (RejectIfAsyncRunning()) {
+    return;
+  }
+
   IGNITE_ODBC_API_CALL(InternalExecuteSpecialColumnsQuery());
 }
 
@@ -886,6 +1120,10 @@ SqlResult::Type Statement::InternalExecuteSpecialColumnsQuery() {
 }
 
 void Statement::ExecuteStatisticsQuery() {
+  if (RejectIfAsyncRunning()) {
+    return;
+  }
+
   IGNITE_ODBC_API_CALL(InternalExecuteStatisticsQuery());
 }
 
@@ -900,6 +1138,10 @@ SqlResult::Type Statement::InternalExecuteStatisticsQuery() {
 }
 
 void Statement::ExecuteProcedureColumnsQuery() {
+  if (RejectIfAsyncRunning()) {
+    return;
+  }
+
   IGNITE_ODBC_API_CALL(InternalExecuteProcedureColumnsQuery());
 }
 
@@ -913,6 +1155,10 @@ SqlResult::Type Statement::InternalExecuteProcedureColumnsQuery() {
 }
 
 void Statement::ExecuteProceduresQuery() {
+  if (RejectIfAsyncRunning()) {
+    return;
+  }
+
   IGNITE_ODBC_API_CALL(InternalExecuteProceduresQuery());
 }
 
@@ -926,6 +1172,10 @@ SqlResult::Type Statement::InternalExecuteProceduresQuery() {
 }
 
 void Statement::ExecuteColumnPrivilegesQuery() {
+  if (RejectIfAsyncRunning()) {
+    return;
+  }
+
   IGNITE_ODBC_API_CALL(InternalExecuteColumnPrivilegesQuery());
 }
 
@@ -939,6 +1189,10 @@ SqlResult::Type Statement::InternalExecuteColumnPrivilegesQuery() {
 }
 
 void Statement::ExecuteTablePrivilegesQuery() {
+  if (RejectIfAsyncRunning()) {
+    return;
+  }
+
   IGNITE_ODBC_API_CALL(InternalExecuteTablePrivilegesQuery());
 }
 
@@ -952,6 +1206,10 @@ SqlResult::Type Statement::InternalExecuteTablePrivilegesQuery() {
 }
 
 void Statement::ExecuteGetTypeInfoQuery(int16_t sqlType) {
+  if (RejectIfAsyncRunning()) {
+    return;
+  }
+
   IGNITE_ODBC_API_CALL(InternalExecuteGetTypeInfoQuery(sqlType));
 }
 
@@ -977,6 +1235,10 @@ SqlResult::Type Statement::InternalExecuteGetTypeInfoQuery(int16_t sqlType) {
 }
 
 void Statement::FreeResources(int16_t option) {
+  if (RejectIfAsyncRunning()) {
+    return;
+  }
+
   IGNITE_ODBC_API_CALL(InternalFreeResources(option));
 }
 
@@ -1012,6 +1274,10 @@ SqlResult::Type Statement::InternalFreeResources(int16_t option) {
 }
 
 void Statement::Close() {
+  if (RejectIfAsyncRunning()) {
+    return;
+  }
+
   IGNITE_ODBC_API_CALL(InternalClose(false));
 }
 
@@ -1031,7 +1297,9 @@ SqlResult::Type Statement::InternalClose(bool ignoreErrors) {
 }
 
 void Statement::ExtendedFetch(SQLUSMALLINT orientation, SQLLEN offset, SQLULEN* rowCount, SQLUSMALLINT* rowStatusArray) {
-    IGNITE_ODBC_API_CALL(InternalExtendedFetch(orientation, offset, rowCount, rowStatusArray));
+  AsyncApiCall(SQL_API_SQLEXTENDEDFETCH, [=]() {
+    return InternalExtendedFetch(orientation, offset, rowCount, rowStatusArray);
+  });
 }
 
 SqlResult::Type Statement::InternalExtendedFetch(SQLUSMALLINT orientation, SQLLEN offset,
@@ -1056,22 +1324,17 @@ SqlResult::Type Statement::InternalExtendedFetch(SQLUSMALLINT orientation, SQLLE
 
   // offset (aka FetchOffset) is ignored. Byte offsets are
   // explicitly set to 0 to indicate that bind offsets are not supported
-  for (app::ColumnBindingMap::iterator it = columnBindings.begin();
-    it != columnBindings.end(); ++it) {
-    it->second.SetByteOffset(0);
-  }
+  columnBindings.SetByteOffset(0);
 
   SqlUlen fetched = 0;
   SqlUlen errors = 0;
 
   LOG_DEBUG_MSG("rowsetSize is " << rowsetSize);
-  for (SqlUlen i = 0; i < rowsetSize; ++i) {
-    for (app::ColumnBindingMap::iterator it = columnBindings.begin();
-      it != columnBindings.end(); ++it) {
-      it->second.SetElementOffset(i);
-    }
+  std::vector< SqlResult::Type > rowResults(rowsetSize);
+  currentQuery->FetchRowset(columnBindings, rowResults);
 
-    SqlResult::Type res = currentQuery->FetchNextRow(columnBindings);
+  for (SqlUlen i = 0; i < rowsetSize; ++i) {
+    SqlResult::Type res = rowResults[i];
 
     if (res == SqlResult::AI_SUCCESS || res == SqlResult::AI_SUCCESS_WITH_INFO) {
       ++fetched;
@@ -1100,27 +1363,181 @@ SqlResult::Type Statement::InternalExtendedFetch(SQLUSMALLINT orientation, SQLLE
 }
 
 void Statement::FetchScroll(int16_t orientation, int64_t offset) {
-  IGNITE_ODBC_API_CALL(InternalFetchScroll(orientation, offset));
+  AsyncApiCall(SQL_API_SQLFETCHSCROLL, [this, orientation, offset]() {
+    return InternalFetchScroll(orientation, offset);
+  });
 }
 
 SqlResult::Type Statement::InternalFetchScroll(int16_t orientation,
                                                int64_t offset) {
   LOG_DEBUG_MSG("InternalFetchScroll is called with orientation "
                 << orientation);
-  UNREFERENCED_PARAMETER(offset);
 
-  if (orientation != SQL_FETCH_NEXT) {
-    AddStatusRecord(SqlState::SHYC00_OPTIONAL_FEATURE_NOT_IMPLEMENTED,
-                    "Only SQL_FETCH_NEXT FetchOrientation type is supported");
+  if (!currentQuery.get() || !currentQuery->IsScrollable()) {
+    if (orientation != SQL_FETCH_NEXT) {
+      AddStatusRecord(
+          SqlState::SHYC00_OPTIONAL_FEATURE_NOT_IMPLEMENTED,
+          "Only SQL_FETCH_NEXT FetchOrientation type is supported by "
+          "forward-only cursors");
 
-    return SqlResult::AI_ERROR;
+      return SqlResult::AI_ERROR;
+    }
+
+    return InternalFetchRow();
+  }
+
+  if (rowsFetched)
+    *rowsFetched = 0;
+
+  SqlResult::Type moved = MoveRowset(orientation, offset);
+  if (moved == SqlResult::AI_ERROR || moved == SqlResult::AI_NO_DATA)
+    return moved;
+
+  SqlResult::Type result = FetchRowset();
+  if (moved == SqlResult::AI_SUCCESS_WITH_INFO
+      && result == SqlResult::AI_SUCCESS)
+    result = SqlResult::AI_SUCCESS_WITH_INFO;
+
+  return result;
+}
+
+SqlResult::Type Statement::MoveRowset(int16_t orientation, int64_t offset) {
+  LOG_DEBUG_MSG("MoveRowset is called with orientation "
+                << orientation << ", offset " << offset
+                << ", rowsetStart " << rowsetStart);
+
+  int64_t size = static_cast< int64_t >(rowArraySize);
+  int64_t start = 0;
+  SqlResult::Type result = SqlResult::AI_SUCCESS;
+
+  // the start of the rowset follows the SQLFetchScroll cursor positioning
+  // rules, a rowset which would start before the first row starts at it
+  switch (orientation) {
+    case SQL_FETCH_NEXT: {
+      if (rowsetStart < 0)
+        start = -1;
+      else
+        start = rowsetStart == 0 ? 1 : rowsetStart + size;
+
+      break;
+    }
+
+    case SQL_FETCH_PRIOR: {
+      if (rowsetStart < 0) {
+        result = GetAbsoluteRowsetStart(-size, start);
+      } else if (rowsetStart <= 1) {
+        start = 0;
+      } else if (rowsetStart <= size) {
+        start = 1;
+        result = SqlResult::AI_SUCCESS_WITH_INFO;
+      } else {
+        start = rowsetStart - size;
+      }
+
+      break;
+    }
+
+    case SQL_FETCH_RELATIVE: {
+      if ((rowsetStart == 0 && offset > 0) || (rowsetStart < 0 && offset < 0)) {
+        result = GetAbsoluteRowsetStart(offset, start);
+      } else if (rowsetStart <= 0) {
+        start = rowsetStart;
+      } else if (rowsetStart + offset >= 1) {
+        start = rowsetStart + offset;
+      } else if (-offset > size) {
+        start = 0;
+      } else {
+        start = 1;
+        result = SqlResult::AI_SUCCESS_WITH_INFO;
+      }
+
+      break;
+    }
+
+    case SQL_FETCH_ABSOLUTE: {
+      result = GetAbsoluteRowsetStart(offset, start);
+
+      break;
+    }
+
+    case SQL_FETCH_FIRST: {
+      start = 1;
+
+      break;
+    }
+
+    case SQL_FETCH_LAST: {
+      int64_t rowCount = 0;
+      result = currentQuery->GetRowCount(rowCount);
+      start = std::max< int64_t >(rowCount - size + 1, 1);
+
+      break;
+    }
+
+    default: {
+      AddStatusRecord(SqlState::SHY106_FETCH_TYPE_OUT_OF_RANGE,
+                      "Fetch type out of range");
+
+      return SqlResult::AI_ERROR;
+    }
+  }
+
+  if (result == SqlResult::AI_ERROR)
+    return result;
+
+  if (start < 0) {
+    rowsetStart = -1;
+    return SqlResult::AI_NO_DATA;
+  }
+
+  SqlResult::Type moved = currentQuery->MoveTo(start);
+  if (moved == SqlResult::AI_ERROR)
+    return moved;
+
+  if (start == 0 || moved == SqlResult::AI_NO_DATA) {
+    rowsetStart = start == 0 ? 0 : -1;
+    return SqlResult::AI_NO_DATA;
+  }
+
+  rowsetStart = start;
+  if (result == SqlResult::AI_SUCCESS_WITH_INFO)
+    AddStatusRecord(
+        SqlState::S01S06_FETCH_BEFORE_FIRST_ROWSET,
+        "Attempt to fetch before the result set returned the first rowset",
+        timestream::odbc::LogLevel::Type::WARNING_LEVEL);
+
+  return result;
+}
+
+SqlResult::Type Statement::GetAbsoluteRowsetStart(int64_t offset,
+                                                  int64_t& start) {
+  // the rows after the end are found by MoveTo, so the row count is only
+  // needed for the offsets from the end
+  if (offset >= 0) {
+    start = offset;
+    return SqlResult::AI_SUCCESS;
+  }
+
+  int64_t rowCount = 0;
+  SqlResult::Type result = currentQuery->GetRowCount(rowCount);
+  if (result == SqlResult::AI_ERROR)
+    return result;
+
+  int64_t size = static_cast< int64_t >(rowArraySize);
+  if (-offset <= rowCount) {
+    start = rowCount + offset + 1;
+  } else if (-offset > size) {
+    start = 0;
+  } else {
+    start = 1;
+    return SqlResult::AI_SUCCESS_WITH_INFO;
   }
 
-  return InternalFetchRow();
+  return SqlResult::AI_SUCCESS;
 }
 
 void Statement::FetchRow() {
-  IGNITE_ODBC_API_CALL(InternalFetchRow());
+  AsyncApiCall(SQL_API_SQLFETCH, [this]() { return InternalFetchRow(); });
 }
 
 SqlResult::Type Statement::InternalFetchRow() {
@@ -1134,27 +1551,31 @@ SqlResult::Type Statement::InternalFetchRow() {
     return SqlResult::AI_ERROR;
   }
 
+  // the rowset of a scrollable cursor is moved before it is fetched
+  if (currentQuery->IsScrollable())
+    return InternalFetchScroll(SQL_FETCH_NEXT, 0);
+
+  return FetchRowset();
+}
+
+SqlResult::Type Statement::FetchRowset() {
   // We're fetching a new row, ensure cellOffset is reset.
   cellOffset = 0;
 
   // If columnBindOffset is NULL we want to make sure offsets still
   // have a value, namely a value of 0
   SqlUlen columnBindOffsetValue = columnBindOffset ? *columnBindOffset : 0;
-  for (app::ColumnBindingMap::iterator it = columnBindings.begin();
-    it != columnBindings.end(); ++it)
-    it->second.SetByteOffset(columnBindOffsetValue);
+  columnBindings.SetByteOffset(columnBindOffsetValue);
 
   SqlUlen fetched = 0;
   SqlUlen errors = 0;
 
   LOG_DEBUG_MSG("rowArraySize is " << rowArraySize);
-  for (SqlUlen i = 0; i < rowArraySize; ++i) {
-    for (app::ColumnBindingMap::iterator it = columnBindings.begin();
-      it != columnBindings.end(); ++it) {
-      it->second.SetElementOffset(i);
-    }
+  std::vector< SqlResult::Type > rowResults(rowArraySize);
+  currentQuery->FetchRowset(columnBindings, rowResults);
 
-    SqlResult::Type res = currentQuery->FetchNextRow(columnBindings);
+  for (SqlUlen i = 0; i < rowArraySize; ++i) {
+    SqlResult::Type res = rowResults[i];
 
     if (res == SqlResult::AI_SUCCESS || res == SqlResult::AI_SUCCESS_WITH_INFO)
       ++fetched;
@@ -1193,6 +1614,10 @@ bool Statement::DataAvailable() const {
 }
 
 void Statement::MoreResults() {
+  if (RejectIfAsyncRunning()) {
+    return;
+  }
+
   IGNITE_ODBC_API_CALL(InternalMoreResults());
 }
 
@@ -1210,6 +1635,10 @@ SqlResult::Type Statement::InternalMoreResults() {
 void Statement::GetColumnAttribute(uint16_t colIdx, uint16_t attrId,
                                    SQLWCHAR* strbuf, int16_t buflen,
                                    int16_t* reslen, SqlLen* numbuf) {
+  if (RejectIfAsyncRunning()) {
+    return;
+  }
+
   IGNITE_ODBC_API_CALL(InternalGetColumnAttribute(colIdx, attrId, strbuf,
                                                   buflen, reslen, numbuf));
 }
@@ -1286,6 +1715,10 @@ SqlResult::Type Statement::InternalGetColumnAttribute(
 }
 
 int64_t Statement::AffectedRows() {
+  if (RejectIfAsyncRunning()) {
+    return 0;
+  }
+
   int64_t rowCnt = 0;
 
   IGNITE_ODBC_API_CALL(InternalAffectedRows(rowCnt));
@@ -1322,6 +1755,62 @@ SQLUSMALLINT* Statement::GetRowStatusesPtr() {
   return rowStatuses;
 }
 
+void Statement::AsyncApiCall(SQLUSMALLINT function,
+                             const std::function< SqlResult::Type() >& call) {
+  if (asyncOperation.IsRunning()) {
+    // the records of the operation are not touched until it completes
+    if (function != asyncOperation.GetFunction()) {
+      RejectIfAsyncRunning();
+      return;
+    }
+
+    if (!asyncOperation.IsCompleted()) {
+      asyncOperation.SetPollResult(SqlResult::AI_STILL_EXECUTING);
+      return;
+    }
+
+    SqlResult::Type result = asyncOperation.Collect();
+    if (asyncOperation.IsCancelled()) {
+      if (currentQuery.get()) {
+        currentQuery->Close();
+      }
+      AddStatusRecord(SqlState::SHY008_OPERATION_CANCELED,
+                      "Operation canceled");
+      result = SqlResult::AI_ERROR;
+    }
+    diagnosticRecords.SetHeaderRecord(result);
+    return;
+  }
+
+  {
+    // a query interrupted by the last cancelled operation runs again
+    std::lock_guard< std::mutex > locker(queryMutex);
+    queryInterrupted = false;
+    if (currentQuery.get()) {
+      currentQuery->ClearInterrupt();
+    }
+  }
+
+  if (asyncEnable != SQL_ASYNC_ENABLE_ON) {
+    IGNITE_ODBC_API_CALL(call());
+    return;
+  }
+
+  diagnosticRecords.Reset();
+  asyncOperation.Start(function, call);
+}
+
+bool Statement::RejectIfAsyncRunning() {
+  if (!asyncOperation.IsRunning()) {
+    return false;
+  }
+
+  // the records of the operation are not touched until it completes
+  asyncOperation.SetPollError(SqlState::SHY010_SEQUENCE_ERROR,
+                              "Another function is executing asynchronously.");
+  return true;
+}
+
 uint16_t Statement::SqlResultToRowResult(SqlResult::Type value) {
   LOG_DEBUG_MSG("SqlResultToRowResult is called with value " << value);
   switch (value) {
@@ -1351,6 +1840,10 @@ void Statement::SetARDDesc(Descriptor* desc) {
 
 void Statement::GetCursorName(SQLWCHAR* nameBuf, SQLSMALLINT nameBufLen,
                               SQLSMALLINT* nameResLen) {
+  if (RejectIfAsyncRunning()) {
+    return;
+  }
+
   IGNITE_ODBC_API_CALL(InternalGetCursorName(nameBuf, nameBufLen, nameResLen));
 }
 
@@ -1377,6 +1870,10 @@ SqlResult::Type Statement::InternalGetCursorName(SQLWCHAR* nameBuf,
 }
 
 void Statement::SetCursorName(SQLWCHAR* name, SQLSMALLINT nameLen) {
+  if (RejectIfAsyncRunning()) {
+    return;
+  }
+
   IGNITE_ODBC_API_CALL(InternalSetCursorName(name, nameLen));
 }
 
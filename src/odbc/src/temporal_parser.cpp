@@ -0,0 +1,325 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#include "timestream/odbc/temporal_parser.h"
+
+namespace {
+/** Number of seconds of a day. */
+const int64_t SECONDS_PER_DAY = 86400;
+
+/** Max number of digits of a fraction, nanoseconds. */
+const int FRACTION_DIGITS = 9;
+
+/** Max number of digits of an interval field. */
+const int MAX_FIELD_DIGITS = 9;
+
+/**
+ * Read a number of exactly count digits.
+ *
+ * @param pos Position of the text, moved after the digits on success.
+ * @param end End of the text.
+ * @param count Number of digits.
+ * @param value Value output.
+ * @return True on success.
+ */
+bool ReadDigits(const char*& pos, const char* end, int count,
+                uint32_t& value) {
+  if (end - pos < count) {
+    return false;
+  }
+
+  uint32_t result = 0;
+  for (int i = 0; i < count; i++) {
+    uint32_t digit = static_cast< uint32_t >(pos[i] - '0');
+    if (digit > 9) {
+      return false;
+    }
+    result = result * 10 + digit;
+  }
+
+  pos += count;
+  value = result;
+  return true;
+}
+
+/**
+ * Read a number of 1 to MAX_FIELD_DIGITS digits.
+ *
+ * @param pos Position of the text, moved after the digits on success.
+ * @param end End of the text.
+ * @param value Value output.
+ * @return True on success.
+ */
+bool ReadNumber(const char*& pos, const char* end, uint32_t& value) {
+  const char* begin = pos;
+  uint32_t result = 0;
+  while (pos < end && pos - begin < MAX_FIELD_DIGITS) {
+    uint32_t digit = static_cast< uint32_t >(*pos - '0');
+    if (digit > 9) {
+      break;
+    }
+    result = result * 10 + digit;
+    pos++;
+  }
+
+  value = result;
+  return pos != begin;
+}
+
+/**
+ * Read a character.
+ *
+ * @param pos Position of the text, moved after the character on success.
+ * @param end End of the text.
+ * @param ch Expected character.
+ * @return True if the character is read.
+ */
+bool ReadChar(const char*& pos, const char* end, char ch) {
+  if (pos == end || *pos != ch) {
+    return false;
+  }
+  pos++;
+  return true;
+}
+
+/**
+ * Read an optional fraction of a second ".f" with 1 to 9 digits.
+ *
+ * @param pos Position of the text, moved after the fraction on success.
+ * @param end End of the text.
+ * @param fraction Nanoseconds output, zero if there is no fraction.
+ * @return True on success.
+ */
+bool ReadFraction(const char*& pos, const char* end, int32_t& fraction) {
+  fraction = 0;
+  if (!ReadChar(pos, end, '.')) {
+    return true;
+  }
+
+  int digits = 0;
+  int32_t result = 0;
+  while (pos < end) {
+    uint32_t digit = static_cast< uint32_t >(*pos - '0');
+    if (digit > 9) {
+      break;
+    }
+    if (++digits > FRACTION_DIGITS) {
+      return false;
+    }
+    result = result * 10 + static_cast< int32_t >(digit);
+    pos++;
+  }
+  if (digits == 0) {
+    return false;
+  }
+
+  for (; digits < FRACTION_DIGITS; digits++) {
+    result *= 10;
+  }
+  fraction = result;
+  return true;
+}
+
+/**
+ * Read a time of day "HH:mm:ss".
+ *
+ * @param pos Position of the text, moved after the time on success.
+ * @param end End of the text.
+ * @param hour Hours output.
+ * @param minute Minutes output.
+ * @param second Seconds output.
+ * @return True on success.
+ */
+bool ReadClock(const char*& pos, const char* end, uint32_t& hour,
+               uint32_t& minute, uint32_t& second) {
+  return ReadDigits(pos, end, 2, hour) && ReadChar(pos, end, ':')
+         && ReadDigits(pos, end, 2, minute) && ReadChar(pos, end, ':')
+         && ReadDigits(pos, end, 2, second) && hour < 24 && minute < 60
+         && second < 60;
+}
+
+/**
+ * Read a date "yyyy-MM-dd".
+ *
+ * @param pos Position of the text, moved after the date on success.
+ * @param end End of the text.
+ * @param year Year output.
+ * @param month Month output.
+ * @param day Day output.
+ * @return True on success.
+ */
+bool ReadCalendarDate(const char*& pos, const char* end, uint32_t& year,
+                      uint32_t& month, uint32_t& day) {
+  return ReadDigits(pos, end, 4, year) && ReadChar(pos, end, '-')
+         && ReadDigits(pos, end, 2, month) && ReadChar(pos, end, '-')
+         && ReadDigits(pos, end, 2, day) && month >= 1 && month <= 12
+         && day >= 1 && day <= 31;
+}
+}  // namespace
+
+namespace timestream {
+namespace odbc {
+bool TemporalParser::ParseTimestamp(const char* str, size_t len,
+                                    SQL_TIMESTAMP_STRUCT& value) {
+  const char* pos = str;
+  const char* end = str + len;
+  uint32_t year, month, day, hour, minute, second;
+  int32_t fraction;
+  if (!ReadCalendarDate(pos, end, year, month, day)
+      || !(ReadChar(pos, end, ' ') || ReadChar(pos, end, 'T'))
+      || !ReadClock(pos, end, hour, minute, second)
+      || !ReadFraction(pos, end, fraction) || pos != end) {
+    return false;
+  }
+
+  value.year = static_cast< SQLSMALLINT >(year);
+  value.month = static_cast< SQLUSMALLINT >(month);
+  value.day = static_cast< SQLUSMALLINT >(day);
+  value.hour = static_cast< SQLUSMALLINT >(hour);
+  value.minute = static_cast< SQLUSMALLINT >(minute);
+  value.second = static_cast< SQLUSMALLINT >(second);
+  value.fraction = static_cast< SQLUINTEGER >(fraction);
+  return true;
+}
+
+bool TemporalParser::ParseDate(const char* str, size_t len,
+                               SQL_DATE_STRUCT& value) {
+  const char* pos = str;
+  const char* end = str + len;
+  uint32_t year, month, day;
+  if (!ReadCalendarDate(pos, end, year, month, day) || pos != end) {
+    return false;
+  }
+
+  value.year = static_cast< SQLSMALLINT >(year);
+  value.month = static_cast< SQLUSMALLINT >(month);
+  value.day = static_cast< SQLUSMALLINT >(day);
+  return true;
+}
+
+bool TemporalParser::ParseTime(const char* str, size_t len,
+                               SQL_TIME_STRUCT& value, int32_t& fraction) {
+  const char* pos = str;
+  const char* end = str + len;
+  uint32_t hour, minute, second;
+  if (!ReadClock(pos, end, hour, minute, second)
+      || !ReadFraction(pos, end, fraction) || pos != end) {
+    return false;
+  }
+
+  value.hour = static_cast< SQLUSMALLINT >(hour);
+  value.minute = static_cast< SQLUSMALLINT >(minute);
+  value.second = static_cast< SQLUSMALLINT >(second);
+  return true;
+}
+
+bool TemporalParser::ParseIntervalYearMonth(const char* str, size_t len,
+                                            int32_t& year, int32_t& month) {
+  const char* pos = str;
+  const char* end = str + len;
+  bool negative = ReadChar(pos, end, '-');
+  uint32_t years, months;
+  if (!ReadNumber(pos, end, years) || !ReadChar(pos, end, '-')
+      || !ReadNumber(pos, end, months) || pos != end) {
+    return false;
+  }
+
+  year = negative ? -static_cast< int32_t >(years)
+                  : static_cast< int32_t >(years);
+  month = static_cast< int32_t >(months);
+  return true;
+}
+
+bool TemporalParser::ParseIntervalDaySecond(const char* str, size_t len,
+                                            int32_t& day, int32_t& hour,
+                                            int32_t& minute, int32_t& second,
+                                            int32_t& fraction) {
+  const char* pos = str;
+  const char* end = str + len;
+  bool negative = ReadChar(pos, end, '-');
+  uint32_t days, hours, minutes, seconds;
+  if (!ReadNumber(pos, end, days) || !ReadChar(pos, end, ' ')
+      || !ReadClock(pos, end, hours, minutes, seconds)
+      || !ReadFraction(pos, end, fraction) || pos != end) {
+    return false;
+  }
+
+  day = negative ? -static_cast< int32_t >(days)
+                 : static_cast< int32_t >(days);
+  hour = static_cast< int32_t >(hours);
+  minute = static_cast< int32_t >(minutes);
+  second = static_cast< int32_t >(seconds);
+  return true;
+}
+
+// The civil calendar conversions are the days_from_civil and
+// civil_from_days algorithms of Howard Hinnant, which count days in 400
+// year eras of 146097 days with years starting on March 1st.
+int64_t TemporalParser::DaysFromCivil(int64_t year, uint32_t month,
+                                      uint32_t day) {
+  year -= month <= 2 ? 1 : 0;
+  int64_t era = (year >= 0 ? year : year - 399) / 400;
+  int64_t yearOfEra = year - era * 400;
+  int64_t dayOfYear = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5
+                      + day - 1;
+  int64_t dayOfEra =
+      yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+  return era * 146097 + dayOfEra - 719468;
+}
+
+void TemporalParser::CivilFromDays(int64_t days, int64_t& year,
+                                   uint32_t& month, uint32_t& day) {
+  days += 719468;
+  int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+  int64_t dayOfEra = days - era * 146097;
+  int64_t yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524
+                       - dayOfEra / 146096)
+                      / 365;
+  int64_t dayOfYear =
+      dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+  int64_t monthIdx = (5 * dayOfYear + 2) / 153;
+  day = static_cast< uint32_t >(dayOfYear - (153 * monthIdx + 2) / 5 + 1);
+  month = static_cast< uint32_t >(monthIdx < 10 ? monthIdx + 3 : monthIdx - 9);
+  year = yearOfEra + era * 400 + (month <= 2 ? 1 : 0);
+}
+
+int64_t TemporalParser::ToEpochSeconds(const SQL_TIMESTAMP_STRUCT& value) {
+  int64_t days = DaysFromCivil(value.year, value.month, value.day);
+  return days * SECONDS_PER_DAY + value.hour * 3600 + value.minute * 60
+         + value.second;
+}
+
+void TemporalParser::FromEpochSeconds(int64_t seconds,
+                                      SQL_TIMESTAMP_STRUCT& value) {
+  int64_t days = seconds / SECONDS_PER_DAY;
+  int64_t secondOfDay = seconds % SECONDS_PER_DAY;
+  if (secondOfDay < 0) {
+    secondOfDay += SECONDS_PER_DAY;
+    days--;
+  }
+
+  int64_t year;
+  uint32_t month, day;
+  CivilFromDays(days, year, month, day);
+  value.year = static_cast< SQLSMALLINT >(year);
+  value.month = static_cast< SQLUSMALLINT >(month);
+  value.day = static_cast< SQLUSMALLINT >(day);
+  value.hour = static_cast< SQLUSMALLINT >(secondOfDay / 3600);
+  value.minute = static_cast< SQLUSMALLINT >(secondOfDay / 60 % 60);
+  value.second = static_cast< SQLUSMALLINT >(secondOfDay % 60);
+}
+}  // namespace odbc
+}  // namespace timestream
@@ -18,10 +18,9 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
-#include <chrono>
-#include <ctime>
-#include <time.h>
 #include "timestream/odbc/timestream_column.h"
+#include "timestream/odbc/number_parser.h"
+#include "timestream/odbc/temporal_parser.h"
 #include "timestream/odbc/utility.h"
 #include <aws/timestream-query/model/ColumnInfo.h>
 #include <aws/timestream-query/model/TimeSeriesDataPoint.h>
@@ -32,7 +31,17 @@ using timestream::odbc::type_traits::OdbcNativeType;
 
 namespace timestream {
 namespace odbc {
-#define BUFFER_SIZE 1024
+/**
+ * Capacity of the nested value text which is kept for the next value of
+ * the thread. A larger text is released after it is copied.
+ */
+#define MAX_RETAINED_NESTED_TEXT (1024 * 1024)
+
+/** Length of a canonical TIMESTAMP text "yyyy-MM-dd HH:mm:ss.SSSSSSSSS". */
+#define TIMESTAMP_TEXT_LEN 29
+
+/** Length of a canonical TIME text "HH:mm:ss.SSSSSSSSS". */
+#define TIME_TEXT_LEN 18
 
 TimestreamColumn::TimestreamColumn(
                                    uint32_t columnIdx,
@@ -85,7 +94,7 @@ ConversionResult::Type TimestreamColumn::ParseScalarType(
     ApplicationDataBuffer& dataBuf) const {
   LOG_DEBUG_MSG("ParseScalarType is called");
 
-  Aws::String value = datum.GetScalarValue();
+  const Aws::String& value = datum.GetScalarValue();
   LOG_DEBUG_MSG("value is " << value << ", scalar type is "
                             << static_cast< int >(columnMeta_.GetScalarType()));
 
@@ -95,89 +104,81 @@ ConversionResult::Type TimestreamColumn::ParseScalarType(
     case ScalarType::VARCHAR:
       convRes = dataBuf.PutString(value);
       break;
-    case ScalarType::DOUBLE:
-      // There could be a precision problem for stod as double can not be
-      // represented in binary form using finite precision. For example for
-      // double value 35.2 in string, std::stod("35.2") could
-      // return 35.200000000000003 on Windows. These rounding errors are a
-      // common issue in floating-point arithmetic and can not be avoided.
-      convRes = dataBuf.PutDouble(std::stod(value));
+    case ScalarType::DOUBLE: {
+      double doubleValue;
+      if (!NumberParser::ParseDouble(value.c_str(), value.size(),
+                                     doubleValue)) {
+        LOG_ERROR_MSG("Invalid double " << value);
+        return ConversionResult::Type::AI_FAILURE;
+      }
+      convRes = dataBuf.PutDouble(doubleValue);
       break;
+    }
     case ScalarType::BOOLEAN:
       convRes = dataBuf.PutInt8(value == "true" ? 1 : 0);
       break;
-    case ScalarType::INTEGER:
-      convRes = dataBuf.PutInt32(utility::StringToInt(value));
+    case ScalarType::INTEGER: {
+      int32_t intValue;
+      if (!NumberParser::ParseInt32(value.c_str(), value.size(), intValue)) {
+        LOG_ERROR_MSG("Invalid integer " << value);
+        return ConversionResult::Type::AI_FAILURE;
+      }
+      convRes = dataBuf.PutInt32(intValue);
       break;
-    case ScalarType::BIGINT:
-      convRes = dataBuf.PutInt64(utility::StringToLong(value));
+    }
+    case ScalarType::BIGINT: {
+      int64_t bigintValue;
+      if (!NumberParser::ParseInt64(value.c_str(), value.size(),
+                                    bigintValue)) {
+        LOG_ERROR_MSG("Invalid bigint " << value);
+        return ConversionResult::Type::AI_FAILURE;
+      }
+      convRes = dataBuf.PutInt64(bigintValue);
       break;
+    }
     case ScalarType::NOT_SET:
     case ScalarType::UNKNOWN:
       convRes = dataBuf.PutNull();
       break;
-    case ScalarType::TIMESTAMP: {
-      tm tmTime;
-      memset(&tmTime, 0, sizeof(tm));
-      int32_t fractionNs;
-      std::sscanf(value.c_str(), "%4d-%2d-%2d %2d:%2d:%2d.%9d", &tmTime.tm_year,
-                  &tmTime.tm_mon, &tmTime.tm_mday, &tmTime.tm_hour,
-                  &tmTime.tm_min, &tmTime.tm_sec, &fractionNs);
-      tmTime.tm_year -= 1900;
-      tmTime.tm_mon--;
-#ifdef _WIN32
-      int64_t seconds = _mkgmtime(&tmTime);
-#else
-      int64_t seconds = timegm(&tmTime);
-#endif
-      LOG_DEBUG_MSG("timestamp is " << tmTime.tm_year << " " << tmTime.tm_mon
-                                    << " " << tmTime.tm_mday << " "
-                                    << tmTime.tm_hour << ":" << tmTime.tm_min
-                                    << ":" << tmTime.tm_sec << "."
-                                    << fractionNs);
-
-      LOG_DEBUG_MSG("seconds is " << seconds);
-      convRes = dataBuf.PutTimestamp(Timestamp(seconds, fractionNs));
+    case ScalarType::TIMESTAMP:
+      if (IsTemporalText(dataBuf)) {
+        convRes = PutTemporalText(value, dataBuf);
+        break;
+      }
+      convRes = dataBuf.PutTimestamp(ParseTimestamp(value));
       break;
-    }
-    case ScalarType::DATE: {
-      tm tmTime;
-      memset(&tmTime, 0, sizeof(tm));
-      int32_t fractionNs;
-      std::sscanf(value.c_str(), "%4d-%2d-%2d", &tmTime.tm_year, &tmTime.tm_mon,
-                  &tmTime.tm_mday);
-      tmTime.tm_year -= 1900;
-      tmTime.tm_mon--;
-#ifdef _WIN32
-      int64_t milliSecond = _mkgmtime(&tmTime) * 1000;
-#else
-      int64_t milliSecond = timegm(&tmTime);
-      milliSecond *= 1000;
-#endif
-      convRes = dataBuf.PutDate(Date(milliSecond));
+    case ScalarType::DATE:
+      if (IsTemporalText(dataBuf)) {
+        convRes = PutTemporalText(value, dataBuf);
+        break;
+      }
+      convRes = dataBuf.PutDate(ParseDate(value));
       break;
-    }
-    case ScalarType::TIME: {
-      uint32_t hour;
-      uint32_t minute;
-      uint32_t second;
-      int32_t fractionNs;
-      std::sscanf(value.c_str(), "%2d:%2d:%2d.%9d", &hour, &minute, &second,
-                  &fractionNs);
-      int32_t secondValue = (hour * 60 + minute) * 60 + second;
-      convRes = dataBuf.PutTime(Time(secondValue, fractionNs));
+    case ScalarType::TIME:
+      if (IsTemporalText(dataBuf)) {
+        convRes = PutTemporalText(value, dataBuf);
+        break;
+      }
+      convRes = dataBuf.PutTime(ParseTime(value));
       break;
-    }
     case ScalarType::INTERVAL_YEAR_TO_MONTH: {
       int32_t year, month;
-      std::sscanf(value.c_str(), "%d-%d", &year, &month);
+      if (!TemporalParser::ParseIntervalYearMonth(value.c_str(), value.size(),
+                                                  year, month)) {
+        LOG_ERROR_MSG("Invalid year to month interval " << value);
+        return ConversionResult::Type::AI_FAILURE;
+      }
       convRes = dataBuf.PutInterval(IntervalYearMonth(year, month));
       break;
     }
     case ScalarType::INTERVAL_DAY_TO_SECOND: {
       int32_t day, hour, minute, second, fraction;
-      std::sscanf(value.c_str(), "%d %2d:%2d:%2d.%9d", &day, &hour, &minute,
-                  &second, &fraction);
+      if (!TemporalParser::ParseIntervalDaySecond(value.c_str(), value.size(),
+                                                  day, hour, minute, second,
+                                                  fraction)) {
+        LOG_ERROR_MSG("Invalid day to second interval " << value);
+        return ConversionResult::Type::AI_FAILURE;
+      }
       convRes = dataBuf.PutInterval(
           IntervalDaySecond(day, hour, minute, second, fraction));
       break;
@@ -190,39 +191,94 @@ ConversionResult::Type TimestreamColumn::ParseScalarType(
   return convRes;
 }
 
-ConversionResult::Type TimestreamColumn::ParseTimeSeriesType(
-    const Datum& datum, ApplicationDataBuffer& dataBuf) const {
-  LOG_DEBUG_MSG("ParseTimeSeriesType is called");
-
-  const Aws::Vector< TimeSeriesDataPoint >& valueVec =
-      datum.GetTimeSeriesValue();
+bool TimestreamColumn::IsTemporalText(
+    const ApplicationDataBuffer& dataBuf) const {
+  switch (columnMeta_.GetScalarType()) {
+    case ScalarType::TIMESTAMP:
+    case ScalarType::DATE:
+    case ScalarType::TIME:
+      return dataBuf.GetType() == OdbcNativeType::Type::AI_CHAR
+             || dataBuf.GetType() == OdbcNativeType::Type::AI_WCHAR;
+    default:
+      return false;
+  }
+}
 
-  std::string result = "[";
-  for (const auto& itr : valueVec) {
-    result += "{time: ";
-    if (itr.TimeHasBeenSet()) {
-      result += itr.GetTime();
+ConversionResult::Type TimestreamColumn::PutTemporalText(
+    const Aws::String& value, ApplicationDataBuffer& dataBuf) const {
+  // Timestream returns the canonical formats, which are copied as they are.
+  // Other valid values are reformatted from their fields, and the text of
+  // an invalid value is copied as it is.
+  char text[32];
+  int len = -1;
+  ScalarType type = columnMeta_.GetScalarType();
+  if (type == ScalarType::TIMESTAMP
+      && (value.size() != TIMESTAMP_TEXT_LEN || value[10] != ' ')) {
+    SQL_TIMESTAMP_STRUCT ts{};
+    if (TemporalParser::ParseTimestamp(value.c_str(), value.size(), ts)) {
+      len = snprintf(text, sizeof(text), "%04d-%02d-%02d %02d:%02d:%02d.%09d",
+                     ts.year, ts.month, ts.day, ts.hour, ts.minute, ts.second,
+                     static_cast< int >(ts.fraction));
     }
-    result += ", value: ";
-
-    if (itr.ValueHasBeenSet()) {
-      char buf[BUFFER_SIZE]{};
-      SqlLen resLen;
-      ApplicationDataBuffer tmpBuf(OdbcNativeType::Type::AI_CHAR,
-                                   static_cast< void* >(buf), BUFFER_SIZE,
-                                   &resLen);
-      ParseDatum(itr.GetValue(), tmpBuf);
-      result += buf;
+  } else if (type == ScalarType::TIME && value.size() != TIME_TEXT_LEN) {
+    SQL_TIME_STRUCT time{};
+    int32_t fraction = 0;
+    if (TemporalParser::ParseTime(value.c_str(), value.size(), time,
+                                  fraction)) {
+      len = snprintf(text, sizeof(text), "%02d:%02d:%02d.%09d", time.hour,
+                     time.minute, time.second, fraction);
     }
+  }
+
+  if (len < 0) {
+    return dataBuf.PutString(value);
+  }
+  return dataBuf.PutString(std::string(text, len));
+}
 
-    result += "},";
+Timestamp TimestreamColumn::ParseTimestamp(const Aws::String& value) {
+  SQL_TIMESTAMP_STRUCT timestamp{};
+  if (!TemporalParser::ParseTimestamp(value.c_str(), value.size(),
+                                      timestamp)) {
+    LOG_ERROR_MSG("Invalid timestamp " << value);
+    return Timestamp();
   }
-  if (!valueVec.empty()) {
-    result.pop_back();
+
+  return Timestamp(TemporalParser::ToEpochSeconds(timestamp),
+                   static_cast< int32_t >(timestamp.fraction));
+}
+
+Date TimestreamColumn::ParseDate(const Aws::String& value) {
+  SQL_DATE_STRUCT date{};
+  if (!TemporalParser::ParseDate(value.c_str(), value.size(), date)) {
+    LOG_ERROR_MSG("Invalid date " << value);
+    return Date();
   }
-  result += "]";
 
-  ConversionResult::Type convRes = dataBuf.PutString(result);
+  int64_t days = TemporalParser::DaysFromCivil(date.year, date.month, date.day);
+  return Date(days * 86400 * 1000);
+}
+
+Time TimestreamColumn::ParseTime(const Aws::String& value) {
+  SQL_TIME_STRUCT time{};
+  int32_t fractionNs = 0;
+  if (!TemporalParser::ParseTime(value.c_str(), value.size(), time,
+                                 fractionNs)) {
+    LOG_ERROR_MSG("Invalid time " << value);
+    return Time();
+  }
+
+  int32_t secondValue = (time.hour * 60 + time.minute) * 60 + time.second;
+  return Time(secondValue, fractionNs);
+}
+
+ConversionResult::Type TimestreamColumn::ParseTimeSeriesType(
+    const Datum& datum, ApplicationDataBuffer& dataBuf) const {
+  LOG_DEBUG_MSG("ParseTimeSeriesType is called");
+
+  std::string& text = GetNestedText();
+  AppendTimeSeries(datum, text);
+  ConversionResult::Type convRes = PutNestedText(text, dataBuf);
 
   LOG_DEBUG_MSG("convRes is " << static_cast< int >(convRes));
   return convRes;
@@ -232,29 +288,9 @@ ConversionResult::Type TimestreamColumn::ParseArrayType(
     const Datum& datum, ApplicationDataBuffer& dataBuf) const {
   LOG_DEBUG_MSG("ParseArrayType is called");
 
-  const Aws::Vector< Datum >& valueVec = datum.GetArrayValue();
-
-  std::string result("");
-  if (valueVec.empty()) {
-    result = "";
-  } else {
-    result = "[";
-    for (const auto& itr : valueVec) {
-      char buf[BUFFER_SIZE]{};
-      SqlLen resLen;
-      ApplicationDataBuffer tmpBuf(OdbcNativeType::Type::AI_CHAR,
-                                   static_cast< void* >(buf), BUFFER_SIZE,
-                                   &resLen);
-      ParseDatum(itr, tmpBuf);
-      result += buf;
-
-      result += ",";
-    }
-    result.pop_back();
-    result += "]";
-  }
-
-  ConversionResult::Type convRes = dataBuf.PutString(result);
+  std::string& text = GetNestedText();
+  AppendArray(datum, text);
+  ConversionResult::Type convRes = PutNestedText(text, dataBuf);
 
   LOG_DEBUG_MSG("convRes is " << static_cast< int >(convRes));
   return convRes;
@@ -264,35 +300,108 @@ ConversionResult::Type TimestreamColumn::ParseRowType(
     const Datum& datum, ApplicationDataBuffer& dataBuf) const {
   LOG_DEBUG_MSG("ParseRowType is called");
 
-  const Row& row = datum.GetRowValue();
-
-  if (!row.DataHasBeenSet()) {
+  if (!datum.GetRowValue().DataHasBeenSet()) {
     LOG_DEBUG_MSG("No data is set for the row");
     return ConversionResult::Type::AI_NO_DATA;
   }
 
-  const Aws::Vector< Datum >& valueVec = row.GetData();
-  std::string result = "(";
-  for (const auto& itr : valueVec) {
-    char buf[BUFFER_SIZE]{};
-    SqlLen resLen;
-    ApplicationDataBuffer tmpBuf(OdbcNativeType::Type::AI_CHAR,
-                                 static_cast< void* >(buf), BUFFER_SIZE,
-                                 &resLen);
-    ParseDatum(itr, tmpBuf);
-    result += buf;
-
-    result += ",";
+  std::string& text = GetNestedText();
+  AppendRow(datum, text);
+  ConversionResult::Type convRes = PutNestedText(text, dataBuf);
+
+  LOG_DEBUG_MSG("convRes is " << static_cast< int >(convRes));
+  return convRes;
+}
+
+std::string& TimestreamColumn::GetNestedText() {
+  thread_local std::string text;
+  text.clear();
+  return text;
+}
+
+ConversionResult::Type TimestreamColumn::PutNestedText(
+    std::string& text, ApplicationDataBuffer& dataBuf) {
+  ConversionResult::Type convRes = dataBuf.PutString(text);
+
+  // the capacity is kept for the next value unless it is exceptionally large
+  if (text.capacity() > MAX_RETAINED_NESTED_TEXT) {
+    std::string().swap(text);
+  }
+  return convRes;
+}
+
+void TimestreamColumn::AppendDatum(const Datum& datum, std::string& text) {
+  if (datum.ScalarValueHasBeenSet()) {
+    // nested values are read as VARCHAR, so their text is copied as it is
+    const Aws::String& value = datum.GetScalarValue();
+    text.append(value.data(), value.size());
+  } else if (datum.TimeSeriesValueHasBeenSet()) {
+    AppendTimeSeries(datum, text);
+  } else if (datum.ArrayValueHasBeenSet()) {
+    AppendArray(datum, text);
+  } else if (datum.RowValueHasBeenSet()) {
+    if (datum.GetRowValue().DataHasBeenSet()) {
+      AppendRow(datum, text);
+    }
+  } else if (!datum.NullValueHasBeenSet()) {
+    LOG_ERROR_MSG("Unsupported data type");
+  }
+}
+
+void TimestreamColumn::AppendTimeSeries(const Datum& datum,
+                                        std::string& text) {
+  const Aws::Vector< TimeSeriesDataPoint >& valueVec =
+      datum.GetTimeSeriesValue();
+
+  text += '[';
+  for (size_t i = 0; i < valueVec.size(); ++i) {
+    const TimeSeriesDataPoint& point = valueVec[i];
+    if (i > 0) {
+      text += ',';
+    }
+    text += "{time: ";
+    if (point.TimeHasBeenSet()) {
+      const Aws::String& time = point.GetTime();
+      text.append(time.data(), time.size());
+    }
+    text += ", value: ";
+    if (point.ValueHasBeenSet()) {
+      AppendDatum(point.GetValue(), text);
+    }
+    text += '}';
   }
-  if (!valueVec.empty()) {
-    result.pop_back();
+  text += ']';
+}
+
+void TimestreamColumn::AppendArray(const Datum& datum, std::string& text) {
+  const Aws::Vector< Datum >& valueVec = datum.GetArrayValue();
+
+  // an empty array is an empty text
+  if (valueVec.empty()) {
+    return;
+  }
+
+  text += '[';
+  for (size_t i = 0; i < valueVec.size(); ++i) {
+    if (i > 0) {
+      text += ',';
+    }
+    AppendDatum(valueVec[i], text);
   }
-  result += ")";
+  text += ']';
+}
 
-  ConversionResult::Type convRes = dataBuf.PutString(result);
+void TimestreamColumn::AppendRow(const Datum& datum, std::string& text) {
+  const Aws::Vector< Datum >& valueVec = datum.GetRowValue().GetData();
 
-  LOG_DEBUG_MSG("convRes is " << static_cast< int >(convRes));
-  return convRes;
+  text += '(';
+  for (size_t i = 0; i < valueVec.size(); ++i) {
+    if (i > 0) {
+      text += ',';
+    }
+    AppendDatum(valueVec[i], text);
+  }
+  text += ')';
 }
 }  // namespace odbc
 }  // namespace timestream
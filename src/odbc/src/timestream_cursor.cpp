@@ -20,12 +20,17 @@
 
 #include "timestream/odbc/timestream_cursor.h"
 
+#include <algorithm>
+
 namespace timestream {
 namespace odbc {
 TimestreamCursor::TimestreamCursor(
-    const Aws::Vector< Row > rowVec,
-    const meta::ColumnMetaVector& columnMetadataVec)
-    : rowVec_(rowVec),
+    std::shared_ptr< const QueryResult > page,
+    const meta::ColumnMetaVector& columnMetadataVec,
+    std::shared_ptr< const ColumnarPage > columnar)
+    : page_(std::move(page)),
+      rowVec_(page_->GetRows()),
+      columnar_(std::move(columnar)),
       iterator_(rowVec_.begin()),
       columnMetadataVec_(columnMetadataVec),
       curPos_(0) {
@@ -47,12 +52,48 @@ bool TimestreamCursor::Increment() {
   return curPos_ <= rowVec_.size();
 }
 
+void TimestreamCursor::SetPosition(size_t rowIdx) {
+  LOG_DEBUG_MSG("SetPosition is called with " << rowIdx);
+
+  rowIdx = std::min(rowIdx, rowVec_.size());
+  iterator_ = rowVec_.begin() + rowIdx;
+  curPos_ = static_cast< int >(rowIdx) + 1;
+}
+
 bool TimestreamCursor::HasData() const {
   return curPos_ <= rowVec_.size();
 }
 
 app::ConversionResult::Type TimestreamCursor::ReadColumnToBuffer(
     uint32_t columnIdx, app::ApplicationDataBuffer& dataBuf) {
+  return ReadColumnToBuffer(columnIdx, dataBuf, ConversionPlan());
+}
+
+app::ConversionResult::Type TimestreamCursor::ReadColumnToBuffer(
+    uint32_t columnIdx, app::ApplicationDataBuffer& dataBuf,
+    const ConversionPlan& plan) {
+  // the cursor is before the first row until it is incremented
+  if (curPos_ < 1) {
+    LOG_ERROR_MSG("Cursor is not positioned on a row");
+    return app::ConversionResult::Type::AI_FAILURE;
+  }
+  return ReadColumnToBuffer(columnIdx, static_cast< size_t >(curPos_ - 1),
+                            dataBuf, plan);
+}
+
+app::ConversionResult::Type TimestreamCursor::ReadColumnToBuffer(
+    uint32_t columnIdx, size_t rowIdx, app::ApplicationDataBuffer& dataBuf,
+    const ConversionPlan& plan) {
+  if (rowIdx >= rowVec_.size()) {
+    LOG_ERROR_MSG("Row index " << rowIdx << " is out of range");
+    return app::ConversionResult::Type::AI_FAILURE;
+  }
+
+  ConversionPlan::Converter converter = plan.GetConverter();
+  if (converter && columnar_ && columnar_->IsDecoded(columnIdx)) {
+    return converter(*columnar_, columnIdx, rowIdx, dataBuf);
+  }
+
   LOG_DEBUG_MSG("ReadColumnToBuffer is called");
   if (!EnsureColumnDiscovered(columnIdx)) {
     LOG_ERROR_MSG("columnIdx could not be discovered for index " << columnIdx);
@@ -60,8 +101,19 @@ app::ConversionResult::Type TimestreamCursor::ReadColumnToBuffer(
   }
 
   TimestreamColumn& column = GetColumn(columnIdx);
-  const Datum& datum = iterator_->GetData()[columnIdx-1];
-  return column.ReadToBuffer(datum, dataBuf);
+  // temporal values read as text are copied from the datum text
+  if (columnar_ && columnar_->IsDecoded(columnIdx)
+      && !column.IsTemporalText(dataBuf)) {
+    return columnar_->ReadToBuffer(columnIdx, rowIdx, dataBuf);
+  }
+
+  const Aws::Vector< Datum >& data = rowVec_[rowIdx].GetData();
+  if (columnIdx > data.size()) {
+    LOG_ERROR_MSG("Row " << rowIdx << " has no value for column "
+                         << columnIdx);
+    return app::ConversionResult::Type::AI_FAILURE;
+  }
+  return column.ReadToBuffer(data[columnIdx - 1], dataBuf);
 }
 
 bool TimestreamCursor::EnsureColumnDiscovered(uint32_t columnIdx) {
@@ -60,6 +60,9 @@ const char* StatementAttrIdToString(long id) {
     DBG_STR_CASE(SQL_ATTR_APP_PARAM_DESC);
     DBG_STR_CASE(SQL_ATTR_APP_ROW_DESC);
     DBG_STR_CASE(SQL_ATTR_ASYNC_ENABLE);
+    DBG_STR_CASE(SQL_ATTR_ASYNC_STMT_EVENT);
+    DBG_STR_CASE(SQL_ATTR_ASYNC_STMT_NOTIFICATION_CALLBACK);
+    DBG_STR_CASE(SQL_ATTR_ASYNC_STMT_NOTIFICATION_CONTEXT);
     DBG_STR_CASE(SQL_ATTR_CONCURRENCY);
     DBG_STR_CASE(SQL_ATTR_CURSOR_SCROLLABLE);
     DBG_STR_CASE(SQL_ATTR_CURSOR_SENSITIVITY);
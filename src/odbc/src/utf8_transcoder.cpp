@@ -0,0 +1,305 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#include "timestream/odbc/utf8_transcoder.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
+#include <limits>
+
+#if defined(__SSE2__) || defined(_M_X64) \
+    || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define TIMESTREAM_UTF8_SSE2
+#include <emmintrin.h>
+#endif
+
+using timestream::odbc::Utf8Transcoder;
+
+namespace {
+/** Number of bytes checked and widened by a step of the ASCII fast path. */
+const size_t ASCII_BLOCK_LEN = 16;
+
+/**
+ * Check if a block of ASCII_BLOCK_LEN bytes is ASCII.
+ *
+ * @param in Block.
+ * @return True if all bytes are ASCII.
+ */
+inline bool IsAsciiBlock(const char* in) {
+#ifdef TIMESTREAM_UTF8_SSE2
+  __m128i v = _mm_loadu_si128(reinterpret_cast< const __m128i* >(in));
+  return _mm_movemask_epi8(v) == 0;
+#else
+  uint64_t lo;
+  uint64_t hi;
+  memcpy(&lo, in, sizeof(lo));
+  memcpy(&hi, in + sizeof(lo), sizeof(hi));
+  return ((lo | hi) & 0x8080808080808080ULL) == 0;
+#endif
+}
+
+/**
+ * Widen a block of ASCII_BLOCK_LEN bytes to UTF-16 if it is ASCII.
+ *
+ * @param in Block.
+ * @param out Output with room for ASCII_BLOCK_LEN code units.
+ * @return True if the block is ASCII and is widened.
+ */
+inline bool WidenAsciiBlock(const char* in, char16_t* out) {
+#ifdef TIMESTREAM_UTF8_SSE2
+  __m128i v = _mm_loadu_si128(reinterpret_cast< const __m128i* >(in));
+  if (_mm_movemask_epi8(v) != 0) {
+    return false;
+  }
+  __m128i zero = _mm_setzero_si128();
+  _mm_storeu_si128(reinterpret_cast< __m128i* >(out),
+                   _mm_unpacklo_epi8(v, zero));
+  _mm_storeu_si128(reinterpret_cast< __m128i* >(out + 8),
+                   _mm_unpackhi_epi8(v, zero));
+  return true;
+#else
+  if (!IsAsciiBlock(in)) {
+    return false;
+  }
+  std::copy(in, in + ASCII_BLOCK_LEN, out);
+  return true;
+#endif
+}
+
+/**
+ * Widen a block of ASCII_BLOCK_LEN bytes to UTF-32 if it is ASCII.
+ *
+ * @param in Block.
+ * @param out Output with room for ASCII_BLOCK_LEN code units.
+ * @return True if the block is ASCII and is widened.
+ */
+inline bool WidenAsciiBlock(const char* in, char32_t* out) {
+#ifdef TIMESTREAM_UTF8_SSE2
+  __m128i v = _mm_loadu_si128(reinterpret_cast< const __m128i* >(in));
+  if (_mm_movemask_epi8(v) != 0) {
+    return false;
+  }
+  __m128i zero = _mm_setzero_si128();
+  __m128i lo = _mm_unpacklo_epi8(v, zero);
+  __m128i hi = _mm_unpackhi_epi8(v, zero);
+  __m128i* dst = reinterpret_cast< __m128i* >(out);
+  _mm_storeu_si128(dst, _mm_unpacklo_epi16(lo, zero));
+  _mm_storeu_si128(dst + 1, _mm_unpackhi_epi16(lo, zero));
+  _mm_storeu_si128(dst + 2, _mm_unpacklo_epi16(hi, zero));
+  _mm_storeu_si128(dst + 3, _mm_unpackhi_epi16(hi, zero));
+  return true;
+#else
+  if (!IsAsciiBlock(in)) {
+    return false;
+  }
+  std::copy(in, in + ASCII_BLOCK_LEN, out);
+  return true;
+#endif
+}
+
+/**
+ * Decode one UTF-8 sequence.
+ *
+ * @param in Text.
+ * @param len Length of the text in bytes, not 0.
+ * @param cp Code point output.
+ * @return Length of the sequence in bytes, 0 if it is invalid or
+ * incomplete.
+ */
+inline size_t DecodeSequence(const unsigned char* in, size_t len,
+                             uint32_t& cp) {
+  unsigned char lead = in[0];
+  if (lead < 0x80) {
+    cp = lead;
+    return 1;
+  }
+
+  size_t seqLen;
+  uint32_t minCp;
+  if ((lead & 0xE0) == 0xC0) {
+    seqLen = 2;
+    minCp = 0x80;
+    cp = lead & 0x1F;
+  } else if ((lead & 0xF0) == 0xE0) {
+    seqLen = 3;
+    minCp = 0x800;
+    cp = lead & 0x0F;
+  } else if ((lead & 0xF8) == 0xF0) {
+    seqLen = 4;
+    minCp = 0x10000;
+    cp = lead & 0x07;
+  } else {
+    return 0;
+  }
+
+  if (len < seqLen) {
+    return 0;
+  }
+
+  for (size_t i = 1; i < seqLen; ++i) {
+    if ((in[i] & 0xC0) != 0x80) {
+      return 0;
+    }
+    cp = (cp << 6) | (in[i] & 0x3F);
+  }
+
+  if (cp < minCp || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF)) {
+    return 0;
+  }
+  return seqLen;
+}
+
+/**
+ * Number of UTF-16 code units of a code point.
+ */
+inline size_t CodeUnits(uint32_t cp, const char16_t*) {
+  return cp < 0x10000 ? 1 : 2;
+}
+
+/**
+ * Number of UTF-32 code units of a code point.
+ */
+inline size_t CodeUnits(uint32_t, const char32_t*) {
+  return 1;
+}
+
+/**
+ * Encode a code point to UTF-16.
+ */
+inline void Encode(uint32_t cp, char16_t* out) {
+  if (cp < 0x10000) {
+    out[0] = static_cast< char16_t >(cp);
+  } else {
+    cp -= 0x10000;
+    out[0] = static_cast< char16_t >(0xD800 + (cp >> 10));
+    out[1] = static_cast< char16_t >(0xDC00 + (cp & 0x3FF));
+  }
+}
+
+/**
+ * Encode a code point to UTF-32.
+ */
+inline void Encode(uint32_t cp, char32_t* out) {
+  out[0] = static_cast< char32_t >(cp);
+}
+
+/**
+ * Transcode UTF-8 text. If the output is null, the code units are counted
+ * only.
+ *
+ * @param in UTF-8 text.
+ * @param inLen Length of the text in bytes.
+ * @param out Output buffer, could be null.
+ * @param outLen Length of the output buffer in code units.
+ * @return Result.
+ */
+template < typename OutCharT, bool Vectorized >
+Utf8Transcoder::Result TranscodeUtf8(const char* in, size_t inLen,
+                                     OutCharT* out, size_t outLen) {
+  Utf8Transcoder::Result res = {0, 0, false};
+  const unsigned char* bytes = reinterpret_cast< const unsigned char* >(in);
+  if (!out) {
+    outLen = std::numeric_limits< size_t >::max();
+  }
+
+  while (res.read < inLen) {
+    size_t stop = inLen;
+    if (Vectorized) {
+      while (inLen - res.read >= ASCII_BLOCK_LEN
+             && outLen - res.written >= ASCII_BLOCK_LEN
+             && (out ? WidenAsciiBlock(in + res.read, out + res.written)
+                     : IsAsciiBlock(in + res.read))) {
+        res.read += ASCII_BLOCK_LEN;
+        res.written += ASCII_BLOCK_LEN;
+      }
+      // the next block has a non-ASCII byte or is incomplete, so it is
+      // decoded one character at a time before the fast path is tried again
+      stop = std::min(inLen, res.read + ASCII_BLOCK_LEN);
+    }
+
+    while (res.read < stop) {
+      uint32_t cp;
+      size_t seqLen = DecodeSequence(bytes + res.read, inLen - res.read, cp);
+      if (seqLen == 0) {
+        res.invalid = true;
+        return res;
+      }
+
+      size_t units = CodeUnits(cp, out);
+      if (outLen - res.written < units) {
+        return res;
+      }
+      if (out) {
+        Encode(cp, out + res.written);
+      }
+      res.read += seqLen;
+      res.written += units;
+    }
+  }
+  return res;
+}
+}  // namespace
+
+namespace timestream {
+namespace odbc {
+Utf8Transcoder::Result Utf8Transcoder::Transcode(const char* in, size_t inLen,
+                                                 char16_t* out,
+                                                 size_t outLen) {
+  return TranscodeUtf8< char16_t, true >(in, inLen, out, outLen);
+}
+
+Utf8Transcoder::Result Utf8Transcoder::Transcode(const char* in, size_t inLen,
+                                                 char32_t* out,
+                                                 size_t outLen) {
+  return TranscodeUtf8< char32_t, true >(in, inLen, out, outLen);
+}
+
+Utf8Transcoder::Result Utf8Transcoder::TranscodeScalar(const char* in,
+                                                       size_t inLen,
+                                                       char16_t* out,
+                                                       size_t outLen) {
+  return TranscodeUtf8< char16_t, false >(in, inLen, out, outLen);
+}
+
+Utf8Transcoder::Result Utf8Transcoder::TranscodeScalar(const char* in,
+                                                       size_t inLen,
+                                                       char32_t* out,
+                                                       size_t outLen) {
+  return TranscodeUtf8< char32_t, false >(in, inLen, out, outLen);
+}
+
+size_t Utf8Transcoder::CountUtf16(const char* in, size_t inLen) {
+  return TranscodeUtf8< char16_t, true >(in, inLen, nullptr, 0).written;
+}
+
+size_t Utf8Transcoder::CountUtf32(const char* in, size_t inLen) {
+  return TranscodeUtf8< char32_t, true >(in, inLen, nullptr, 0).written;
+}
+
+size_t Utf8Transcoder::AsciiPrefixLength(const char* in, size_t inLen) {
+  size_t len = 0;
+  while (inLen - len >= ASCII_BLOCK_LEN && IsAsciiBlock(in + len)) {
+    len += ASCII_BLOCK_LEN;
+  }
+  while (len < inLen && static_cast< unsigned char >(in[len]) < 0x80) {
+    ++len;
+  }
+  return len;
+}
+}  // namespace odbc
+}  // namespace timestream
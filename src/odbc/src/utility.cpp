@@ -21,10 +21,12 @@
 #include "timestream/odbc/utility.h"
 
 #include <codecvt>
+#include <locale>
 #include <regex>
 #include <iomanip>
 
 #include "timestream/odbc/system/odbc_constants.h"
+#include "timestream/odbc/utf8_transcoder.h"
 #include "timestream/odbc/log.h"
 
 namespace timestream {
@@ -32,6 +34,23 @@ namespace odbc {
 namespace utility {
 using namespace ignite::odbc::common;
 
+namespace {
+/**
+ * Get the wide character classification facet of the user's locale. The
+ * locale is constructed once per process, as constructing it for every
+ * string cell is costly.
+ *
+ * @return Facet.
+ */
+const std::ctype< wchar_t >& GetUserCtype() {
+  static const std::locale userLocale("");
+  static const std::ctype< wchar_t >& userCtype =
+      std::use_facet< std::ctype< wchar_t > >(userLocale);
+  return userCtype;
+}
+}  // namespace
+
+
 size_t CopyUtf8StringToSqlCharString(const char* inBuffer, SQLCHAR* outBuffer,
                                      size_t outBufferLenBytes,
                                      bool& isTruncated) {
@@ -43,28 +62,25 @@ size_t CopyUtf8StringToSqlCharString(const char* inBuffer, SQLCHAR* outBuffer,
     return 0;
   }
 
-  if (ANSI_STRING_ONLY) {
+  size_t inBufferLenBytes = strlen(inBuffer);
+  LOG_DEBUG_MSG("inBufferLenBytes is " << inBufferLenBytes);
+  if (ANSI_STRING_ONLY
+      || Utf8Transcoder::AsciiPrefixLength(inBuffer, inBufferLenBytes)
+             == inBufferLenBytes) {
     // the inBuffer contains ANSI characters only
     // If user are sure the strings in data source have only ANSI characters,
-    // this function will copy the UTF8 characters from data source to user
-    // buffer directly without converting UTF8 to wstring and then do a mapping
-    // from unicode to ANSI characters.
-    size_t inBufferLenBytes = strlen(inBuffer);
-    LOG_DEBUG_MSG("inBufferLenBytes is " << inBufferLenBytes);
-    if (inBufferLenBytes >= outBufferLenBytes) {
-      isTruncated = true;
-      if (outBufferLenBytes > 0) {
-        strncpy(reinterpret_cast<char*>(outBuffer), inBuffer,
-          outBufferLenBytes - 1);
-        outBuffer[outBufferLenBytes - 1] = 0;
-      }
-    } else {
-      isTruncated = false;
-      strncpy(reinterpret_cast< char* >(outBuffer), inBuffer, inBufferLenBytes);
-      outBuffer[inBufferLenBytes] = 0;
+    // or the string is checked to be ASCII, this function will copy the UTF8
+    // characters from data source to user buffer directly without converting
+    // UTF8 to wstring and then do a mapping from unicode to ANSI characters.
+    size_t bytesWritten = 0;
+    if (outBufferLenBytes > 0) {
+      bytesWritten = std::min(inBufferLenBytes, outBufferLenBytes - 1);
+    }
+    isTruncated = (bytesWritten < inBufferLenBytes);
+    if (outBufferLenBytes > 0) {
+      memcpy(outBuffer, inBuffer, bytesWritten);
+      outBuffer[bytesWritten] = 0;
     }
-    size_t bytesWritten =
-      outBufferLenBytes > 0 ? std::min(inBufferLenBytes, outBufferLenBytes - 1) : 0;
     return bytesWritten;
   } else {
     // the inBuffer may contain unicode characters
@@ -82,10 +98,9 @@ size_t CopyUtf8StringToSqlCharString(const char* inBuffer, SQLCHAR* outBuffer,
         outBufferLenBytes > 0 ? std::min(inBufferBytes, outBufferLenBytes - 1) : 0;
 
     if (outBufferLenActual > 0) {
-      std::locale currentLocale("");
-      std::use_facet< std::ctype< wchar_t > >(currentLocale)
-        .narrow(inString.data(), inString.data() + outBufferLenActual, '?',
-          reinterpret_cast<char*>(outBuffer));
+      GetUserCtype().narrow(inString.data(),
+                            inString.data() + outBufferLenActual, '?',
+                            reinterpret_cast< char* >(outBuffer));
       outBuffer[outBufferLenActual] = 0;
     }
     isTruncated = (outBufferLenActual < inBufferBytes);
@@ -135,51 +150,22 @@ size_t CopyUtf8StringToWcharString(const char* inBuffer, OutCharT* outBuffer,
   LOG_DEBUG_MSG("inBufferLen is " << inBufferLen << ", outBufferLenChars is "
                                   << outBufferLenChars);
 
-  // Setup conversion facet.
-  const std::codecvt_utf8< OutCharT > convFacet;
-  std::mbstate_t convState = std::mbstate_t();
-  // Pointer to next for input.
-  const char* pInBufferNext;
-  // Pointer to next for output.
-  OutCharT* pOutBufferNext;
-
-  // translate characters:
-  const char* inBufferEnd = (inBuffer + inBufferLen);
-  std::codecvt_base::result result =
-      convFacet.in(convState, inBuffer, inBufferEnd, pInBufferNext, pOutBuffer,
-                   pOutBuffer + outBufferLenChars, pOutBufferNext);
-  LOG_DEBUG_MSG("result is " << result);
-
-  size_t lenConverted = 0;
-  switch (result) {
-    case std::codecvt_base::ok:
-    case std::codecvt_base::partial:
-      // The number of characters converted (in OutCharT)
-      lenConverted = pOutBufferNext - pOutBuffer;
-      // null-terminate target string, if room
-      pOutBuffer[lenConverted] = 0;
-
-      isTruncated = (result == std::codecvt_base::partial
-                     || (inBufferEnd != pInBufferNext));
-      break;
-    case std::codecvt_base::error:
-      // Error returned if unable to convert character.
-      LOG_ERROR_MSG("Unable to convert character '" << *pInBufferNext << "'");
-
-      // The number of characters converted (in OutCharT)
-      lenConverted = pOutBufferNext - pOutBuffer;
-      // null-terminate target string, if room.
-      pOutBuffer[lenConverted] = 0;
-
-      isTruncated = true;
-      break;
-    default:
-      // This situation occurs if the source and target are the same encoding.
-      // Impossible?
-      LOG_ERROR_MSG("Unexpected error converting string '" << inBuffer << "'");
-      assert(false);
-      break;
+  Utf8Transcoder::Result result = Utf8Transcoder::Transcode(
+      inBuffer, inBufferLen, pOutBuffer, outBufferLenChars);
+  LOG_DEBUG_MSG("read is " << result.read << ", invalid is "
+                           << result.invalid);
+
+  // The number of characters converted (in OutCharT)
+  size_t lenConverted = result.written;
+  // null-terminate target string, if room
+  pOutBuffer[lenConverted] = 0;
+
+  if (result.invalid) {
+    // Error returned if unable to convert character.
+    LOG_ERROR_MSG("Unable to convert character '" << inBuffer[result.read]
+                                                  << "'");
   }
+  isTruncated = (result.read != inBufferLen);
 
   LOG_DEBUG_MSG("lenConverted is " << lenConverted);
 
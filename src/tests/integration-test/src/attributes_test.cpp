@@ -182,12 +182,51 @@ BOOST_AUTO_TEST_CASE(ConnectionAttributeAsyncEnable) {
   ret =
       SQLSetConnectAttr(dbc, SQL_ATTR_ASYNC_ENABLE,
                         reinterpret_cast< SQLPOINTER >(SQL_ASYNC_ENABLE_ON), 0);
+  ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_DBC, dbc);
+
+  ret = SQLGetConnectAttr(dbc, SQL_ATTR_ASYNC_ENABLE, &id, 0, 0);
+  ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_DBC, dbc);
+  BOOST_REQUIRE_EQUAL(id, SQL_ASYNC_ENABLE_ON);
+
+  // statements allocated afterwards are asynchronous
+  SQLHSTMT asyncStmt = SQL_NULL_HSTMT;
+  ret = SQLAllocHandle(SQL_HANDLE_STMT, dbc, &asyncStmt);
+  ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_DBC, dbc);
+
+  SQLULEN mode = SQL_ASYNC_ENABLE_OFF;
+  ret = SQLGetStmtAttr(asyncStmt, SQL_ATTR_ASYNC_ENABLE, &mode, 0, 0);
+  ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, asyncStmt);
+  BOOST_CHECK_EQUAL(mode, SQL_ASYNC_ENABLE_ON);
+  SQLFreeHandle(SQL_HANDLE_STMT, asyncStmt);
 
+  ret = SQLSetConnectAttr(dbc, SQL_ATTR_ASYNC_ENABLE,
+                          reinterpret_cast< SQLPOINTER >(2), 0);
   BOOST_REQUIRE_EQUAL(ret, SQL_ERROR);
-  std::string error = GetOdbcErrorMessage(SQL_HANDLE_DBC, dbc);
-  std::string pattern = "Specified attribute is not supported.";
-  if (error.find(pattern) == std::string::npos)
-    BOOST_FAIL("'" + error + "' does not match '" + pattern + "'");
+  CheckSQLConnectionDiagnosticError("HY024");
+}
+
+BOOST_AUTO_TEST_CASE(ConnectionAttributeAsyncDbcFunctionsEnable) {
+  ConnectToTS();
+
+  SQLUINTEGER id = -1;
+  SQLRETURN ret =
+      SQLGetConnectAttr(dbc, SQL_ATTR_ASYNC_DBC_FUNCTIONS_ENABLE, &id, 0, 0);
+  ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_DBC, dbc);
+  BOOST_REQUIRE_EQUAL(id, SQL_ASYNC_DBC_ENABLE_OFF);
+
+  ret = SQLSetConnectAttr(
+      dbc, SQL_ATTR_ASYNC_DBC_FUNCTIONS_ENABLE,
+      reinterpret_cast< SQLPOINTER >(SQL_ASYNC_DBC_ENABLE_ON), 0);
+  ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_DBC, dbc);
+
+  ret = SQLGetConnectAttr(dbc, SQL_ATTR_ASYNC_DBC_FUNCTIONS_ENABLE, &id, 0, 0);
+  ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_DBC, dbc);
+  BOOST_REQUIRE_EQUAL(id, SQL_ASYNC_DBC_ENABLE_ON);
+
+  ret = SQLSetConnectAttr(
+      dbc, SQL_ATTR_ASYNC_DBC_FUNCTIONS_ENABLE,
+      reinterpret_cast< SQLPOINTER >(SQL_ASYNC_DBC_ENABLE_OFF), 0);
+  ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_DBC, dbc);
 }
 
 BOOST_AUTO_TEST_CASE(ConnectionAttributeTSLogDebug) {
@@ -279,14 +318,29 @@ BOOST_AUTO_TEST_CASE(StatementAttributeCursorType) {
                        0);
   ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
 
-  // Attempt to set to unsupported value
   ret = SQLSetStmtAttr(stmt, SQL_ATTR_CURSOR_TYPE,
                        reinterpret_cast< SQLPOINTER >(SQL_CURSOR_STATIC), 0);
+  ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+  ret = SQLGetStmtAttr(stmt, SQL_ATTR_CURSOR_TYPE, &cursorType, 0, 0);
+  ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+  BOOST_REQUIRE_EQUAL(cursorType, SQL_CURSOR_STATIC);
+
+  SQLULEN scrollable = SQL_NONSCROLLABLE;
+  ret = SQLGetStmtAttr(stmt, SQL_ATTR_CURSOR_SCROLLABLE, &scrollable, 0, 0);
+  ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+  BOOST_REQUIRE_EQUAL(scrollable, SQL_SCROLLABLE);
+
+  // Attempt to set to unsupported value
+  ret = SQLSetStmtAttr(stmt, SQL_ATTR_CURSOR_TYPE,
+                       reinterpret_cast< SQLPOINTER >(SQL_CURSOR_KEYSET_DRIVEN),
+                       0);
 
   BOOST_REQUIRE_EQUAL(ret, SQL_ERROR);
   CheckSQLStatementDiagnosticError("HYC00");
-  BOOST_REQUIRE_EQUAL("HYC00: Only forward cursors are currently supported",
-                      GetOdbcErrorMessage(SQL_HANDLE_STMT, stmt));
+  BOOST_REQUIRE_EQUAL(
+      "HYC00: Only forward-only and static cursors are supported",
+      GetOdbcErrorMessage(SQL_HANDLE_STMT, stmt));
 }
 
 BOOST_AUTO_TEST_CASE(StatementAttributeRowArraySize) {
@@ -859,6 +913,9 @@ BOOST_AUTO_TEST_CASE(ConnectionSetConnectOption) {
 
   ret = SQLSetConnectOption(dbc, SQL_ROWSET_SIZE, 100);
   ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_DBC, dbc);
+
+  ret = SQLSetConnectOption(dbc, SQL_QUERY_TIMEOUT, 10);
+  ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_DBC, dbc);
 }
 
 BOOST_AUTO_TEST_CASE(ConnectionSetConnectOptionUnsupportedValue) {
@@ -914,11 +971,8 @@ BOOST_AUTO_TEST_CASE(ConnectionSetConnectOptionIgnored) {
   ConnectToTS(SQL_OV_ODBC2);
 
   CHECK_SET_IGNORED_OPTION(SQL_NOSCAN, SQL_TRUE);
-  CHECK_SET_IGNORED_OPTION(SQL_QUERY_TIMEOUT, 10);
-  CHECK_SET_IGNORED_OPTION(SQL_MAX_ROWS, 20);
   CHECK_SET_IGNORED_OPTION(SQL_MAX_LENGTH, 20);
   CHECK_SET_IGNORED_OPTION(SQL_KEYSET_SIZE, 100);
-  CHECK_SET_IGNORED_OPTION(SQL_ASYNC_ENABLE, SQL_TRUE);
   CHECK_SET_IGNORED_OPTION(SQL_TXN_ISOLATION, SQL_TXN_READ_COMMITTED);
   CHECK_SET_IGNORED_OPTION(SQL_ACCESS_MODE, SQL_MODE_READ_ONLY);
   CHECK_SET_IGNORED_OPTION(SQL_CURRENT_QUALIFIER,
@@ -1062,6 +1116,18 @@ BOOST_AUTO_TEST_CASE(StatementOptionSupported) {
   ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
   BOOST_CHECK_EQUAL(value, SQL_CURSOR_FORWARD_ONLY);
 
+  ret = SQLGetStmtOption(stmt, SQL_ASYNC_ENABLE, (SQLPOINTER)&value);
+  ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+  BOOST_CHECK_EQUAL(value, SQL_ASYNC_ENABLE_OFF);
+
+  ret = SQLGetStmtOption(stmt, SQL_MAX_ROWS, (SQLPOINTER)&value);
+  ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+  BOOST_CHECK_EQUAL(value, 0);
+
+  ret = SQLGetStmtOption(stmt, SQL_QUERY_TIMEOUT, (SQLPOINTER)&value);
+  ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+  BOOST_CHECK_EQUAL(value, 0);
+
   ret = SQLGetStmtOption(stmt, SQL_RETRIEVE_DATA, (SQLPOINTER)&value);
   ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
   BOOST_CHECK_EQUAL(value, SQL_RD_ON);
@@ -1080,12 +1146,9 @@ BOOST_AUTO_TEST_CASE(StatementOptionNotSupported) {
   // These unsupported options are blocked by driver manager
   CHECK_GET_OPTION_NOTSUPPORTED(SQL_GET_BOOKMARK);
   CHECK_GET_OPTION_NOTSUPPORTED(SQL_ROW_NUMBER);
-  CHECK_GET_OPTION_NOTSUPPORTED(SQL_ASYNC_ENABLE);
   CHECK_GET_OPTION_NOTSUPPORTED(SQL_KEYSET_SIZE);
   CHECK_GET_OPTION_NOTSUPPORTED(SQL_MAX_LENGTH);
-  CHECK_GET_OPTION_NOTSUPPORTED(SQL_MAX_ROWS);
   CHECK_GET_OPTION_NOTSUPPORTED(SQL_NOSCAN);
-  CHECK_GET_OPTION_NOTSUPPORTED(SQL_QUERY_TIMEOUT);
   CHECK_GET_OPTION_NOTSUPPORTED(SQL_SIMULATE_CURSOR);
   CHECK_GET_OPTION_NOTSUPPORTED(SQL_USE_BOOKMARKS);
 }
@@ -30,6 +30,7 @@
 #include <string>
 #include <vector>
 #include <chrono>
+#include <thread>
 
 #include "timestream/odbc/utility.h"
 #include "odbc_test_suite.h"
@@ -886,6 +887,36 @@ BOOST_AUTO_TEST_CASE(TestSQLCancel) {
 #endif
 }
 
+BOOST_AUTO_TEST_CASE(TestSQLExecDirectAsync) {
+  std::string dsnConnectionString;
+  CreateDsnConnectionStringForAWS(dsnConnectionString);
+  AddMaxRowPerPage(dsnConnectionString, "1");
+  Connect(dsnConnectionString);
+  SQLRETURN ret = SQLSetStmtAttr(
+      stmt, SQL_ATTR_ASYNC_ENABLE,
+      reinterpret_cast< SQLPOINTER >(SQL_ASYNC_ENABLE_ON), 0);
+  ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+  std::vector< SQLWCHAR > request = MakeSqlBuffer(
+      "select time, index, cpu_utilization from "
+      "data_queries_test_db.TestMultiMeasureBigTable order by time");
+  ret = SQLExecDirect(stmt, request.data(), SQL_NTS);
+  BOOST_CHECK_EQUAL(SQL_STILL_EXECUTING, ret);
+
+  // poll until the query is executed
+  while (ret == SQL_STILL_EXECUTING) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    ret = SQLExecDirect(stmt, request.data(), SQL_NTS);
+  }
+  BOOST_CHECK_EQUAL(SQL_SUCCESS, ret);
+
+  // the rows are fetched asynchronously too
+  do {
+    ret = SQLFetch(stmt);
+  } while (ret == SQL_STILL_EXECUTING);
+  BOOST_CHECK_EQUAL(SQL_SUCCESS, ret);
+}
+
 BOOST_AUTO_TEST_CASE(TestSQLCloseCursor) {
   std::string dsnConnectionString;
   CreateDsnConnectionStringForAWS(dsnConnectionString);
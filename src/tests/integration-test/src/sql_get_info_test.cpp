@@ -174,7 +174,9 @@ BOOST_AUTO_TEST_CASE(TestValues) {
       ignite::odbc::common::GetEnv("AWS_ACCESS_KEY_ID");
   CheckStrInfo(SQL_USER_NAME, expectedUserName);
 
-  CheckIntInfo(SQL_ASYNC_MODE, SQL_AM_NONE);
+  CheckIntInfo(SQL_ASYNC_DBC_FUNCTIONS, SQL_ASYNC_DBC_CAPABLE);
+  CheckIntInfo(SQL_ASYNC_MODE, SQL_AM_STATEMENT);
+  CheckIntInfo(SQL_ASYNC_NOTIFICATION, SQL_ASYNC_NOTIFICATION_CAPABLE);
   CheckIntInfo(SQL_BATCH_ROW_COUNT, 0);
   CheckIntInfo(SQL_BATCH_SUPPORT, 0);
   CheckIntInfo(SQL_BOOKMARK_PERSISTENCE, 0);
@@ -21,6 +21,8 @@
 #include <aws/core/auth/AWSCredentials.h>
 #include <aws/timestream-query/TimestreamQueryClient.h>
 #include <aws/timestream-query/model/QueryRequest.h>
+#include <aws/timestream-query/model/PrepareQueryRequest.h>
+#include <aws/timestream-query/model/CancelQueryRequest.h>
 
 namespace timestream {
 namespace odbc {
@@ -59,6 +61,24 @@ class MockTimestreamQueryClient
   virtual Aws::TimestreamQuery::Model::QueryOutcome Query(
       const Aws::TimestreamQuery::Model::QueryRequest &request) const;
 
+  /**
+   * Prepare a query.
+   *
+   * @param request Aws PrepareQueryRequest.
+   * @return Operation outcome.
+   */
+  virtual Aws::TimestreamQuery::Model::PrepareQueryOutcome PrepareQuery(
+      const Aws::TimestreamQuery::Model::PrepareQueryRequest &request) const;
+
+  /**
+   * Cancel a query.
+   *
+   * @param request Aws CancelQueryRequest.
+   * @return Operation outcome.
+   */
+  virtual Aws::TimestreamQuery::Model::CancelQueryOutcome CancelQuery(
+      const Aws::TimestreamQuery::Model::CancelQueryRequest &request) const;
+
  private:
   Aws::Auth::AWSCredentials credentials_;
   Aws::Client::ClientConfiguration clientConfiguration_;
@@ -17,10 +17,14 @@
 #ifndef _MOCK_TIMESTREAM_SERVICE
 #define _MOCK_TIMESTREAM_SERVICE
 
+#include <atomic>
+
 #include <aws/core/Aws.h>
 #include <aws/core/auth/AWSCredentials.h>
 #include <aws/timestream-query/TimestreamQueryClient.h>
 #include <aws/timestream-query/model/QueryRequest.h>
+#include <aws/timestream-query/model/PrepareQueryRequest.h>
+#include <aws/timestream-query/model/CancelQueryRequest.h>
 
 namespace timestream {
 namespace odbc {
@@ -91,11 +95,45 @@ class MockTimestreamService {
   Aws::TimestreamQuery::Model::QueryOutcome HandleQueryReq(
       const Aws::TimestreamQuery::Model::QueryRequest& request);
 
+  /**
+   * Handle prepare query request from query client
+   *
+   * @param request Prepare query request
+   */
+  Aws::TimestreamQuery::Model::PrepareQueryOutcome HandlePrepareQueryReq(
+      const Aws::TimestreamQuery::Model::PrepareQueryRequest& request);
+
+  /**
+   * Handle cancel query request from query client
+   *
+   * @param request Cancel query request
+   */
+  Aws::TimestreamQuery::Model::CancelQueryOutcome HandleCancelQueryReq(
+      const Aws::TimestreamQuery::Model::CancelQueryRequest& request);
+
+  /**
+   * Get number of cancelled queries
+   *
+   * @return Number of cancelled queries
+   */
+  int GetCancelCount() const {
+    return cancelCount_;
+  }
+
+  /**
+   * Get max rows of the last query request, 0 if it is not set
+   *
+   * @return Max rows of the last query request
+   */
+  int GetLastMaxRows() const {
+    return lastMaxRows_;
+  }
+
  private:
   /**
    * Constructor.
    */
-  MockTimestreamService() {
+  MockTimestreamService() : cancelCount_(0), lastMaxRows_(0) {
   }
 
   void SetupResultForMockTable(
@@ -107,6 +145,8 @@ class MockTimestreamService {
       credMap_;  // credentials configured by user
   static int token;
   static int errorToken;
+  std::atomic< int > cancelCount_;  // number of cancelled queries
+  std::atomic< int > lastMaxRows_;  // max rows of the last query request
 };
 }  // namespace odbc
 }  // namespace timestream
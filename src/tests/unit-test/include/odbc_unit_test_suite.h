@@ -19,6 +19,9 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <condition_variable>
+#include <mutex>
+
 #include <mock/mock_environment.h>
 #include <mock/mock_connection.h>
 #include <mock/mock_statement.h>
@@ -34,6 +37,38 @@
 
 namespace timestream {
 namespace odbc {
+/**
+ * Completion notifications of asynchronous functions. Its address is set as
+ * the context of the notification callback.
+ */
+struct AsyncNotification {
+  /**
+   * Notification callback.
+   *
+   * @param context Pointer to AsyncNotification.
+   * @param last Last notification flag.
+   * @return SQL_SUCCESS.
+   */
+  static SQLRETURN SQL_API Callback(SQLPOINTER context, int last);
+
+  /**
+   * Wait for notifications.
+   *
+   * @param expected Number of notifications received since construction.
+   * @return True if the notifications are received within 10 seconds.
+   */
+  bool Wait(int expected);
+
+  /** Mutex guarding count. */
+  std::mutex mutex;
+
+  /** Condition signalled on notification. */
+  std::condition_variable cond;
+
+  /** Number of notifications received. */
+  int count = 0;
+};
+
 /**
  * Test setup fixture.
  */
@@ -0,0 +1,89 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include <sqlext.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include "timestream/odbc/app/column_binding_table.h"
+#include "timestream/odbc/type_traits.h"
+
+using timestream::odbc::app::ApplicationDataBuffer;
+using timestream::odbc::app::ColumnBindingTable;
+using timestream::odbc::type_traits::OdbcNativeType;
+using namespace boost::unit_test;
+
+BOOST_AUTO_TEST_SUITE(ColumnBindingTableTestSuite)
+
+BOOST_AUTO_TEST_CASE(TestBindUnbind) {
+  ColumnBindingTable table;
+  BOOST_CHECK_EQUAL(table.GetSize(), 0);
+  BOOST_CHECK(!table.Find(1));
+
+  SQLINTEGER values[2]{};
+  SQLLEN lens[2]{};
+  ApplicationDataBuffer buf(OdbcNativeType::AI_SIGNED_LONG, values,
+                            sizeof(values[0]), lens);
+
+  // columns are listed in ascending order whatever the bind order is
+  table.Bind(3, buf);
+  table.Bind(1, buf);
+  table.Bind(2, buf);
+  table.Bind(1, buf);
+  BOOST_CHECK_EQUAL(table.GetSize(), 3);
+  BOOST_CHECK_EQUAL(table.GetBoundColumns()[0], 1);
+  BOOST_CHECK_EQUAL(table.GetBoundColumns()[1], 2);
+  BOOST_CHECK_EQUAL(table.GetBoundColumns()[2], 3);
+  BOOST_CHECK(table.IsBound(2));
+  BOOST_CHECK(!table.IsBound(4));
+  BOOST_CHECK(table.Find(3));
+
+  table.Unbind(2);
+  table.Unbind(7);
+  BOOST_CHECK_EQUAL(table.GetSize(), 2);
+  BOOST_CHECK(!table.Find(2));
+  BOOST_CHECK_EQUAL(table.GetBoundColumns()[1], 3);
+
+  table.Clear();
+  BOOST_CHECK_EQUAL(table.GetSize(), 0);
+  BOOST_CHECK(!table.IsBound(1));
+}
+
+BOOST_AUTO_TEST_CASE(TestElementOffset) {
+  ColumnBindingTable table;
+
+  SQLINTEGER values[3]{};
+  SQLLEN lens[3]{};
+  table.Bind(1, ApplicationDataBuffer(OdbcNativeType::AI_SIGNED_LONG, values,
+                                      sizeof(values[0]), lens));
+
+  // the offsets apply to the buffers of all bound columns
+  for (SQLULEN i = 0; i < 3; ++i) {
+    table.SetElementOffset(i);
+    table.GetBuffer(1).PutInt32(static_cast< int32_t >(i + 10));
+  }
+
+  BOOST_CHECK_EQUAL(values[0], 10);
+  BOOST_CHECK_EQUAL(values[1], 11);
+  BOOST_CHECK_EQUAL(values[2], 12);
+  BOOST_CHECK_EQUAL(lens[2], sizeof(SQLINTEGER));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
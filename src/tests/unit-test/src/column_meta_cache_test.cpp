@@ -0,0 +1,111 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include "timestream/odbc/meta/column_meta_cache.h"
+
+using timestream::odbc::meta::ColumnMeta;
+using timestream::odbc::meta::ColumnMetaCache;
+using timestream::odbc::meta::ColumnMetaVector;
+using timestream::odbc::meta::Nullability;
+using namespace boost::unit_test;
+
+namespace {
+ColumnMetaVector MakeMeta(const std::string& column) {
+  ColumnMetaVector meta;
+  meta.emplace_back("database", "table", column,
+                    static_cast< int16_t >(ScalarType::VARCHAR),
+                    Nullability::NULLABLE);
+  return meta;
+}
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(ColumnMetaCacheTestSuite)
+
+BOOST_AUTO_TEST_CASE(TestNormalizeSql) {
+  BOOST_CHECK_EQUAL(ColumnMetaCache::NormalizeSql("  select  a,\n\tb from t  "),
+                    "select a, b from t");
+  BOOST_CHECK_EQUAL(
+      ColumnMetaCache::NormalizeSql("select 'a  b' from \"my  table\""),
+      "select 'a  b' from \"my  table\"");
+  BOOST_CHECK_EQUAL(ColumnMetaCache::NormalizeSql("select 'it''s'  from t"),
+                    "select 'it''s' from t");
+}
+
+BOOST_AUTO_TEST_CASE(TestGetPut) {
+  ColumnMetaCache cache(2, std::chrono::seconds(60));
+  ColumnMetaVector meta;
+
+  BOOST_CHECK(!cache.Get("select a from t", meta));
+
+  cache.Put("select a from t", MakeMeta("a"));
+  BOOST_CHECK(cache.Get("select   a from t ", meta));
+  BOOST_REQUIRE_EQUAL(meta.size(), 1);
+  BOOST_CHECK_EQUAL(*meta[0].GetColumnName(), "a");
+
+  // replacing an entry does not add a new one
+  cache.Put("select a from t", MakeMeta("b"));
+  BOOST_CHECK_EQUAL(cache.Size(), 1);
+  BOOST_CHECK(cache.Get("select a from t", meta));
+  BOOST_CHECK_EQUAL(*meta[0].GetColumnName(), "b");
+}
+
+BOOST_AUTO_TEST_CASE(TestEvictLeastRecentlyUsed) {
+  ColumnMetaCache cache(2, std::chrono::seconds(60));
+  ColumnMetaVector meta;
+
+  cache.Put("select a from t", MakeMeta("a"));
+  cache.Put("select b from t", MakeMeta("b"));
+
+  // make "select a from t" the most recently used entry
+  BOOST_CHECK(cache.Get("select a from t", meta));
+
+  cache.Put("select c from t", MakeMeta("c"));
+  BOOST_CHECK_EQUAL(cache.Size(), 2);
+  BOOST_CHECK(cache.Get("select a from t", meta));
+  BOOST_CHECK(!cache.Get("select b from t", meta));
+  BOOST_CHECK(cache.Get("select c from t", meta));
+}
+
+BOOST_AUTO_TEST_CASE(TestInvalidate) {
+  ColumnMetaCache cache(2, std::chrono::seconds(60));
+  ColumnMetaVector meta;
+
+  cache.Put("select a from t", MakeMeta("a"));
+  cache.Put("select b from t", MakeMeta("b"));
+
+  cache.Invalidate("select a from t");
+  BOOST_CHECK(!cache.Get("select a from t", meta));
+  BOOST_CHECK(cache.Get("select b from t", meta));
+
+  cache.Clear();
+  BOOST_CHECK_EQUAL(cache.Size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(TestDisabled) {
+  ColumnMetaVector meta;
+
+  ColumnMetaCache noCapacity(0, std::chrono::seconds(60));
+  noCapacity.Put("select a from t", MakeMeta("a"));
+  BOOST_CHECK(!noCapacity.Get("select a from t", meta));
+
+  ColumnMetaCache noTtl(2, std::chrono::seconds(0));
+  noTtl.Put("select a from t", MakeMeta("a"));
+  BOOST_CHECK(!noTtl.Get("select a from t", meta));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,151 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include <sqlext.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include "timestream/odbc/columnar_page.h"
+#include "timestream/odbc/type_traits.h"
+
+#include <aws/timestream-query/model/ColumnInfo.h>
+#include <aws/timestream-query/model/Datum.h>
+#include <aws/timestream-query/model/Row.h>
+#include <aws/timestream-query/model/Type.h>
+
+using Aws::TimestreamQuery::Model::ColumnInfo;
+using Aws::TimestreamQuery::Model::Datum;
+using Aws::TimestreamQuery::Model::QueryResult;
+using Aws::TimestreamQuery::Model::Row;
+using Aws::TimestreamQuery::Model::ScalarType;
+using Aws::TimestreamQuery::Model::Type;
+using timestream::odbc::ColumnarPage;
+using timestream::odbc::app::ApplicationDataBuffer;
+using timestream::odbc::app::ConversionResult;
+using timestream::odbc::type_traits::OdbcNativeType;
+using namespace boost::unit_test;
+
+namespace {
+ColumnInfo MakeColumn(const std::string& name, ScalarType type) {
+  Type columnType;
+  columnType.SetScalarType(type);
+
+  ColumnInfo info;
+  info.SetName(name);
+  info.SetType(columnType);
+  return info;
+}
+
+Datum MakeDatum(const std::string& value) {
+  Datum datum;
+  datum.SetScalarValue(value);
+  return datum;
+}
+
+Datum MakeNullDatum() {
+  Datum datum;
+  datum.SetNullValue(true);
+  return datum;
+}
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(ColumnarPageTestSuite)
+
+BOOST_AUTO_TEST_CASE(TestDecodeScalarColumns) {
+  QueryResult result;
+  result.AddColumnInfo(MakeColumn("b", ScalarType::BIGINT));
+  result.AddColumnInfo(MakeColumn("d", ScalarType::DOUBLE));
+  result.AddColumnInfo(MakeColumn("t", ScalarType::TIMESTAMP));
+  result.AddColumnInfo(MakeColumn("v", ScalarType::VARCHAR));
+
+  Row row;
+  row.AddData(MakeDatum("1234567890123"));
+  row.AddData(MakeDatum("35.5"));
+  row.AddData(MakeDatum("2022-10-20 19:01:02.123456789"));
+  row.AddData(MakeDatum("abc"));
+  result.AddRows(row);
+
+  Row nullRow;
+  nullRow.AddData(MakeNullDatum());
+  nullRow.AddData(MakeNullDatum());
+  nullRow.AddData(MakeNullDatum());
+  nullRow.AddData(MakeNullDatum());
+  result.AddRows(nullRow);
+
+  ColumnarPage page(result);
+  BOOST_CHECK(page.IsDecoded(1));
+  BOOST_CHECK(page.IsDecoded(2));
+  BOOST_CHECK(page.IsDecoded(3));
+  BOOST_CHECK(!page.IsDecoded(4));
+  BOOST_CHECK(!page.IsDecoded(0));
+  BOOST_CHECK(!page.IsDecoded(5));
+
+  SqlLen reslen = 0;
+  int64_t bigint = 0;
+  ApplicationDataBuffer bigintBuf(OdbcNativeType::AI_SIGNED_BIGINT, &bigint,
+                                  sizeof(bigint), &reslen);
+  BOOST_CHECK(page.ReadToBuffer(1, 0, bigintBuf)
+              == ConversionResult::Type::AI_SUCCESS);
+  BOOST_CHECK_EQUAL(bigint, 1234567890123);
+
+  BOOST_CHECK(page.ReadToBuffer(1, 1, bigintBuf)
+              == ConversionResult::Type::AI_SUCCESS);
+  BOOST_CHECK_EQUAL(reslen, SQL_NULL_DATA);
+
+  double dbl = 0;
+  ApplicationDataBuffer doubleBuf(OdbcNativeType::AI_DOUBLE, &dbl, sizeof(dbl),
+                                  &reslen);
+  BOOST_CHECK(page.ReadToBuffer(2, 0, doubleBuf)
+              == ConversionResult::Type::AI_SUCCESS);
+  BOOST_CHECK_EQUAL(dbl, 35.5);
+
+  SQL_TIMESTAMP_STRUCT ts;
+  ApplicationDataBuffer tsBuf(OdbcNativeType::AI_TTIMESTAMP, &ts, sizeof(ts),
+                              &reslen);
+  BOOST_CHECK(page.ReadToBuffer(3, 0, tsBuf)
+              == ConversionResult::Type::AI_SUCCESS);
+  BOOST_CHECK_EQUAL(ts.year, 2022);
+  BOOST_CHECK_EQUAL(ts.month, 10);
+  BOOST_CHECK_EQUAL(ts.day, 20);
+  BOOST_CHECK_EQUAL(ts.hour, 19);
+  BOOST_CHECK_EQUAL(ts.minute, 1);
+  BOOST_CHECK_EQUAL(ts.second, 2);
+  BOOST_CHECK_EQUAL(ts.fraction, 123456789);
+}
+
+BOOST_AUTO_TEST_CASE(TestNonScalarValueIsNotDecoded) {
+  QueryResult result;
+  result.AddColumnInfo(MakeColumn("i", ScalarType::INTEGER));
+
+  Row row;
+  row.AddData(MakeDatum("1"));
+  result.AddRows(row);
+
+  Datum arrayDatum;
+  arrayDatum.AddArrayValue(MakeDatum("2"));
+  Row arrayRow;
+  arrayRow.AddData(arrayDatum);
+  result.AddRows(arrayRow);
+
+  ColumnarPage page(result);
+  BOOST_CHECK(!page.IsDecoded(1));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
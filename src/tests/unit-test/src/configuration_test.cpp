@@ -520,6 +520,157 @@ BOOST_AUTO_TEST_CASE(TestConnectStringValidLogLevel) {
   CheckValidLogLevel("loglevel=0;", LogLevel::Type::OFF);
 }
 
+BOOST_AUTO_TEST_CASE(TestConnectStringValidPrefetchPages) {
+  Configuration cfg;
+
+  ParseValidConnectString("prefetchpages=4;", cfg);
+
+  BOOST_CHECK(cfg.IsPrefetchPagesSet());
+  BOOST_CHECK_EQUAL(cfg.GetPrefetchPages(), 4);
+}
+
+BOOST_AUTO_TEST_CASE(TestConnectStringInvalidPrefetchPages) {
+  const char* invalidValues[] = {"prefetchpages=0;", "prefetchpages=-1;",
+                                 "prefetchpages=abc;",
+                                 "prefetchpages=4294967296;"};
+
+  for (const char* connectStr : invalidValues) {
+    Configuration cfg;
+
+    ParseConnectStringWithError(connectStr, cfg);
+
+    BOOST_CHECK(!cfg.IsPrefetchPagesSet());
+    BOOST_CHECK_EQUAL(cfg.GetPrefetchPages(),
+                      Configuration::DefaultValue::prefetchPages);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(TestConnectStringValidMaxResultBufferMB) {
+  Configuration cfg;
+
+  ParseValidConnectString("maxresultbuffermb=0;", cfg);
+
+  BOOST_CHECK(cfg.IsMaxResultBufferMBSet());
+  BOOST_CHECK_EQUAL(cfg.GetMaxResultBufferMB(), 0);
+
+  ParseValidConnectString("maxresultbuffermb=64;", cfg);
+
+  BOOST_CHECK_EQUAL(cfg.GetMaxResultBufferMB(), 64);
+}
+
+BOOST_AUTO_TEST_CASE(TestConnectStringInvalidMaxResultBufferMB) {
+  const char* invalidValues[] = {"maxresultbuffermb=-1;",
+                                 "maxresultbuffermb=abc;",
+                                 "maxresultbuffermb=4294967296;"};
+
+  for (const char* connectStr : invalidValues) {
+    Configuration cfg;
+
+    ParseConnectStringWithError(connectStr, cfg);
+
+    BOOST_CHECK(!cfg.IsMaxResultBufferMBSet());
+    BOOST_CHECK_EQUAL(cfg.GetMaxResultBufferMB(),
+                      Configuration::DefaultValue::maxResultBufferMB);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(TestConnectStringValidQueryFanOut) {
+  Configuration cfg;
+
+  ParseValidConnectString("queryfanout=8;fanoutordered=false;", cfg);
+
+  BOOST_CHECK(cfg.IsQueryFanOutSet());
+  BOOST_CHECK_EQUAL(cfg.GetQueryFanOut(), 8);
+  BOOST_CHECK(cfg.IsFanOutOrderedSet());
+  BOOST_CHECK(!cfg.IsFanOutOrdered());
+}
+
+BOOST_AUTO_TEST_CASE(TestConnectStringInvalidQueryFanOut) {
+  const char* invalidValues[] = {"queryfanout=0;", "queryfanout=-1;",
+                                 "queryfanout=abc;", "fanoutordered=yes;"};
+
+  for (const char* connectStr : invalidValues) {
+    Configuration cfg;
+
+    ParseConnectStringWithError(connectStr, cfg);
+
+    BOOST_CHECK(!cfg.IsQueryFanOutSet());
+    BOOST_CHECK_EQUAL(cfg.GetQueryFanOut(),
+                      Configuration::DefaultValue::queryFanOut);
+    BOOST_CHECK(!cfg.IsFanOutOrderedSet());
+    BOOST_CHECK_EQUAL(cfg.IsFanOutOrdered(),
+                      Configuration::DefaultValue::fanOutOrdered);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(TestConnectStringValidResultCache) {
+  Configuration cfg;
+
+  ParseValidConnectString(
+      "resultcachettl=30;resultcachepath=/var/tmp/tscache;", cfg);
+
+  BOOST_CHECK(cfg.IsResultCacheTTLSet());
+  BOOST_CHECK_EQUAL(cfg.GetResultCacheTTL(), 30);
+  BOOST_CHECK(cfg.IsResultCachePathSet());
+  BOOST_CHECK_EQUAL(cfg.GetResultCachePath(), "/var/tmp/tscache");
+}
+
+BOOST_AUTO_TEST_CASE(TestConnectStringInvalidResultCacheTTL) {
+  const char* invalidValues[] = {"resultcachettl=-1;", "resultcachettl=abc;",
+                                 "resultcachettl=99999999999;"};
+
+  for (const char* connectStr : invalidValues) {
+    Configuration cfg;
+
+    ParseConnectStringWithError(connectStr, cfg);
+
+    BOOST_CHECK(!cfg.IsResultCacheTTLSet());
+    BOOST_CHECK_EQUAL(cfg.GetResultCacheTTL(),
+                      Configuration::DefaultValue::resultCacheTTL);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(TestConnectStringValidScrollBufferMB) {
+  Configuration cfg;
+
+  ParseValidConnectString("scrollbuffermb=0;", cfg);
+
+  BOOST_CHECK(cfg.IsScrollBufferMBSet());
+  BOOST_CHECK_EQUAL(cfg.GetScrollBufferMB(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(TestConnectStringInvalidScrollBufferMB) {
+  const char* invalidValues[] = {"scrollbuffermb=-1;", "scrollbuffermb=abc;",
+                                 "scrollbuffermb=99999999999;"};
+
+  for (const char* connectStr : invalidValues) {
+    Configuration cfg;
+
+    ParseConnectStringWithError(connectStr, cfg);
+
+    BOOST_CHECK(!cfg.IsScrollBufferMBSet());
+    BOOST_CHECK_EQUAL(cfg.GetScrollBufferMB(),
+                      Configuration::DefaultValue::scrollBufferMB);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(TestConnectStringAdaptivePageSize) {
+  Configuration cfg;
+
+  ParseValidConnectString("adaptivepagesize=true;", cfg);
+
+  BOOST_CHECK(cfg.IsAdaptivePageSizeSet());
+  BOOST_CHECK(cfg.IsAdaptivePageSize());
+
+  Configuration invalidCfg;
+
+  ParseConnectStringWithError("adaptivepagesize=yes;", invalidCfg);
+
+  BOOST_CHECK(!invalidCfg.IsAdaptivePageSizeSet());
+  BOOST_CHECK_EQUAL(invalidCfg.IsAdaptivePageSize(),
+                    Configuration::DefaultValue::adaptivePageSize);
+}
+
 BOOST_AUTO_TEST_CASE(TestDsnStringUppercase) {
   Configuration cfg;
 
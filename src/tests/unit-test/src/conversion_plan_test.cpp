@@ -0,0 +1,151 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include <sqlext.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include "timestream/odbc/columnar_page.h"
+#include "timestream/odbc/conversion_plan.h"
+#include "timestream/odbc/type_traits.h"
+
+#include <aws/timestream-query/model/ColumnInfo.h>
+#include <aws/timestream-query/model/Datum.h>
+#include <aws/timestream-query/model/Row.h>
+#include <aws/timestream-query/model/Type.h>
+
+using Aws::TimestreamQuery::Model::ColumnInfo;
+using Aws::TimestreamQuery::Model::Datum;
+using Aws::TimestreamQuery::Model::QueryResult;
+using Aws::TimestreamQuery::Model::Row;
+using Aws::TimestreamQuery::Model::ScalarType;
+using Aws::TimestreamQuery::Model::Type;
+using timestream::odbc::ColumnarPage;
+using timestream::odbc::ConversionPlan;
+using timestream::odbc::app::ApplicationDataBuffer;
+using timestream::odbc::app::ConversionResult;
+using timestream::odbc::type_traits::OdbcNativeType;
+using namespace boost::unit_test;
+
+namespace {
+ColumnInfo MakeColumn(const std::string& name, ScalarType type) {
+  Type columnType;
+  columnType.SetScalarType(type);
+
+  ColumnInfo info;
+  info.SetName(name);
+  info.SetType(columnType);
+  return info;
+}
+
+Datum MakeDatum(const std::string& value) {
+  Datum datum;
+  datum.SetScalarValue(value);
+  return datum;
+}
+
+Datum MakeNullDatum() {
+  Datum datum;
+  datum.SetNullValue(true);
+  return datum;
+}
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(ConversionPlanTestSuite)
+
+BOOST_AUTO_TEST_CASE(TestResolve) {
+  ConversionPlan plan;
+  BOOST_CHECK(!plan.IsResolvedFor(OdbcNativeType::AI_SIGNED_BIGINT));
+
+  plan.Resolve(ScalarType::BIGINT, OdbcNativeType::AI_SIGNED_BIGINT);
+  BOOST_CHECK(plan.IsResolvedFor(OdbcNativeType::AI_SIGNED_BIGINT));
+  BOOST_CHECK(!plan.IsResolvedFor(OdbcNativeType::AI_CHAR));
+  BOOST_CHECK(plan.GetConverter() != nullptr);
+
+  // temporal values read as text are copied from the datum text
+  plan.Resolve(ScalarType::TIMESTAMP, OdbcNativeType::AI_CHAR);
+  BOOST_CHECK(plan.GetConverter() == nullptr);
+  BOOST_CHECK(ConversionPlan::FindConverter(ScalarType::TIMESTAMP,
+                                            OdbcNativeType::AI_TTIMESTAMP)
+              != nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(TestConvertDecodedValues) {
+  QueryResult result;
+  result.AddColumnInfo(MakeColumn("b", ScalarType::BIGINT));
+  result.AddColumnInfo(MakeColumn("d", ScalarType::DOUBLE));
+
+  Row row;
+  row.AddData(MakeDatum("42"));
+  row.AddData(MakeDatum("35.5"));
+  result.AddRows(row);
+
+  Row nullRow;
+  nullRow.AddData(MakeNullDatum());
+  nullRow.AddData(MakeDatum("-1.25"));
+  result.AddRows(nullRow);
+
+  ColumnarPage page(result);
+  BOOST_REQUIRE(page.IsDecoded(1));
+  BOOST_REQUIRE(page.IsDecoded(2));
+
+  // a rowset of two elements, the converter writes the current element
+  SQLINTEGER ints[2] = {0, 0};
+  SqlLen intLens[2] = {0, 0};
+  ApplicationDataBuffer intBuf(OdbcNativeType::AI_SIGNED_LONG, ints,
+                               sizeof(ints[0]), intLens);
+  ConversionPlan::Converter intConverter = ConversionPlan::FindConverter(
+      ScalarType::BIGINT, OdbcNativeType::AI_SIGNED_LONG);
+  BOOST_REQUIRE(intConverter != nullptr);
+  BOOST_CHECK(intConverter(page, 1, 0, intBuf)
+              == ConversionResult::Type::AI_SUCCESS);
+  intBuf.SetElementOffset(1);
+  BOOST_CHECK(intConverter(page, 1, 1, intBuf)
+              == ConversionResult::Type::AI_SUCCESS);
+  BOOST_CHECK_EQUAL(ints[0], 42);
+  BOOST_CHECK_EQUAL(intLens[0], static_cast< SqlLen >(sizeof(SQLINTEGER)));
+  BOOST_CHECK_EQUAL(intLens[1], SQL_NULL_DATA);
+
+  float flt = 0;
+  SqlLen fltLen = 0;
+  ApplicationDataBuffer fltBuf(OdbcNativeType::AI_FLOAT, &flt, sizeof(flt),
+                               &fltLen);
+  ConversionPlan::Converter fltConverter = ConversionPlan::FindConverter(
+      ScalarType::DOUBLE, OdbcNativeType::AI_FLOAT);
+  BOOST_REQUIRE(fltConverter != nullptr);
+  BOOST_CHECK(fltConverter(page, 2, 1, fltBuf)
+              == ConversionResult::Type::AI_SUCCESS);
+  BOOST_CHECK_EQUAL(flt, -1.25f);
+  BOOST_CHECK_EQUAL(fltLen, static_cast< SqlLen >(sizeof(float)));
+
+  // other buffer types are converted by the page
+  char text[16]{};
+  SqlLen textLen = 0;
+  ApplicationDataBuffer textBuf(OdbcNativeType::AI_CHAR, text, sizeof(text),
+                                &textLen);
+  ConversionPlan::Converter textConverter = ConversionPlan::FindConverter(
+      ScalarType::BIGINT, OdbcNativeType::AI_CHAR);
+  BOOST_REQUIRE(textConverter != nullptr);
+  BOOST_CHECK(textConverter(page, 1, 0, textBuf)
+              == ConversionResult::Type::AI_SUCCESS);
+  BOOST_CHECK_EQUAL(std::string(text), "42");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
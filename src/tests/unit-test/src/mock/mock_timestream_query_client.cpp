@@ -42,5 +42,27 @@ Aws::TimestreamQuery::Model::QueryOutcome MockTimestreamQueryClient::Query(
   return MockTimestreamService::GetInstance()->HandleQueryReq(request);
 }
 
+Aws::TimestreamQuery::Model::PrepareQueryOutcome
+MockTimestreamQueryClient::PrepareQuery(
+    const Aws::TimestreamQuery::Model::PrepareQueryRequest &request) const {
+  // authenticate first
+  if (!MockTimestreamService::GetInstance()->Authenticate(
+          credentials_.GetAWSAccessKeyId(), credentials_.GetAWSSecretKey())) {
+    Aws::TimestreamQuery::TimestreamQueryError error(
+        Aws::Client::AWSError< Aws::Client::CoreErrors >(
+            Aws::Client::CoreErrors::INVALID_ACCESS_KEY_ID, false));
+
+    return Aws::TimestreamQuery::Model::PrepareQueryOutcome(error);
+  }
+
+  return MockTimestreamService::GetInstance()->HandlePrepareQueryReq(request);
+}
+
+Aws::TimestreamQuery::Model::CancelQueryOutcome
+MockTimestreamQueryClient::CancelQuery(
+    const Aws::TimestreamQuery::Model::CancelQueryRequest &request) const {
+  return MockTimestreamService::GetInstance()->HandleCancelQueryReq(request);
+}
+
 }  // namespace odbc
 }  // namespace timestream
@@ -21,6 +21,14 @@
 #include <aws/timestream-query/model/Row.h>
 #include <aws/timestream-query/model/Datum.h>
 #include <aws/timestream-query/model/ColumnInfo.h>
+#include <aws/timestream-query/model/PrepareQueryResult.h>
+#include <aws/timestream-query/model/CancelQueryResult.h>
+#include <aws/timestream-query/model/SelectColumn.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
 
 #include <mock/mock_timestream_service.h>
 
@@ -121,6 +129,7 @@ void MockTimestreamService::SetupResultForMockTable(
 // this function if new query needs to be handled.
 Aws::TimestreamQuery::Model::QueryOutcome MockTimestreamService::HandleQueryReq(
     const Aws::TimestreamQuery::Model::QueryRequest& request) {
+  lastMaxRows_ = request.MaxRowsHasBeenSet() ? request.GetMaxRows() : 0;
   if (request.GetQueryString() == "SELECT 1") {
     // set up QueryResult
     Aws::TimestreamQuery::Model::QueryResult result;
@@ -143,8 +152,91 @@ Aws::TimestreamQuery::Model::QueryOutcome MockTimestreamService::HandleQueryReq(
     SetupResultForMockTable(result);
 
     // for pagination test
+    result.SetQueryId("mockTable10000");
+    result.SetNextToken(std::to_string(++token));
+    return Aws::TimestreamQuery::Model::QueryOutcome(result);
+  } else if (request.GetQueryString()
+             == "select measure, time from mockDB.mockTableSlow") {
+    // for query timeout test, the first page takes 2 seconds
+    std::this_thread::sleep_for(std::chrono::seconds(2));
+    Aws::TimestreamQuery::Model::QueryResult result;
+    SetupResultForMockTable(result);
+    result.SetQueryId("mockTableSlow");
+    result.SetNextToken(std::to_string(++token));
+    return Aws::TimestreamQuery::Model::QueryOutcome(result);
+  } else if (request.GetQueryString()
+             == "select measure, time from mockDB.mockTableSlowPage") {
+    // for query timeout test, the pages after the first take 2 seconds
+    if (!request.GetNextToken().empty()) {
+      std::this_thread::sleep_for(std::chrono::seconds(2));
+    }
+    Aws::TimestreamQuery::Model::QueryResult result;
+    SetupResultForMockTable(result);
+    result.SetQueryId("mockTableSlowPage");
     result.SetNextToken(std::to_string(++token));
     return Aws::TimestreamQuery::Model::QueryOutcome(result);
+  } else if (request.GetQueryString()
+             == "select measure, time from mockDB.unpreparedTable") {
+    // for metadata fallback test, PrepareQuery is denied for this query
+    Aws::TimestreamQuery::Model::QueryResult result;
+    SetupResultForMockTable(result);
+    result.SetQueryId("unpreparedTable");
+    result.SetNextToken(std::to_string(++token));
+    return Aws::TimestreamQuery::Model::QueryOutcome(result);
+  } else if (request.GetQueryString()
+             == "select measure, time from mockDB.mockTableEmptyFirst") {
+    // for result cache test, the first page has no rows and the second
+    // page is the last
+    Aws::TimestreamQuery::Model::QueryResult result;
+    SetupResultForMockTable(result);
+    result.SetQueryId("mockTableEmptyFirst");
+    if (request.GetNextToken().empty()) {
+      result.SetRows(Aws::Vector< Aws::TimestreamQuery::Model::Row >());
+      result.SetNextToken("1");
+    }
+    return Aws::TimestreamQuery::Model::QueryOutcome(result);
+  } else if (request.GetQueryString().find(
+                 "select measure, time from mockDB.mockTableRange where ")
+             == 0) {
+    // for time range fan-out test, each time range returns one page
+    Aws::TimestreamQuery::Model::QueryResult result;
+    SetupResultForMockTable(result);
+    return Aws::TimestreamQuery::Model::QueryOutcome(result);
+  } else if (request.GetQueryString().find(
+                 "select measure, time from mockDB.mockTableDays where ")
+             == 0) {
+    // for ordered fan-out test, each time range of a day returns the rows
+    // of hour 1, 2 and 3 of the day, the first day is returned last
+    const Aws::String& query = request.GetQueryString();
+    const char prefix[] = "from_nanoseconds(";
+    size_t pos = query.find(prefix);
+    int64_t begin = pos == Aws::String::npos
+                        ? 0
+                        : std::strtoll(query.c_str() + pos + strlen(prefix),
+                                       nullptr, 10);
+    // 2022-11-09 00:00:00 UTC
+    const int64_t firstDay = 1667952000LL * 1000000000LL;
+    int64_t day = 9 + (begin - firstDay) / (86400LL * 1000000000LL);
+    if (day == 9) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    }
+
+    Aws::TimestreamQuery::Model::QueryResult result;
+    SetupResultForMockTable(result);
+    Aws::Vector< Aws::TimestreamQuery::Model::Row > rows;
+    for (int hour = 1; hour <= 3; hour++) {
+      Aws::TimestreamQuery::Model::Datum measure;
+      measure.SetScalarValue("cpu_usage");
+      Aws::TimestreamQuery::Model::Datum time;
+      time.SetScalarValue("2022-11-" + std::to_string(day) + " 0"
+                          + std::to_string(hour) + ":00:00.000000000");
+      Aws::TimestreamQuery::Model::Row row;
+      row.AddData(measure);
+      row.AddData(time);
+      rows.push_back(row);
+    }
+    result.SetRows(rows);
+    return Aws::TimestreamQuery::Model::QueryOutcome(result);
   } else if (request.GetQueryString()
              == "select measure, time from mockDB.mockTable10Error") {
     Aws::TimestreamQuery::Model::QueryResult result;
@@ -169,5 +261,56 @@ Aws::TimestreamQuery::Model::QueryOutcome MockTimestreamService::HandleQueryReq(
     return Aws::TimestreamQuery::Model::QueryOutcome(error);
   }
 }
+
+// This function simulates AWS Timestream PrepareQuery. Only the mockTable
+// queries are handled.
+Aws::TimestreamQuery::Model::PrepareQueryOutcome
+MockTimestreamService::HandlePrepareQueryReq(
+    const Aws::TimestreamQuery::Model::PrepareQueryRequest& request) {
+  if (request.GetQueryString().find(
+          "select measure, time from mockDB.mockTable")
+      == 0) {
+    Aws::TimestreamQuery::Model::PrepareQueryResult result;
+
+    Aws::TimestreamQuery::Model::SelectColumn firstColumn;
+    firstColumn.SetName("measure");
+    Aws::TimestreamQuery::Model::Type stringType;
+    stringType.SetScalarType(Aws::TimestreamQuery::Model::ScalarType::VARCHAR);
+    firstColumn.SetType(stringType);
+
+    Aws::TimestreamQuery::Model::SelectColumn secondColumn;
+    secondColumn.SetName("time");
+    Aws::TimestreamQuery::Model::Type timeType;
+    timeType.SetScalarType(Aws::TimestreamQuery::Model::ScalarType::TIMESTAMP);
+    secondColumn.SetType(timeType);
+
+    result.AddColumns(firstColumn);
+    result.AddColumns(secondColumn);
+    return Aws::TimestreamQuery::Model::PrepareQueryOutcome(result);
+  } else if (request.GetQueryString()
+             == "select measure, time from mockDB.unpreparedTable") {
+    Aws::TimestreamQuery::TimestreamQueryError error(
+        Aws::Client::AWSError< Aws::Client::CoreErrors >(
+            Aws::Client::CoreErrors::ACCESS_DENIED, false));
+
+    return Aws::TimestreamQuery::Model::PrepareQueryOutcome(error);
+  } else {
+    Aws::TimestreamQuery::TimestreamQueryError error(
+        Aws::Client::AWSError< Aws::Client::CoreErrors >(
+            Aws::Client::CoreErrors::UNKNOWN, false));
+
+    return Aws::TimestreamQuery::Model::PrepareQueryOutcome(error);
+  }
+}
+
+Aws::TimestreamQuery::Model::CancelQueryOutcome
+MockTimestreamService::HandleCancelQueryReq(
+    const Aws::TimestreamQuery::Model::CancelQueryRequest& request) {
+  cancelCount_++;
+  Aws::TimestreamQuery::Model::CancelQueryResult result;
+  result.SetCancellationMessage("Query " + request.GetQueryId()
+                                + " is cancelled");
+  return Aws::TimestreamQuery::Model::CancelQueryOutcome(result);
+}
 }  // namespace odbc
 }  // namespace timestream
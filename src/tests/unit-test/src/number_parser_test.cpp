@@ -0,0 +1,158 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <string>
+
+#include "timestream/odbc/number_parser.h"
+
+using timestream::odbc::NumberParser;
+using namespace boost::unit_test;
+
+namespace {
+bool ParseInt32(const std::string& str, int32_t& value) {
+  return NumberParser::ParseInt32(str.data(), str.size(), value);
+}
+
+bool ParseInt64(const std::string& str, int64_t& value) {
+  return NumberParser::ParseInt64(str.data(), str.size(), value);
+}
+
+bool ParseDouble(const std::string& str, double& value) {
+  return NumberParser::ParseDouble(str.data(), str.size(), value);
+}
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(NumberParserTestSuite)
+
+BOOST_AUTO_TEST_CASE(TestParseInt32) {
+  int32_t value = 0;
+  BOOST_CHECK(ParseInt32("0", value));
+  BOOST_CHECK_EQUAL(value, 0);
+  BOOST_CHECK(ParseInt32("-42", value));
+  BOOST_CHECK_EQUAL(value, -42);
+  BOOST_CHECK(ParseInt32("+42", value));
+  BOOST_CHECK_EQUAL(value, 42);
+  BOOST_CHECK(ParseInt32("2147483647", value));
+  BOOST_CHECK_EQUAL(value, std::numeric_limits< int32_t >::max());
+  BOOST_CHECK(ParseInt32("-2147483648", value));
+  BOOST_CHECK_EQUAL(value, std::numeric_limits< int32_t >::min());
+
+  // failures leave the value unchanged
+  BOOST_CHECK(!ParseInt32("2147483648", value));
+  BOOST_CHECK(!ParseInt32("-2147483649", value));
+  BOOST_CHECK(!ParseInt32("", value));
+  BOOST_CHECK(!ParseInt32("-", value));
+  BOOST_CHECK(!ParseInt32("abc", value));
+  BOOST_CHECK_EQUAL(value, std::numeric_limits< int32_t >::min());
+
+  BOOST_CHECK(!ParseInt32("12.5", value));
+}
+
+BOOST_AUTO_TEST_CASE(TestParseInt64) {
+  int64_t value = 0;
+  BOOST_CHECK(ParseInt64("9223372036854775807", value));
+  BOOST_CHECK_EQUAL(value, std::numeric_limits< int64_t >::max());
+  BOOST_CHECK(ParseInt64("-9223372036854775808", value));
+  BOOST_CHECK_EQUAL(value, std::numeric_limits< int64_t >::min());
+  BOOST_CHECK(ParseInt64("000123", value));
+  BOOST_CHECK_EQUAL(value, 123);
+  BOOST_CHECK(!ParseInt64("9223372036854775808", value));
+  BOOST_CHECK(!ParseInt64("99999999999999999999", value));
+  BOOST_CHECK(!ParseInt64(" 1", value));
+
+  // the number ends at the first character which is not a digit
+  const char text[] = "12.5";
+  BOOST_CHECK_EQUAL(NumberParser::ReadInt64(text, text + 4, value), text + 2);
+  BOOST_CHECK_EQUAL(value, 12);
+}
+
+BOOST_AUTO_TEST_CASE(TestParseDouble) {
+  double value = 0.0;
+  BOOST_CHECK(ParseDouble("35.2", value));
+  BOOST_CHECK_EQUAL(value, 35.2);
+  BOOST_CHECK(ParseDouble("-0.001", value));
+  BOOST_CHECK_EQUAL(value, -0.001);
+  BOOST_CHECK(ParseDouble("1.5E10", value));
+  BOOST_CHECK_EQUAL(value, 1.5e10);
+  BOOST_CHECK(ParseDouble("2e-3", value));
+  BOOST_CHECK_EQUAL(value, 2e-3);
+  BOOST_CHECK(ParseDouble(".5", value));
+  BOOST_CHECK_EQUAL(value, 0.5);
+  BOOST_CHECK(ParseDouble("5.", value));
+  BOOST_CHECK_EQUAL(value, 5.0);
+  BOOST_CHECK(ParseDouble("-0.0", value));
+  BOOST_CHECK_EQUAL(value, 0.0);
+  BOOST_CHECK(std::signbit(value));
+
+  // long and large values
+  BOOST_CHECK(ParseDouble("0.30000000000000004", value));
+  BOOST_CHECK_EQUAL(value, 0.1 + 0.2);
+  BOOST_CHECK(ParseDouble("1.7976931348623157e308", value));
+  BOOST_CHECK_EQUAL(value, std::numeric_limits< double >::max());
+  BOOST_CHECK(ParseDouble("4.9e-324", value));
+  BOOST_CHECK_EQUAL(value, std::numeric_limits< double >::denorm_min());
+  BOOST_CHECK(ParseDouble("123456789012345678901234567890", value));
+  BOOST_CHECK_EQUAL(value, 1.2345678901234568e29);
+
+  BOOST_CHECK(ParseDouble("Infinity", value));
+  BOOST_CHECK_EQUAL(value, std::numeric_limits< double >::infinity());
+  BOOST_CHECK(ParseDouble("-inf", value));
+  BOOST_CHECK_EQUAL(value, -std::numeric_limits< double >::infinity());
+  BOOST_CHECK(ParseDouble("NaN", value));
+  BOOST_CHECK(std::isnan(value));
+
+  BOOST_CHECK(!ParseDouble("", value));
+  BOOST_CHECK(!ParseDouble(".", value));
+  BOOST_CHECK(!ParseDouble("-", value));
+  BOOST_CHECK(!ParseDouble("1e400", value));
+
+  // an exponent without digits is not part of the number
+  const char text[] = "1e+";
+  BOOST_CHECK_EQUAL(NumberParser::ReadDouble(text, text + 3, value),
+                    text + 1);
+  BOOST_CHECK_EQUAL(value, 1.0);
+}
+
+BOOST_AUTO_TEST_CASE(TestParseDoubleRoundTrip) {
+  // the shortest text of a double is parsed back to the same double
+  double value = 1.0;
+  for (int i = 0; i < 2000; i++) {
+    value = value * -1.37 + 0.123456789 / (i + 1);
+    if (std::fabs(value) > 1e300) {
+      value = 1.0 / value;
+    }
+
+    char buf[32];
+    for (int precision = 1; precision <= 17; precision++) {
+      snprintf(buf, sizeof(buf), "%.*g", precision, value);
+      if (strtod(buf, NULL) == value) {
+        break;
+      }
+    }
+
+    double parsed = 0.0;
+    BOOST_REQUIRE(ParseDouble(buf, parsed));
+    BOOST_REQUIRE_EQUAL(parsed, value);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
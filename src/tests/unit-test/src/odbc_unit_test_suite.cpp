@@ -13,6 +13,7 @@
  * permissions and limitations under the License.
  *
  */
+#include <chrono>
 #include <fstream>
 #include <odbc_unit_test_suite.h>
 
@@ -40,6 +41,21 @@ BOOST_GLOBAL_FIXTURE(OdbcUnitTestConfig);
 
 namespace timestream {
 namespace odbc {
+SQLRETURN SQL_API AsyncNotification::Callback(SQLPOINTER context, int) {
+  AsyncNotification* notification =
+      static_cast< AsyncNotification* >(context);
+  std::lock_guard< std::mutex > lock(notification->mutex);
+  notification->count++;
+  notification->cond.notify_all();
+  return SQL_SUCCESS;
+}
+
+bool AsyncNotification::Wait(int expected) {
+  std::unique_lock< std::mutex > lock(mutex);
+  return cond.wait_for(lock, std::chrono::seconds(10),
+                       [this, expected]() { return count >= expected; });
+}
+
 OdbcUnitTestSuite::OdbcUnitTestSuite()
     : env(new MockEnvironment()), dbc(nullptr), stmt(nullptr) {
   dbc = static_cast< MockConnection* >(env->CreateConnection());
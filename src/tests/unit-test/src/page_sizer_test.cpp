@@ -0,0 +1,65 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include "timestream/odbc/query/page_sizer.h"
+
+using timestream::odbc::query::PageSizer;
+using namespace boost::unit_test;
+
+BOOST_AUTO_TEST_SUITE(PageSizerTestSuite)
+
+BOOST_AUTO_TEST_CASE(TestGrowUntilMaxPageRows) {
+  // narrow rows fetched slower than they are drained
+  int32_t pageRows = PageSizer::firstPageRows;
+  pageRows = PageSizer::NextPageRows(pageRows, pageRows, pageRows * 100,
+                                     0.1, 0);
+  BOOST_CHECK_EQUAL(pageRows, PageSizer::firstPageRows
+                                  * PageSizer::growthFactor);
+
+  for (int i = 0; i < 5; i++) {
+    pageRows = PageSizer::NextPageRows(pageRows, pageRows, pageRows * 100,
+                                       0.1, 1000000);
+  }
+  BOOST_CHECK_EQUAL(pageRows, PageSizer::maxPageRows);
+}
+
+BOOST_AUTO_TEST_CASE(TestKeepSizeForSlowConsumer) {
+  // 400 rows are fetched in 0.1 second and drained in 4 seconds
+  BOOST_CHECK_EQUAL(PageSizer::NextPageRows(400, 400, 40000, 0.1, 100), 400);
+}
+
+BOOST_AUTO_TEST_CASE(TestLimitWideRows) {
+  // rows of 64 KB are limited to the target bytes of a page
+  size_t rowBytes = 64 * 1024;
+  int32_t pageRows = PageSizer::NextPageRows(100, 100, 100 * rowBytes, 0.1, 0);
+  BOOST_CHECK_EQUAL(pageRows,
+                    static_cast< int32_t >(PageSizer::targetPageBytes
+                                           / rowBytes));
+
+  // a single row larger than the target still makes progress
+  BOOST_CHECK_EQUAL(
+      PageSizer::NextPageRows(10, 10, 10 * PageSizer::targetPageBytes, 0.1, 0),
+      1);
+}
+
+BOOST_AUTO_TEST_CASE(TestEmptyPage) {
+  BOOST_CHECK_EQUAL(PageSizer::NextPageRows(100, 0, 0, 0.1, 0),
+                    100 * PageSizer::growthFactor);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
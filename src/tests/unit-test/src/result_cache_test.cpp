@@ -0,0 +1,204 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#ifndef _WIN32
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <chrono>
+#include <thread>
+
+#include <boost/test/unit_test.hpp>
+
+#include <ignite/common/include/common/platform_utils.h>
+#include "timestream/odbc/result_cache.h"
+
+#include <aws/timestream-query/model/ColumnInfo.h>
+#include <aws/timestream-query/model/Datum.h>
+#include <aws/timestream-query/model/Row.h>
+#include <aws/timestream-query/model/Type.h>
+
+using Aws::TimestreamQuery::Model::ColumnInfo;
+using Aws::TimestreamQuery::Model::Datum;
+using Aws::TimestreamQuery::Model::QueryResult;
+using Aws::TimestreamQuery::Model::Row;
+using Aws::TimestreamQuery::Model::ScalarType;
+using Aws::TimestreamQuery::Model::Type;
+using timestream::odbc::ResultCache;
+using namespace boost::unit_test;
+
+namespace {
+const std::string CACHE_DIRECTORY =
+    ResultCache::GetDefaultDirectory() + "-unit-test";
+
+QueryResult MakePage(const std::string& value, const std::string& nextToken) {
+  Type type;
+  type.SetScalarType(ScalarType::VARCHAR);
+  ColumnInfo info;
+  info.SetName("measure");
+  info.SetType(type);
+
+  Datum datum;
+  datum.SetScalarValue(value);
+  Datum nullDatum;
+  nullDatum.SetNullValue(true);
+  Row row;
+  row.AddData(datum);
+  row.AddData(nullDatum);
+
+  QueryResult page;
+  page.SetQueryId("queryId");
+  page.SetNextToken(nextToken);
+  page.AddColumnInfo(info);
+  page.AddRows(row);
+  return page;
+}
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(ResultCacheTestSuite)
+
+BOOST_AUTO_TEST_CASE(TestPutGet) {
+  ResultCache cache(CACHE_DIRECTORY, std::chrono::seconds(60), "user1");
+  std::string sql = "SELECT * FROM db.tbl WHERE measure = 'a  b'";
+
+  std::vector< std::string > serialized = {
+      ResultCache::SerializePage(MakePage("a", "token1"), false),
+      ResultCache::SerializePage(MakePage("b", ""), true)};
+  BOOST_REQUIRE(cache.Put(sql, serialized));
+
+  // white spaces outside of literals are ignored
+  std::vector< QueryResult > pages;
+  BOOST_REQUIRE(cache.Get(
+      "  SELECT *\n FROM db.tbl WHERE measure = 'a  b'", pages));
+  BOOST_REQUIRE_EQUAL(pages.size(), 2);
+
+  BOOST_CHECK_EQUAL(pages[0].GetQueryId(), "queryId");
+  BOOST_CHECK(!pages[0].GetNextToken().empty());
+  BOOST_CHECK(pages[1].GetNextToken().empty());
+  BOOST_REQUIRE_EQUAL(pages[1].GetColumnInfo().size(), 1);
+  BOOST_CHECK_EQUAL(pages[1].GetColumnInfo()[0].GetName(), "measure");
+  BOOST_CHECK(pages[1].GetColumnInfo()[0].GetType().GetScalarType()
+              == ScalarType::VARCHAR);
+  BOOST_REQUIRE_EQUAL(pages[1].GetRows().size(), 1);
+  const Aws::Vector< Datum >& data = pages[1].GetRows()[0].GetData();
+  BOOST_REQUIRE_EQUAL(data.size(), 2);
+  BOOST_CHECK_EQUAL(data[0].GetScalarValue(), "b");
+  BOOST_CHECK(data[1].NullValueHasBeenSet());
+
+  // literals are compared as is
+  BOOST_CHECK(!cache.Get("SELECT * FROM db.tbl WHERE measure = 'a b'", pages));
+  BOOST_CHECK(pages.empty());
+}
+
+BOOST_AUTO_TEST_CASE(TestIdentity) {
+  std::string sql = "SELECT * FROM db.tbl";
+  ResultCache cache1(CACHE_DIRECTORY, std::chrono::seconds(60), "user1");
+  ResultCache cache2(CACHE_DIRECTORY, std::chrono::seconds(60), "user2");
+
+  BOOST_REQUIRE(cache1.Put(
+      sql, {ResultCache::SerializePage(MakePage("a", ""), true)}));
+
+  std::vector< QueryResult > pages;
+  BOOST_CHECK(!cache2.Get(sql, pages));
+  BOOST_CHECK(cache1.Get(sql, pages));
+}
+
+BOOST_AUTO_TEST_CASE(TestExpiry) {
+  std::string sql = "SELECT * FROM db.expiry";
+  ResultCache cache(CACHE_DIRECTORY, std::chrono::seconds(1), "user1");
+
+  BOOST_REQUIRE(
+      cache.Put(sql, {ResultCache::SerializePage(MakePage("a", ""), true)}));
+
+  std::this_thread::sleep_for(std::chrono::seconds(2));
+
+  std::vector< QueryResult > pages;
+  BOOST_CHECK(!cache.Get(sql, pages));
+}
+
+#ifndef _WIN32
+BOOST_AUTO_TEST_CASE(TestRemoveExpired) {
+  // an expired entry is removed when another entry is written, even if its
+  // query is never run again
+  std::string directory = CACHE_DIRECTORY + "-expired-"
+                          + std::to_string(ignite::odbc::common::GetRandSeed());
+  ResultCache expiring(directory, std::chrono::seconds(1), "user1");
+  ResultCache cache(directory, std::chrono::seconds(60), "user2");
+  std::vector< std::string > serialized = {
+      ResultCache::SerializePage(MakePage("a", ""), true)};
+  BOOST_REQUIRE(expiring.Put("SELECT * FROM db.expired", serialized));
+
+  std::this_thread::sleep_for(std::chrono::seconds(2));
+  BOOST_REQUIRE(cache.Put("SELECT * FROM db.kept", serialized));
+
+  std::vector< std::string > names;
+  DIR* dir = opendir(directory.c_str());
+  BOOST_REQUIRE(dir);
+  while (struct dirent* entry = readdir(dir)) {
+    if (entry->d_name[0] != '.') {
+      names.emplace_back(entry->d_name);
+    }
+  }
+  closedir(dir);
+  BOOST_CHECK_EQUAL(names.size(), 1);
+
+  std::vector< QueryResult > pages;
+  BOOST_CHECK(cache.Get("SELECT * FROM db.kept", pages));
+
+  for (const std::string& name : names) {
+    unlink((directory + "/" + name).c_str());
+  }
+  rmdir(directory.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(TestUnsafeDirectory) {
+  // a directory other users could write to is not used
+  std::string directory = CACHE_DIRECTORY + "-shared";
+  rmdir(directory.c_str());
+  BOOST_REQUIRE_EQUAL(mkdir(directory.c_str(), 0700), 0);
+  BOOST_REQUIRE_EQUAL(chmod(directory.c_str(), 0777), 0);
+  BOOST_CHECK(!ResultCache::EnsureDirectory(directory));
+
+  ResultCache cache(directory, std::chrono::seconds(60), "user1");
+  std::vector< std::string > serialized = {
+      ResultCache::SerializePage(MakePage("a", ""), true)};
+  BOOST_CHECK(!cache.Put("SELECT 1", serialized));
+  rmdir(directory.c_str());
+
+  // a symbolic link to a directory of the user is not used either
+  std::string link = CACHE_DIRECTORY + "-link";
+  unlink(link.c_str());
+  BOOST_REQUIRE(ResultCache::EnsureDirectory(CACHE_DIRECTORY));
+  BOOST_REQUIRE_EQUAL(symlink(CACHE_DIRECTORY.c_str(), link.c_str()), 0);
+  BOOST_CHECK(!ResultCache::EnsureDirectory(link));
+  unlink(link.c_str());
+}
+#endif  // _WIN32
+
+BOOST_AUTO_TEST_CASE(TestDisabled) {
+  std::string sql = "SELECT * FROM db.disabled";
+  ResultCache cache(CACHE_DIRECTORY, std::chrono::seconds(0), "user1");
+
+  BOOST_CHECK(
+      !cache.Put(sql, {ResultCache::SerializePage(MakePage("a", ""), true)}));
+
+  std::vector< QueryResult > pages;
+  BOOST_CHECK(!cache.Get(sql, pages));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,109 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include "timestream/odbc/result_cache.h"
+#include "timestream/odbc/result_page_store.h"
+
+#include <aws/timestream-query/model/ColumnInfo.h>
+#include <aws/timestream-query/model/Datum.h>
+#include <aws/timestream-query/model/Row.h>
+#include <aws/timestream-query/model/Type.h>
+
+using Aws::TimestreamQuery::Model::ColumnInfo;
+using Aws::TimestreamQuery::Model::Datum;
+using Aws::TimestreamQuery::Model::QueryResult;
+using Aws::TimestreamQuery::Model::Row;
+using Aws::TimestreamQuery::Model::ScalarType;
+using Aws::TimestreamQuery::Model::Type;
+using timestream::odbc::ColumnarPage;
+using timestream::odbc::ResultCache;
+using timestream::odbc::ResultPageStore;
+using namespace boost::unit_test;
+
+namespace {
+const std::string SPILL_DIRECTORY =
+    ResultCache::GetDefaultDirectory() + "-unit-test";
+
+std::shared_ptr< QueryResult > MakePage(int firstValue, int rowCount) {
+  Type type;
+  type.SetScalarType(ScalarType::INTEGER);
+  ColumnInfo info;
+  info.SetName("value");
+  info.SetType(type);
+
+  auto page = std::make_shared< QueryResult >();
+  page->AddColumnInfo(info);
+  for (int i = 0; i < rowCount; i++) {
+    Datum datum;
+    datum.SetScalarValue(std::to_string(firstValue + i));
+    Row row;
+    row.AddData(datum);
+    page->AddRows(row);
+  }
+  return page;
+}
+
+void CheckRows(ResultPageStore& store, int64_t rowCount) {
+  BOOST_REQUIRE_EQUAL(store.GetRowCount(), rowCount);
+  for (int64_t row = rowCount - 1; row >= 0; row--) {
+    std::shared_ptr< QueryResult > page;
+    std::shared_ptr< const ColumnarPage > columns;
+    size_t rowIdx = 0;
+    BOOST_REQUIRE(store.Find(row, page, columns, rowIdx));
+    BOOST_REQUIRE_LT(rowIdx, page->GetRows().size());
+    BOOST_CHECK_EQUAL(page->GetRows()[rowIdx].GetData()[0].GetScalarValue(),
+                      std::to_string(row));
+  }
+
+  std::shared_ptr< QueryResult > page;
+  std::shared_ptr< const ColumnarPage > columns;
+  size_t rowIdx = 0;
+  BOOST_CHECK(!store.Find(rowCount, page, columns, rowIdx));
+  BOOST_CHECK(!store.Find(-1, page, columns, rowIdx));
+}
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(ResultPageStoreTestSuite)
+
+BOOST_AUTO_TEST_CASE(TestInMemory) {
+  ResultPageStore store(0, SPILL_DIRECTORY);
+
+  store.Add(MakePage(0, 3), nullptr);
+  // empty pages are skipped
+  store.Add(MakePage(3, 0), nullptr);
+  store.Add(MakePage(3, 2), nullptr);
+  store.Add(MakePage(5, 4), nullptr);
+
+  CheckRows(store, 9);
+  BOOST_CHECK_GT(store.GetMemoryUsed(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(TestSpill) {
+  // every page but the newest is spilled
+  ResultPageStore store(1, SPILL_DIRECTORY);
+
+  store.Add(MakePage(0, 3), nullptr);
+  size_t pageBytes = store.GetMemoryUsed();
+  store.Add(MakePage(3, 3), nullptr);
+  store.Add(MakePage(6, 3), nullptr);
+  BOOST_CHECK_EQUAL(store.GetMemoryUsed(), pageBytes);
+
+  CheckRows(store, 9);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
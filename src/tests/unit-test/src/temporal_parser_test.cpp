@@ -0,0 +1,163 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstring>
+#include <ctime>
+
+#include "timestream/odbc/temporal_parser.h"
+#include "timestream/odbc/utils.h"
+
+using timestream::odbc::TemporalParser;
+using namespace boost::unit_test;
+
+namespace {
+bool ParseTimestamp(const char* str, SQL_TIMESTAMP_STRUCT& value) {
+  return TemporalParser::ParseTimestamp(str, strlen(str), value);
+}
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TemporalParserTestSuite)
+
+BOOST_AUTO_TEST_CASE(TestParseTimestamp) {
+  SQL_TIMESTAMP_STRUCT value{};
+  BOOST_CHECK(ParseTimestamp("2022-10-20 19:01:02.123456789", value));
+  BOOST_CHECK_EQUAL(value.year, 2022);
+  BOOST_CHECK_EQUAL(value.month, 10);
+  BOOST_CHECK_EQUAL(value.day, 20);
+  BOOST_CHECK_EQUAL(value.hour, 19);
+  BOOST_CHECK_EQUAL(value.minute, 1);
+  BOOST_CHECK_EQUAL(value.second, 2);
+  BOOST_CHECK_EQUAL(value.fraction, 123456789);
+  BOOST_CHECK_EQUAL(TemporalParser::ToEpochSeconds(value), 1666292462LL);
+
+  // a short fraction is in tenths, hundredths and so on
+  BOOST_CHECK(ParseTimestamp("1970-01-01 00:00:01.5", value));
+  BOOST_CHECK_EQUAL(value.fraction, 500000000);
+  BOOST_CHECK(ParseTimestamp("1970-01-01 00:00:01", value));
+  BOOST_CHECK_EQUAL(value.fraction, 0);
+  BOOST_CHECK_EQUAL(TemporalParser::ToEpochSeconds(value), 1);
+
+  BOOST_CHECK(!ParseTimestamp("", value));
+  BOOST_CHECK(!ParseTimestamp("2022-10-20", value));
+  BOOST_CHECK(!ParseTimestamp("2022-10-20 19:01", value));
+  BOOST_CHECK(!ParseTimestamp("2022-13-20 19:01:02", value));
+  BOOST_CHECK(!ParseTimestamp("2022-10-20 24:01:02", value));
+  BOOST_CHECK(!ParseTimestamp("2022-10-20 19:01:02.", value));
+  BOOST_CHECK(!ParseTimestamp("2022-10-20 19:01:02.1234567890", value));
+  BOOST_CHECK(!ParseTimestamp("2022-10-20 19:01:02 ", value));
+  BOOST_CHECK(!ParseTimestamp("2022-1a-20 19:01:02", value));
+}
+
+BOOST_AUTO_TEST_CASE(TestParseDateAndTime) {
+  SQL_DATE_STRUCT date{};
+  BOOST_CHECK(TemporalParser::ParseDate("2000-02-29", 10, date));
+  BOOST_CHECK_EQUAL(date.year, 2000);
+  BOOST_CHECK_EQUAL(date.month, 2);
+  BOOST_CHECK_EQUAL(date.day, 29);
+  BOOST_CHECK(!TemporalParser::ParseDate("2000-02-29 00", 13, date));
+
+  SQL_TIME_STRUCT time{};
+  int32_t fraction = 0;
+  BOOST_CHECK(TemporalParser::ParseTime("23:59:58.000000001", 18, time,
+                                        fraction));
+  BOOST_CHECK_EQUAL(time.hour, 23);
+  BOOST_CHECK_EQUAL(time.minute, 59);
+  BOOST_CHECK_EQUAL(time.second, 58);
+  BOOST_CHECK_EQUAL(fraction, 1);
+  BOOST_CHECK(!TemporalParser::ParseTime("23:60:58", 8, time, fraction));
+}
+
+BOOST_AUTO_TEST_CASE(TestParseInterval) {
+  int32_t year = 0;
+  int32_t month = 0;
+  BOOST_CHECK(TemporalParser::ParseIntervalYearMonth("1-2", 3, year, month));
+  BOOST_CHECK_EQUAL(year, 1);
+  BOOST_CHECK_EQUAL(month, 2);
+  BOOST_CHECK(TemporalParser::ParseIntervalYearMonth("-10-11", 6, year, month));
+  BOOST_CHECK_EQUAL(year, -10);
+  BOOST_CHECK_EQUAL(month, 11);
+  BOOST_CHECK(!TemporalParser::ParseIntervalYearMonth("1", 1, year, month));
+
+  int32_t day = 0;
+  int32_t hour = 0;
+  int32_t minute = 0;
+  int32_t second = 0;
+  int32_t fraction = 0;
+  BOOST_CHECK(TemporalParser::ParseIntervalDaySecond(
+      "3 04:05:06.000000007", 20, day, hour, minute, second, fraction));
+  BOOST_CHECK_EQUAL(day, 3);
+  BOOST_CHECK_EQUAL(hour, 4);
+  BOOST_CHECK_EQUAL(minute, 5);
+  BOOST_CHECK_EQUAL(second, 6);
+  BOOST_CHECK_EQUAL(fraction, 7);
+  BOOST_CHECK(TemporalParser::ParseIntervalDaySecond(
+      "-12 00:00:01", 12, day, hour, minute, second, fraction));
+  BOOST_CHECK_EQUAL(day, -12);
+  BOOST_CHECK_EQUAL(fraction, 0);
+  BOOST_CHECK(!TemporalParser::ParseIntervalDaySecond(
+      "3 04:05", 7, day, hour, minute, second, fraction));
+}
+
+BOOST_AUTO_TEST_CASE(TestCivilDays) {
+  BOOST_CHECK_EQUAL(TemporalParser::DaysFromCivil(1970, 1, 1), 0);
+  BOOST_CHECK_EQUAL(TemporalParser::DaysFromCivil(1969, 12, 31), -1);
+  BOOST_CHECK_EQUAL(TemporalParser::DaysFromCivil(2000, 3, 1), 11017);
+
+  // every day of four centuries round trips
+  int64_t first = TemporalParser::DaysFromCivil(1800, 1, 1);
+  int64_t last = TemporalParser::DaysFromCivil(2200, 1, 1);
+  for (int64_t days = first; days < last; days++) {
+    int64_t year;
+    uint32_t month, day;
+    TemporalParser::CivilFromDays(days, year, month, day);
+    BOOST_REQUIRE_EQUAL(TemporalParser::DaysFromCivil(year, month, day), days);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(TestEpochSecondsToCTm) {
+  // compare with gmtime for a range of times before and after epoch
+  for (int64_t seconds = -86400LL * 800; seconds < 86400LL * 20000;
+       seconds += 86400LL * 7 + 3601) {
+    tm expected;
+    BOOST_REQUIRE(ignite::odbc::common::IgniteGmTime(
+        static_cast< time_t >(seconds), expected));
+
+    tm actual;
+    BOOST_REQUIRE(
+        timestream::odbc::common::EpochSecondsToCTm(seconds, actual));
+    BOOST_REQUIRE_EQUAL(actual.tm_year, expected.tm_year);
+    BOOST_REQUIRE_EQUAL(actual.tm_mon, expected.tm_mon);
+    BOOST_REQUIRE_EQUAL(actual.tm_mday, expected.tm_mday);
+    BOOST_REQUIRE_EQUAL(actual.tm_hour, expected.tm_hour);
+    BOOST_REQUIRE_EQUAL(actual.tm_min, expected.tm_min);
+    BOOST_REQUIRE_EQUAL(actual.tm_sec, expected.tm_sec);
+    BOOST_REQUIRE_EQUAL(actual.tm_wday, expected.tm_wday);
+    BOOST_REQUIRE_EQUAL(actual.tm_yday, expected.tm_yday);
+  }
+
+  SQL_TIMESTAMP_STRUCT value{};
+  TemporalParser::FromEpochSeconds(-1, value);
+  BOOST_CHECK_EQUAL(value.year, 1969);
+  BOOST_CHECK_EQUAL(value.month, 12);
+  BOOST_CHECK_EQUAL(value.day, 31);
+  BOOST_CHECK_EQUAL(value.hour, 23);
+  BOOST_CHECK_EQUAL(value.minute, 59);
+  BOOST_CHECK_EQUAL(value.second, 59);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,132 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include "timestream/odbc/query/time_range_splitter.h"
+
+using timestream::odbc::query::TimeRangeSplitter;
+using namespace boost::unit_test;
+
+BOOST_AUTO_TEST_SUITE(TimeRangeSplitterTestSuite)
+
+BOOST_AUTO_TEST_CASE(TestParseTimestamp) {
+  int64_t nanos = 0;
+
+  BOOST_CHECK(TimeRangeSplitter::ParseTimestamp("1970-01-02", nanos));
+  BOOST_CHECK_EQUAL(nanos, 86400000000000LL);
+
+  BOOST_CHECK(TimeRangeSplitter::ParseTimestamp("1970-01-01 00:00:01", nanos));
+  BOOST_CHECK_EQUAL(nanos, 1000000000LL);
+
+  BOOST_CHECK(
+      TimeRangeSplitter::ParseTimestamp("1970-01-01 00:00:01.5", nanos));
+  BOOST_CHECK_EQUAL(nanos, 1500000000LL);
+
+  BOOST_CHECK(TimeRangeSplitter::ParseTimestamp(
+      "1970-01-01 00:00:00.000000001", nanos));
+  BOOST_CHECK_EQUAL(nanos, 1LL);
+
+  BOOST_CHECK(!TimeRangeSplitter::ParseTimestamp("ago(1h)", nanos));
+  BOOST_CHECK(!TimeRangeSplitter::ParseTimestamp("1970-01-01 00:00", nanos));
+  BOOST_CHECK(!TimeRangeSplitter::ParseTimestamp(
+      "1970-01-01 00:00:00.0000000001", nanos));
+}
+
+BOOST_AUTO_TEST_CASE(TestSplit) {
+  std::vector< std::string > subQueries;
+
+  BOOST_REQUIRE(TimeRangeSplitter::Split(
+      "SELECT * FROM db.tbl WHERE time BETWEEN '1970-01-01' AND "
+      "TIMESTAMP '1970-01-01 00:00:03' AND measure_name = 'cpu'",
+      3, subQueries));
+  BOOST_REQUIRE_EQUAL(subQueries.size(), 3);
+  BOOST_CHECK_EQUAL(subQueries[0],
+                    "SELECT * FROM db.tbl WHERE (time >= from_nanoseconds(0) "
+                    "AND time < from_nanoseconds(1000000000)) AND "
+                    "measure_name = 'cpu'");
+  BOOST_CHECK_EQUAL(subQueries[1],
+                    "SELECT * FROM db.tbl WHERE (time >= "
+                    "from_nanoseconds(1000000000) AND time < "
+                    "from_nanoseconds(2000000000)) AND measure_name = 'cpu'");
+  BOOST_CHECK_EQUAL(subQueries[2],
+                    "SELECT * FROM db.tbl WHERE (time >= "
+                    "from_nanoseconds(2000000000) AND time <= "
+                    "from_nanoseconds(3000000000)) AND measure_name = 'cpu'");
+}
+
+BOOST_AUTO_TEST_CASE(TestSplitUnsupported) {
+  const char* queries[] = {
+      // no time range
+      "SELECT * FROM db.tbl",
+      // aggregation
+      "SELECT count(*) FROM db.tbl WHERE time BETWEEN '2022-01-01' AND "
+      "'2022-01-02'",
+      // ordering
+      "SELECT * FROM db.tbl WHERE time BETWEEN '2022-01-01' AND "
+      "'2022-01-02' ORDER BY time",
+      // OR condition
+      "SELECT * FROM db.tbl WHERE a = 1 OR time BETWEEN '2022-01-01' AND "
+      "'2022-01-02'",
+      // sub query
+      "SELECT * FROM (SELECT * FROM db.tbl) WHERE time BETWEEN '2022-01-01' "
+      "AND '2022-01-02'",
+      // relative time range
+      "SELECT * FROM db.tbl WHERE time BETWEEN ago(1h) AND now()",
+      // empty time range
+      "SELECT * FROM db.tbl WHERE time BETWEEN '2022-01-02' AND "
+      "'2022-01-01'",
+      // time range compared with something else
+      "SELECT * FROM db.tbl WHERE time BETWEEN '2022-01-01' AND "
+      "'2022-01-02' = true",
+      // negated time range
+      "SELECT * FROM db.tbl WHERE NOT (a = 1 AND time BETWEEN '2022-01-01' "
+      "AND '2022-01-02')",
+      "SELECT * FROM db.tbl WHERE a NOT IN (1) AND time BETWEEN '2022-01-01' "
+      "AND '2022-01-02'",
+      // time range in parentheses
+      "SELECT * FROM db.tbl WHERE (a = 1 AND time BETWEEN '2022-01-01' AND "
+      "'2022-01-02')",
+      // time range in the select list
+      "SELECT x > 1 AND time BETWEEN '2022-01-01' AND '2022-01-02' AS f "
+      "FROM db.tbl",
+      "SELECT x > 1 AND time BETWEEN '2022-01-01' AND '2022-01-02' AS f "
+      "FROM db.tbl WHERE a = 1",
+      // conditional time range
+      "SELECT * FROM db.tbl WHERE CASE WHEN a = 1 AND time BETWEEN "
+      "'2022-01-01' AND '2022-01-02' THEN true ELSE false END"};
+
+  for (const char* sql : queries) {
+    std::vector< std::string > subQueries;
+    BOOST_CHECK_MESSAGE(!TimeRangeSplitter::Split(sql, 4, subQueries), sql);
+    BOOST_CHECK(subQueries.empty());
+  }
+
+  // the keywords in literals are ignored
+  std::vector< std::string > subQueries;
+  BOOST_CHECK(TimeRangeSplitter::Split(
+      "SELECT * FROM db.tbl WHERE time BETWEEN '2022-01-01' AND "
+      "'2022-01-02' AND measure_name = 'order by'",
+      4, subQueries));
+
+  // splitting is disabled
+  BOOST_CHECK(!TimeRangeSplitter::Split(
+      "SELECT * FROM db.tbl WHERE time BETWEEN '2022-01-01' AND "
+      "'2022-01-02'",
+      1, subQueries));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,188 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include <sqlext.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstring>
+#include <string>
+
+#include "timestream/odbc/timestream_column.h"
+#include "timestream/odbc/type_traits.h"
+
+#include <aws/timestream-query/model/ColumnInfo.h>
+#include <aws/timestream-query/model/Datum.h>
+#include <aws/timestream-query/model/Row.h>
+#include <aws/timestream-query/model/TimeSeriesDataPoint.h>
+#include <aws/timestream-query/model/Type.h>
+
+using Aws::TimestreamQuery::Model::ColumnInfo;
+using Aws::TimestreamQuery::Model::Datum;
+using Aws::TimestreamQuery::Model::Row;
+using Aws::TimestreamQuery::Model::ScalarType;
+using Aws::TimestreamQuery::Model::TimeSeriesDataPoint;
+using Aws::TimestreamQuery::Model::Type;
+using timestream::odbc::TimestreamColumn;
+using timestream::odbc::app::ApplicationDataBuffer;
+using timestream::odbc::app::ConversionResult;
+using timestream::odbc::meta::ColumnMeta;
+using timestream::odbc::type_traits::OdbcNativeType;
+using namespace boost::unit_test;
+
+namespace {
+ColumnMeta MakeColumnMeta(ScalarType type) {
+  Type columnType;
+  columnType.SetScalarType(type);
+
+  ColumnInfo info;
+  info.SetName("c");
+  info.SetType(columnType);
+
+  ColumnMeta meta;
+  meta.ReadMetadata(info);
+  return meta;
+}
+
+std::string ReadText(ScalarType type, const std::string& value) {
+  ColumnMeta meta = MakeColumnMeta(type);
+  TimestreamColumn column(0, meta);
+
+  Datum datum;
+  datum.SetScalarValue(value);
+
+  char buffer[64]{};
+  SqlLen reslen = 0;
+  ApplicationDataBuffer dataBuf(OdbcNativeType::AI_CHAR, buffer,
+                                sizeof(buffer), &reslen);
+  BOOST_CHECK(column.IsTemporalText(dataBuf));
+  BOOST_CHECK(column.ReadToBuffer(datum, dataBuf)
+              == ConversionResult::Type::AI_SUCCESS);
+  BOOST_CHECK_EQUAL(reslen, static_cast< SqlLen >(strlen(buffer)));
+  return buffer;
+}
+
+Datum MakeScalar(const std::string& value) {
+  Datum datum;
+  datum.SetScalarValue(value);
+  return datum;
+}
+
+Datum MakeNull() {
+  Datum datum;
+  datum.SetNullValue(true);
+  return datum;
+}
+
+std::string ReadNested(const Datum& datum) {
+  // a column of nested values has no scalar type and is read as VARCHAR
+  ColumnInfo elementInfo;
+  elementInfo.SetType(Type().WithScalarType(ScalarType::VARCHAR));
+  Type columnType;
+  columnType.SetArrayColumnInfo(elementInfo);
+
+  ColumnInfo info;
+  info.SetName("c");
+  info.SetType(columnType);
+
+  ColumnMeta meta;
+  meta.ReadMetadata(info);
+  TimestreamColumn column(0, meta);
+
+  std::string buffer(4096, '\0');
+  SqlLen reslen = 0;
+  ApplicationDataBuffer dataBuf(OdbcNativeType::AI_CHAR, &buffer[0],
+                                buffer.size(), &reslen);
+  BOOST_CHECK(column.ReadToBuffer(datum, dataBuf)
+              == ConversionResult::Type::AI_SUCCESS);
+  BOOST_CHECK_EQUAL(reslen, static_cast< SqlLen >(strlen(buffer.c_str())));
+  return buffer.c_str();
+}
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TimestreamColumnTestSuite)
+
+BOOST_AUTO_TEST_CASE(TestTemporalText) {
+  // canonical values are copied
+  BOOST_CHECK_EQUAL(
+      ReadText(ScalarType::TIMESTAMP, "2022-10-20 19:01:02.123456789"),
+      "2022-10-20 19:01:02.123456789");
+  BOOST_CHECK_EQUAL(ReadText(ScalarType::DATE, "1969-12-31"), "1969-12-31");
+  BOOST_CHECK_EQUAL(ReadText(ScalarType::TIME, "23:59:58.000000001"),
+                    "23:59:58.000000001");
+
+  // other values are normalized to nine fraction digits
+  BOOST_CHECK_EQUAL(ReadText(ScalarType::TIMESTAMP, "2022-10-20T19:01:02.5"),
+                    "2022-10-20 19:01:02.500000000");
+  BOOST_CHECK_EQUAL(ReadText(ScalarType::TIME, "01:02:03"),
+                    "01:02:03.000000000");
+
+  // a column read to a non character buffer is converted
+  ColumnMeta meta = MakeColumnMeta(ScalarType::TIMESTAMP);
+  TimestreamColumn column(0, meta);
+  SQL_TIMESTAMP_STRUCT ts;
+  SqlLen reslen = 0;
+  ApplicationDataBuffer tsBuf(OdbcNativeType::AI_TTIMESTAMP, &ts, sizeof(ts),
+                              &reslen);
+  BOOST_CHECK(!column.IsTemporalText(tsBuf));
+}
+
+BOOST_AUTO_TEST_CASE(TestNestedTypes) {
+  Datum array;
+  array.SetArrayValue({MakeScalar("1"), MakeNull(), MakeScalar("3")});
+  BOOST_CHECK_EQUAL(ReadNested(array), "[1,,3]");
+
+  Datum emptyArray;
+  emptyArray.SetArrayValue({});
+  BOOST_CHECK_EQUAL(ReadNested(emptyArray), "");
+
+  Row row;
+  row.SetData({MakeScalar("a"), array});
+  Datum rowDatum;
+  rowDatum.SetRowValue(row);
+  BOOST_CHECK_EQUAL(ReadNested(rowDatum), "(a,[1,,3])");
+
+  TimeSeriesDataPoint first;
+  first.SetTime("2022-10-20 19:01:02.000000000");
+  first.SetValue(MakeScalar("1.5"));
+  TimeSeriesDataPoint second;
+  second.SetTime("2022-10-20 19:01:03.000000000");
+  second.SetValue(rowDatum);
+  Datum timeSeries;
+  timeSeries.SetTimeSeriesValue({first, second});
+  BOOST_CHECK_EQUAL(ReadNested(timeSeries),
+                    "[{time: 2022-10-20 19:01:02.000000000, value: 1.5},"
+                    "{time: 2022-10-20 19:01:03.000000000, value: "
+                    "(a,[1,,3])}]");
+
+  Datum emptyTimeSeries;
+  emptyTimeSeries.SetTimeSeriesValue({});
+  BOOST_CHECK_EQUAL(ReadNested(emptyTimeSeries), "[]");
+
+  // nested values longer than 1024 characters are not truncated
+  std::string longText(2000, 'x');
+  Datum longArray;
+  longArray.SetArrayValue({MakeScalar(longText)});
+  Datum outer;
+  outer.SetArrayValue({longArray, MakeScalar("y")});
+  BOOST_CHECK_EQUAL(ReadNested(outer), "[[" + longText + "],y]");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -26,6 +26,7 @@
 #include "timestream/odbc/log.h"
 #include <regex>
 
+using timestream::odbc::AsyncNotification;
 using timestream::odbc::AuthType;
 using timestream::odbc::MockConnection;
 using timestream::odbc::MockTimestreamService;
@@ -198,6 +199,52 @@ BOOST_AUTO_TEST_CASE(TestRelease) {
   BOOST_CHECK_EQUAL(GetSqlState(), "08003");
 }
 
+BOOST_AUTO_TEST_CASE(TestEstablishAsyncNotification) {
+  // Test connecting and disconnecting asynchronously, the completion is
+  // notified through the callback set by the Driver Manager
+  Configuration cfg;
+  cfg.SetAuthType(AuthType::Type::IAM);
+  cfg.SetAccessKeyId("AwsTSUnitTestKeyId");
+  cfg.SetSecretKey("AwsTSUnitTestSecretKey");
+  getLogOptions(cfg);
+
+  AsyncNotification notification;
+  dbc->SetAttribute(
+      SQL_ATTR_ASYNC_DBC_FUNCTIONS_ENABLE,
+      reinterpret_cast< SQLPOINTER >(SQL_ASYNC_DBC_ENABLE_ON), 0);
+  dbc->SetAttribute(
+      SQL_ATTR_ASYNC_DBC_NOTIFICATION_CALLBACK,
+      reinterpret_cast< SQLPOINTER >(&AsyncNotification::Callback), 0);
+  dbc->SetAttribute(SQL_ATTR_ASYNC_DBC_NOTIFICATION_CONTEXT, &notification,
+                    0);
+  BOOST_CHECK(IsSuccessful());
+
+  dbc->Establish(cfg);
+  BOOST_CHECK_EQUAL(GetReturnCode(), SQL_STILL_EXECUTING);
+  BOOST_REQUIRE(notification.Wait(1));
+
+  // other functions fail until the result is returned
+  BOOST_CHECK(dbc->CreateStatement() == nullptr);
+  BOOST_CHECK_EQUAL(GetReturnCode(), SQL_ERROR);
+  BOOST_CHECK_EQUAL(GetSqlState(), "HY010");
+
+  dbc->SetAttribute(SQL_ATTR_AUTOCOMMIT,
+                    reinterpret_cast< SQLPOINTER >(SQL_AUTOCOMMIT_ON), 0);
+  BOOST_CHECK_EQUAL(GetReturnCode(), SQL_ERROR);
+  BOOST_CHECK_EQUAL(GetSqlState(), "HY010");
+
+  // the call after the notification returns the result
+  dbc->Establish(cfg);
+  BOOST_CHECK(IsSuccessful());
+
+  dbc->Release();
+  BOOST_CHECK_EQUAL(GetReturnCode(), SQL_STILL_EXECUTING);
+  BOOST_REQUIRE(notification.Wait(2));
+
+  dbc->Release();
+  BOOST_CHECK(IsSuccessful());
+}
+
 BOOST_AUTO_TEST_CASE(TestDeregister) {
   // This will remove dbc from env, any test that
   // needs env should be put ahead of this testcase
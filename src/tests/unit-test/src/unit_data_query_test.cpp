@@ -14,22 +14,32 @@
  *
  */
 
+#include <algorithm>
+#include <chrono>
+#include <functional>
 #include <string>
+#include <thread>
 
 #include <odbc_unit_test_suite.h>
 #include "timestream/odbc/log.h"
 #include "timestream/odbc/log_level.h"
 #include <ignite/common/include/common/platform_utils.h>
 #include <timestream/odbc/authentication/auth_type.h>
+#include "timestream/odbc/query/page_sizer.h"
 #include "timestream/odbc/statement.h"
 #include "timestream/odbc/utility.h"
 
+using timestream::odbc::AsyncNotification;
 using timestream::odbc::AuthType;
 using timestream::odbc::MockConnection;
 using timestream::odbc::MockTimestreamService;
 using timestream::odbc::OdbcUnitTestSuite;
 using timestream::odbc::Statement;
+using timestream::odbc::app::ApplicationDataBuffer;
+using timestream::odbc::meta::ColumnMetaVector;
+using timestream::odbc::query::PageSizer;
 using timestream::odbc::config::Configuration;
+using timestream::odbc::type_traits::OdbcNativeType;
 using namespace boost::unit_test;
 
 /**
@@ -82,6 +92,10 @@ struct DataQueryUnitTestSuiteFixture : OdbcUnitTestSuite {
 
   void Connect() {
     Configuration cfg;
+    Connect(cfg);
+  }
+
+  void Connect(Configuration& cfg) {
     cfg.SetAuthType(AuthType::Type::IAM);
     cfg.SetAccessKeyId("AwsTSUnitTestKeyId");
     cfg.SetSecretKey("AwsTSUnitTestSecretKey");
@@ -89,6 +103,69 @@ struct DataQueryUnitTestSuiteFixture : OdbcUnitTestSuite {
 
     dbc->Establish(cfg);
   }
+
+  void PollAsync(const std::function< void() >& call) {
+    call();
+    while (GetReturnCode() == SQL_STILL_EXECUTING) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      call();
+    }
+  }
+
+  /**
+   * Make a result cache directory which is not used by other runs.
+   *
+   * @return Directory path.
+   */
+  std::string MakeCacheDirectory() const {
+    return timestream::odbc::ResultCache::GetDefaultDirectory() + "-unit-test-"
+           + std::to_string(ignite::odbc::common::GetRandSeed());
+  }
+
+  void CheckTimeRangeFanOut(bool ordered) {
+    Configuration cfg;
+    cfg.SetQueryFanOut(4);
+    cfg.SetFanOutOrdered(ordered);
+    Connect(cfg);
+
+    // each time range is a day and returns the rows of hour 1, 2 and 3,
+    // the range of the first day is returned last
+    std::string sql =
+        "select measure, time from mockDB.mockTableDays where time between "
+        "'2022-11-09 00:00:00' and '2022-11-13 00:00:00'";
+    stmt->ExecuteSqlQuery(sql);
+    BOOST_CHECK(IsSuccessful());
+
+    SQL_TIMESTAMP_STRUCT timestamp;
+    SQLLEN timestamp_len = 0;
+    stmt->BindColumn(2, SQL_C_TYPE_TIMESTAMP, &timestamp, sizeof(timestamp),
+                     &timestamp_len);
+
+    std::vector< int > hours;
+    for (int i = 0; i < 12; i++) {
+      stmt->FetchRow();
+      BOOST_CHECK(IsSuccessful());
+      hours.push_back((timestamp.day - 9) * 24 + timestamp.hour);
+    }
+
+    stmt->FetchRow();
+    BOOST_CHECK_EQUAL(GetReturnCode(), SQL_NO_DATA);
+
+    std::vector< int > sorted = hours;
+    std::sort(sorted.begin(), sorted.end());
+    if (ordered) {
+      BOOST_CHECK(hours == sorted);
+    }
+
+    // all rows are returned once
+    std::vector< int > expected;
+    for (int day = 0; day < 4; day++) {
+      for (int hour = 1; hour <= 3; hour++) {
+        expected.push_back(day * 24 + hour);
+      }
+    }
+    BOOST_CHECK(sorted == expected);
+  }
 };
 
 BOOST_FIXTURE_TEST_SUITE(DataQueryUnitTestSuite, DataQueryUnitTestSuiteFixture)
@@ -136,6 +213,97 @@ BOOST_AUTO_TEST_CASE(TestDataQuery) {
   BOOST_CHECK_EQUAL(GetReturnCode(), SQL_NO_DATA);
 }
 
+BOOST_AUTO_TEST_CASE(TestDataQueryPrepareMeta) {
+  // Test the result set metadata of a prepared query is available before
+  // the query is executed
+  Connect();
+
+  std::string sql = "select measure, time from mockDB.mockTable";
+  stmt->PrepareSqlQuery(sql);
+
+  BOOST_CHECK(IsSuccessful());
+
+  BOOST_CHECK_EQUAL(stmt->GetColumnNumber(), 2);
+  BOOST_CHECK(IsSuccessful());
+}
+
+BOOST_AUTO_TEST_CASE(TestDataQueryGetDataBeforeFetch) {
+  // Test reading a column before the first row is fetched fails
+  Connect();
+
+  stmt->ExecuteSqlQuery("select measure, time from mockDB.mockTable");
+  BOOST_CHECK(IsSuccessful());
+
+  char measure[64]{};
+  SQLLEN measureLen = 0;
+  ApplicationDataBuffer buffer(OdbcNativeType::AI_CHAR, measure,
+                               sizeof(measure), &measureLen);
+  stmt->GetColumnData(1, buffer);
+  BOOST_CHECK_EQUAL(GetReturnCode(), SQL_ERROR);
+
+  stmt->FetchRow();
+  BOOST_CHECK(IsSuccessful());
+  stmt->GetColumnData(1, buffer);
+  BOOST_CHECK(IsSuccessful());
+  BOOST_CHECK_EQUAL(std::string(measure), "cpu_usage");
+}
+
+BOOST_AUTO_TEST_CASE(TestDataQueryPrepareMetaFallback) {
+  // Test the result set metadata is read from the first page of the query
+  // when PrepareQuery is denied, the rest of the query is cancelled
+  Connect();
+
+  int cancelCount = MockTimestreamService::GetInstance()->GetCancelCount();
+
+  stmt->PrepareSqlQuery("select measure, time from mockDB.unpreparedTable");
+  BOOST_CHECK(IsSuccessful());
+
+  BOOST_CHECK_EQUAL(stmt->GetColumnNumber(), 2);
+  BOOST_CHECK(IsSuccessful());
+  BOOST_CHECK_EQUAL(MockTimestreamService::GetInstance()->GetLastMaxRows(),
+                    1);
+  BOOST_CHECK_EQUAL(MockTimestreamService::GetInstance()->GetCancelCount(),
+                    cancelCount + 1);
+}
+
+BOOST_AUTO_TEST_CASE(TestDataQueryPrepareMetaError) {
+  // Test an error of PrepareQuery for the query itself is reported
+  // without running the query
+  Connect();
+
+  int cancelCount = MockTimestreamService::GetInstance()->GetCancelCount();
+
+  stmt->PrepareSqlQuery("select * from mockDB.invalidTable");
+  BOOST_CHECK(IsSuccessful());
+
+  stmt->GetColumnNumber();
+  BOOST_CHECK_EQUAL(GetReturnCode(), SQL_ERROR);
+  BOOST_CHECK_EQUAL(MockTimestreamService::GetInstance()->GetCancelCount(),
+                    cancelCount);
+}
+
+BOOST_AUTO_TEST_CASE(TestDataQueryMetaCacheInvalidate) {
+  // Test the cached metadata of a query is removed when the query fails,
+  // so it is not returned for a table which is dropped or altered
+  Configuration cfg;
+  cfg.SetMetadataCacheSize(10);
+  Connect(cfg);
+
+  std::string sql = "select measure, time from mockDB.mockTableDropped";
+  ColumnMetaVector meta;
+  BOOST_REQUIRE(dbc->GetMetaCache());
+
+  stmt->PrepareSqlQuery(sql);
+  BOOST_CHECK(IsSuccessful());
+  BOOST_CHECK_EQUAL(stmt->GetColumnNumber(), 2);
+  BOOST_CHECK(IsSuccessful());
+  BOOST_CHECK(dbc->GetMetaCache()->Get(sql, meta));
+
+  stmt->ExecuteSqlQuery();
+  BOOST_CHECK_EQUAL(GetReturnCode(), SQL_ERROR);
+  BOOST_CHECK(!dbc->GetMetaCache()->Get(sql, meta));
+}
+
 BOOST_AUTO_TEST_CASE(TestDataQuery10000Rows) {
   // Test fetching 10000 rows and each page contains 3 rows
   Connect();
@@ -151,6 +319,714 @@ BOOST_AUTO_TEST_CASE(TestDataQuery10000Rows) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(TestDataQuery10000RowsWithPrefetch) {
+  // Test fetching 10000 rows with 5 pages buffered ahead of the cursor
+  Configuration cfg;
+  cfg.SetPrefetchPages(5);
+  Connect(cfg);
+
+  std::string sql = "select measure, time from mockDB.mockTable10000";
+  stmt->ExecuteSqlQuery(sql);
+
+  BOOST_CHECK(IsSuccessful());
+
+  for (int i = 0; i < 10000; i++) {
+    stmt->FetchRow();
+    BOOST_CHECK(IsSuccessful());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(TestDataQuery10000RowsWithBufferLimit) {
+  // Test fetching 10000 rows with a memory budget on the buffered pages.
+  // All pages are returned to the budget when the cursor is closed.
+  Configuration cfg;
+  cfg.SetPrefetchPages(5);
+  cfg.SetMaxResultBufferMB(1);
+  Connect(cfg);
+
+  std::string sql = "select measure, time from mockDB.mockTable10000";
+  stmt->ExecuteSqlQuery(sql);
+
+  BOOST_CHECK(IsSuccessful());
+
+  for (int i = 0; i < 10000; i++) {
+    stmt->FetchRow();
+    BOOST_CHECK(IsSuccessful());
+  }
+
+  stmt->Close();
+  BOOST_CHECK_EQUAL(dbc->GetResultBufferBudget()->GetUsed(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(TestDataQueryAdaptivePageSize) {
+  // Test the first page is requested small and the next pages grow
+  Configuration cfg;
+  cfg.SetAdaptivePageSize(true);
+  Connect(cfg);
+
+  stmt->ExecuteSqlQuery("select measure, time from mockDB.mockTable");
+  BOOST_CHECK(IsSuccessful());
+  BOOST_CHECK_EQUAL(MockTimestreamService::GetInstance()->GetLastMaxRows(),
+                    PageSizer::firstPageRows);
+  stmt->Close();
+
+  stmt->ExecuteSqlQuery("select measure, time from mockDB.mockTable10000");
+  BOOST_CHECK(IsSuccessful());
+  for (int i = 0; i < 10; i++) {
+    stmt->FetchRow();
+    BOOST_CHECK(IsSuccessful());
+  }
+
+  stmt->Close();
+  dbc->GetBackgroundWorkers()->JoinAll();
+  BOOST_CHECK_GT(MockTimestreamService::GetInstance()->GetLastMaxRows(),
+                 PageSizer::firstPageRows);
+}
+
+BOOST_AUTO_TEST_CASE(TestDataQueryMaxRows) {
+  // Test fetching a result of endless 3-row pages with max rows 5. The
+  // second page is sized to the 2 remaining rows and the query is
+  // cancelled after it.
+  Connect();
+
+  stmt->SetAttribute(SQL_ATTR_MAX_ROWS, reinterpret_cast< SQLPOINTER >(5), 0);
+  BOOST_CHECK(IsSuccessful());
+
+  SQLULEN maxRows = 0;
+  stmt->GetAttribute(SQL_ATTR_MAX_ROWS, &maxRows, 0, nullptr);
+  BOOST_CHECK(IsSuccessful());
+  BOOST_CHECK_EQUAL(maxRows, 5);
+
+  int cancelCount = MockTimestreamService::GetInstance()->GetCancelCount();
+
+  std::string sql = "select measure, time from mockDB.mockTable10000";
+  stmt->ExecuteSqlQuery(sql);
+  BOOST_CHECK(IsSuccessful());
+
+  for (int i = 0; i < 5; i++) {
+    stmt->FetchRow();
+    BOOST_CHECK(IsSuccessful());
+  }
+
+  stmt->FetchRow();
+  BOOST_CHECK_EQUAL(GetReturnCode(), SQL_NO_DATA);
+
+  // the worker thread exits in the background after the statement is closed
+  stmt->Close();
+  dbc->GetBackgroundWorkers()->JoinAll();
+  BOOST_CHECK_EQUAL(MockTimestreamService::GetInstance()->GetCancelCount(),
+                    cancelCount + 1);
+  BOOST_CHECK_EQUAL(MockTimestreamService::GetInstance()->GetLastMaxRows(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(TestDataQueryMaxRowsAfterPrepare) {
+  // Test max rows set after the query is prepared is used by each
+  // execution of the prepared query
+  Connect();
+
+  stmt->PrepareSqlQuery("select measure, time from mockDB.mockTable10000");
+  BOOST_CHECK(IsSuccessful());
+
+  for (int maxRows = 2; maxRows <= 4; maxRows += 2) {
+    stmt->SetAttribute(SQL_ATTR_MAX_ROWS,
+                       reinterpret_cast< SQLPOINTER >(maxRows), 0);
+    BOOST_CHECK(IsSuccessful());
+
+    stmt->ExecuteSqlQuery();
+    BOOST_CHECK(IsSuccessful());
+
+    for (int i = 0; i < maxRows; i++) {
+      stmt->FetchRow();
+      BOOST_CHECK(IsSuccessful());
+    }
+
+    stmt->FetchRow();
+    BOOST_CHECK_EQUAL(GetReturnCode(), SQL_NO_DATA);
+    stmt->Close();
+  }
+
+  dbc->GetBackgroundWorkers()->JoinAll();
+}
+
+BOOST_AUTO_TEST_CASE(TestDataQueryRowArray) {
+  // Test fetching rowsets of column-wise bound arrays. The 3 rows of the
+  // page fill a rowset of 5 rows partly.
+  Connect();
+
+  const SQLULEN arraySize = 5;
+  SQLULEN rowsFetched = 0;
+  SQLUSMALLINT rowStatuses[arraySize]{};
+  stmt->SetAttribute(SQL_ATTR_ROW_ARRAY_SIZE,
+                     reinterpret_cast< SQLPOINTER >(arraySize), 0);
+  stmt->SetAttribute(SQL_ATTR_ROWS_FETCHED_PTR, &rowsFetched, 0);
+  stmt->SetAttribute(SQL_ATTR_ROW_STATUS_PTR, rowStatuses, 0);
+  BOOST_CHECK(IsSuccessful());
+
+  stmt->ExecuteSqlQuery("select measure, time from mockDB.mockTable");
+  BOOST_CHECK(IsSuccessful());
+
+  const int32_t buf_size = 32;
+  SQLWCHAR measure[arraySize][buf_size]{};
+  SQLLEN measure_len[arraySize]{};
+  stmt->BindColumn(1, SQL_C_WCHAR, measure, sizeof(measure[0]), measure_len);
+
+  SQL_TIMESTAMP_STRUCT timestamp[arraySize]{};
+  SQLLEN timestamp_len[arraySize]{};
+  stmt->BindColumn(2, SQL_C_TYPE_TIMESTAMP, timestamp, sizeof(timestamp[0]),
+                   timestamp_len);
+
+  stmt->FetchRow();
+  BOOST_CHECK(IsSuccessful());
+  BOOST_CHECK_EQUAL(rowsFetched, 3);
+  for (int i = 0; i < 3; i++) {
+    BOOST_CHECK_EQUAL(rowStatuses[i], SQL_ROW_SUCCESS);
+    BOOST_CHECK_EQUAL("cpu_usage",
+                      timestream::odbc::utility::SqlWcharToString(
+                          measure[i], measure_len[i], true));
+    BOOST_CHECK_EQUAL(timestamp_len[i], sizeof(SQL_TIMESTAMP_STRUCT));
+    BOOST_CHECK_EQUAL(timestamp[i].day, 9 + i);
+  }
+  BOOST_CHECK_EQUAL(rowStatuses[3], SQL_ROW_NOROW);
+  BOOST_CHECK_EQUAL(rowStatuses[4], SQL_ROW_NOROW);
+
+  stmt->FetchRow();
+  BOOST_CHECK_EQUAL(GetReturnCode(), SQL_NO_DATA);
+  BOOST_CHECK_EQUAL(rowsFetched, 0);
+}
+
+BOOST_AUTO_TEST_CASE(TestDataQueryRowArrayAcrossPages) {
+  // Test fetching rowsets of 4 rows from a result of 3-row pages with max
+  // rows 5. The first rowset spans two pages and the second one is cut by
+  // max rows.
+  Connect();
+
+  const SQLULEN arraySize = 4;
+  SQLULEN rowsFetched = 0;
+  SQLUSMALLINT rowStatuses[arraySize]{};
+  stmt->SetAttribute(SQL_ATTR_MAX_ROWS, reinterpret_cast< SQLPOINTER >(5), 0);
+  stmt->SetAttribute(SQL_ATTR_ROW_ARRAY_SIZE,
+                     reinterpret_cast< SQLPOINTER >(arraySize), 0);
+  stmt->SetAttribute(SQL_ATTR_ROWS_FETCHED_PTR, &rowsFetched, 0);
+  stmt->SetAttribute(SQL_ATTR_ROW_STATUS_PTR, rowStatuses, 0);
+  BOOST_CHECK(IsSuccessful());
+
+  stmt->ExecuteSqlQuery("select measure, time from mockDB.mockTable10000");
+  BOOST_CHECK(IsSuccessful());
+
+  SQL_TIMESTAMP_STRUCT timestamp[arraySize]{};
+  SQLLEN timestamp_len[arraySize]{};
+  stmt->BindColumn(2, SQL_C_TYPE_TIMESTAMP, timestamp, sizeof(timestamp[0]),
+                   timestamp_len);
+
+  stmt->FetchRow();
+  BOOST_CHECK(IsSuccessful());
+  BOOST_CHECK_EQUAL(rowsFetched, 4);
+  BOOST_CHECK_EQUAL(timestamp[0].day, 9);
+  BOOST_CHECK_EQUAL(timestamp[2].day, 11);
+  BOOST_CHECK_EQUAL(timestamp[3].day, 9);
+
+  stmt->FetchRow();
+  BOOST_CHECK(IsSuccessful());
+  BOOST_CHECK_EQUAL(rowsFetched, 1);
+  BOOST_CHECK_EQUAL(rowStatuses[0], SQL_ROW_SUCCESS);
+  BOOST_CHECK_EQUAL(timestamp[0].day, 10);
+  BOOST_CHECK_EQUAL(rowStatuses[1], SQL_ROW_NOROW);
+
+  stmt->Close();
+  dbc->GetBackgroundWorkers()->JoinAll();
+}
+
+BOOST_AUTO_TEST_CASE(TestDataQueryCloseCancelsQuery) {
+  // Test closing a cursor while pages are still being fetched. The close
+  // does not wait for the worker thread, the query is cancelled and the
+  // worker exits in the background.
+  Configuration cfg;
+  cfg.SetPrefetchPages(5);
+  Connect(cfg);
+
+  int cancelCount = MockTimestreamService::GetInstance()->GetCancelCount();
+
+  std::string sql = "select measure, time from mockDB.mockTable10000";
+  stmt->ExecuteSqlQuery(sql);
+  BOOST_CHECK(IsSuccessful());
+
+  for (int i = 0; i < 4; i++) {
+    stmt->FetchRow();
+    BOOST_CHECK(IsSuccessful());
+  }
+
+  stmt->Close();
+  BOOST_CHECK(IsSuccessful());
+  BOOST_CHECK_EQUAL(dbc->GetResultBufferBudget()->GetUsed(), 0);
+
+  dbc->GetBackgroundWorkers()->JoinAll();
+  BOOST_CHECK_EQUAL(dbc->GetBackgroundWorkers()->GetSize(), 0);
+  BOOST_CHECK_EQUAL(MockTimestreamService::GetInstance()->GetCancelCount(),
+                    cancelCount + 1);
+  BOOST_CHECK_EQUAL(dbc->GetResultBufferBudget()->GetUsed(), 0);
+
+  // the statement could be executed again after the close
+  stmt->ExecuteSqlQuery(sql);
+  BOOST_CHECK(IsSuccessful());
+  for (int i = 0; i < 10; i++) {
+    stmt->FetchRow();
+    BOOST_CHECK(IsSuccessful());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(TestDataQueryQueryTimeout) {
+  // Test executing a query which takes longer than the query timeout. The
+  // execution fails with HYT00 and the query is cancelled on the server.
+  Connect();
+
+  stmt->SetAttribute(SQL_ATTR_QUERY_TIMEOUT, reinterpret_cast< SQLPOINTER >(1),
+                     0);
+  BOOST_CHECK(IsSuccessful());
+
+  SQLULEN queryTimeout = 0;
+  stmt->GetAttribute(SQL_ATTR_QUERY_TIMEOUT, &queryTimeout, 0, nullptr);
+  BOOST_CHECK(IsSuccessful());
+  BOOST_CHECK_EQUAL(queryTimeout, 1);
+
+  int cancelCount = MockTimestreamService::GetInstance()->GetCancelCount();
+
+  stmt->ExecuteSqlQuery("select measure, time from mockDB.mockTableSlow");
+  BOOST_CHECK_EQUAL(GetReturnCode(), SQL_ERROR);
+  BOOST_CHECK_EQUAL(GetSqlState(), "HYT00");
+
+  // the worker cancels the query when its first page is returned
+  dbc->GetBackgroundWorkers()->JoinAll();
+  BOOST_CHECK_EQUAL(MockTimestreamService::GetInstance()->GetCancelCount(),
+                    cancelCount + 1);
+
+  // a query completed within the timeout is not affected
+  stmt->ExecuteSqlQuery("select measure, time from mockDB.mockTable");
+  BOOST_CHECK(IsSuccessful());
+  stmt->FetchRow();
+  BOOST_CHECK(IsSuccessful());
+}
+
+BOOST_AUTO_TEST_CASE(TestDataQueryQueryTimeoutOnFetch) {
+  // Test fetching a row of a page which takes longer than the query
+  // timeout. The fetch fails with HYT00 and the cursor is closed.
+  Connect();
+
+  stmt->SetAttribute(SQL_ATTR_QUERY_TIMEOUT, reinterpret_cast< SQLPOINTER >(1),
+                     0);
+  BOOST_CHECK(IsSuccessful());
+
+  stmt->ExecuteSqlQuery("select measure, time from mockDB.mockTableSlowPage");
+  BOOST_CHECK(IsSuccessful());
+
+  // the rows of the first page are returned
+  for (int i = 0; i < 3; i++) {
+    stmt->FetchRow();
+    BOOST_CHECK(IsSuccessful());
+  }
+
+  // the second page is not returned within the timeout
+  stmt->FetchRow();
+  BOOST_CHECK_EQUAL(GetReturnCode(), SQL_ERROR);
+  BOOST_CHECK_EQUAL(GetSqlState(), "HYT00");
+
+  // the closed cursor returns no more rows
+  stmt->FetchRow();
+  BOOST_CHECK(GetReturnCode() != SQL_SUCCESS);
+
+  dbc->GetBackgroundWorkers()->JoinAll();
+}
+
+BOOST_AUTO_TEST_CASE(TestDataQueryQueryTimeoutAfterPrepare) {
+  // Test the query timeout set after the query is prepared is used by the
+  // execution of the prepared query
+  Connect();
+
+  stmt->PrepareSqlQuery("select measure, time from mockDB.mockTableSlow");
+  BOOST_CHECK(IsSuccessful());
+
+  stmt->SetAttribute(SQL_ATTR_QUERY_TIMEOUT, reinterpret_cast< SQLPOINTER >(1),
+                     0);
+  BOOST_CHECK(IsSuccessful());
+
+  stmt->ExecuteSqlQuery();
+  BOOST_CHECK_EQUAL(GetReturnCode(), SQL_ERROR);
+  BOOST_CHECK_EQUAL(GetSqlState(), "HYT00");
+
+  dbc->GetBackgroundWorkers()->JoinAll();
+}
+
+BOOST_AUTO_TEST_CASE(TestDataQueryAsyncExecute) {
+  // Test executing a query in asynchronous polling mode
+  Connect();
+
+  stmt->SetAttribute(SQL_ATTR_ASYNC_ENABLE,
+                     reinterpret_cast< SQLPOINTER >(SQL_ASYNC_ENABLE_ON), 0);
+  BOOST_CHECK(IsSuccessful());
+
+  std::string sql = "select measure, time from mockDB.mockTable";
+  stmt->ExecuteSqlQuery(sql);
+  BOOST_CHECK_EQUAL(GetReturnCode(), SQL_STILL_EXECUTING);
+
+  while (GetReturnCode() == SQL_STILL_EXECUTING) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    stmt->ExecuteSqlQuery(sql);
+  }
+  BOOST_CHECK(IsSuccessful());
+
+  // the rows are fetched asynchronously too
+  for (int i = 0; i < 3; i++) {
+    PollAsync([this]() { stmt->FetchRow(); });
+    BOOST_CHECK(IsSuccessful());
+  }
+
+  PollAsync([this]() { stmt->FetchRow(); });
+  BOOST_CHECK_EQUAL(GetReturnCode(), SQL_NO_DATA);
+}
+
+BOOST_AUTO_TEST_CASE(TestDataQueryAsyncNotification) {
+  // Test the completion of the asynchronous execute and fetch is notified
+  // through the callback set by the Driver Manager
+  Connect();
+
+  AsyncNotification notification;
+  stmt->SetAttribute(SQL_ATTR_ASYNC_ENABLE,
+                     reinterpret_cast< SQLPOINTER >(SQL_ASYNC_ENABLE_ON), 0);
+  stmt->SetAttribute(
+      SQL_ATTR_ASYNC_STMT_NOTIFICATION_CALLBACK,
+      reinterpret_cast< SQLPOINTER >(&AsyncNotification::Callback), 0);
+  stmt->SetAttribute(SQL_ATTR_ASYNC_STMT_NOTIFICATION_CONTEXT, &notification,
+                     0);
+  BOOST_CHECK(IsSuccessful());
+
+  std::string sql = "select measure, time from mockDB.mockTable";
+  stmt->ExecuteSqlQuery(sql);
+  BOOST_CHECK_EQUAL(GetReturnCode(), SQL_STILL_EXECUTING);
+  BOOST_REQUIRE(notification.Wait(1));
+
+  // the call after the notification returns the result
+  stmt->ExecuteSqlQuery(sql);
+  BOOST_CHECK(IsSuccessful());
+
+  for (int i = 0; i < 3; i++) {
+    stmt->FetchRow();
+    BOOST_CHECK_EQUAL(GetReturnCode(), SQL_STILL_EXECUTING);
+    BOOST_REQUIRE(notification.Wait(i + 2));
+    stmt->FetchRow();
+    BOOST_CHECK(IsSuccessful());
+  }
+
+  // another function could not be called before the result is returned
+  stmt->FetchRow();
+  BOOST_REQUIRE(notification.Wait(5));
+  stmt->ExecuteSqlQuery(sql);
+  BOOST_CHECK_EQUAL(GetReturnCode(), SQL_ERROR);
+  BOOST_CHECK_EQUAL(GetSqlState(), "HY010");
+
+  stmt->FetchRow();
+  BOOST_CHECK_EQUAL(GetReturnCode(), SQL_NO_DATA);
+  BOOST_CHECK_EQUAL(notification.count, 5);
+}
+
+BOOST_AUTO_TEST_CASE(TestDataQueryAsyncExecuteCancel) {
+  // Test cancelling a query executing in asynchronous polling mode, the
+  // polling call returns the cancellation
+  Connect();
+
+  stmt->SetAttribute(SQL_ATTR_ASYNC_ENABLE,
+                     reinterpret_cast< SQLPOINTER >(SQL_ASYNC_ENABLE_ON), 0);
+  BOOST_CHECK(IsSuccessful());
+
+  std::string sql = "select measure, time from mockDB.mockTable10000";
+  stmt->ExecuteSqlQuery(sql);
+  BOOST_CHECK_EQUAL(GetReturnCode(), SQL_STILL_EXECUTING);
+
+  stmt->CancelSqlQuery();
+  BOOST_CHECK(IsSuccessful());
+
+  do {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    stmt->ExecuteSqlQuery(sql);
+  } while (GetReturnCode() == SQL_STILL_EXECUTING);
+  BOOST_CHECK_EQUAL(GetReturnCode(), SQL_ERROR);
+  BOOST_CHECK_EQUAL(GetSqlState(), "HY008");
+}
+
+BOOST_AUTO_TEST_CASE(TestDataQueryAsyncCancelInterrupts) {
+  // Test cancelling a query waiting for a slow first page. The execution
+  // stops waiting and the query is cancelled on the server.
+  Connect();
+
+  stmt->SetAttribute(SQL_ATTR_ASYNC_ENABLE,
+                     reinterpret_cast< SQLPOINTER >(SQL_ASYNC_ENABLE_ON), 0);
+  BOOST_CHECK(IsSuccessful());
+
+  int cancelCount = MockTimestreamService::GetInstance()->GetCancelCount();
+
+  std::string sql = "select measure, time from mockDB.mockTableSlow";
+  auto start = std::chrono::steady_clock::now();
+  stmt->ExecuteSqlQuery(sql);
+  BOOST_CHECK_EQUAL(GetReturnCode(), SQL_STILL_EXECUTING);
+
+  stmt->CancelSqlQuery();
+  BOOST_CHECK(IsSuccessful());
+
+  PollAsync([this, &sql]() { stmt->ExecuteSqlQuery(sql); });
+  BOOST_CHECK_EQUAL(GetReturnCode(), SQL_ERROR);
+  BOOST_CHECK_EQUAL(GetSqlState(), "HY008");
+
+  // the first page takes 2 seconds
+  std::chrono::duration< double > elapsed =
+      std::chrono::steady_clock::now() - start;
+  BOOST_CHECK_LT(elapsed.count(), 1.5);
+
+  dbc->GetBackgroundWorkers()->JoinAll();
+  BOOST_CHECK_EQUAL(MockTimestreamService::GetInstance()->GetCancelCount(),
+                    cancelCount + 1);
+
+  // the statement executes again after the cancellation
+  PollAsync([this]() {
+    stmt->ExecuteSqlQuery("select measure, time from mockDB.mockTable");
+  });
+  BOOST_CHECK(IsSuccessful());
+}
+
+BOOST_AUTO_TEST_CASE(TestDataQueryAsyncCancelFromAnotherThread) {
+  // Test cancelling a query from another thread while the application
+  // thread polls it. Each thread reads the result of its own call.
+  Connect();
+
+  stmt->SetAttribute(SQL_ATTR_ASYNC_ENABLE,
+                     reinterpret_cast< SQLPOINTER >(SQL_ASYNC_ENABLE_ON), 0);
+  BOOST_CHECK(IsSuccessful());
+
+  std::string sql = "select measure, time from mockDB.mockTableSlow";
+  stmt->ExecuteSqlQuery(sql);
+  BOOST_CHECK_EQUAL(GetReturnCode(), SQL_STILL_EXECUTING);
+
+  bool cancelled = false;
+  std::thread canceller([this, &cancelled]() {
+    stmt->CancelSqlQuery();
+    cancelled = IsSuccessful();
+  });
+
+  canceller.join();
+  BOOST_CHECK(cancelled);
+
+  // the result of the last polling call is not changed by SQLCancel
+  BOOST_CHECK_EQUAL(GetReturnCode(), SQL_STILL_EXECUTING);
+
+  PollAsync([this, &sql]() { stmt->ExecuteSqlQuery(sql); });
+  BOOST_CHECK_EQUAL(GetReturnCode(), SQL_ERROR);
+  BOOST_CHECK_EQUAL(GetSqlState(), "HY008");
+
+  dbc->GetBackgroundWorkers()->JoinAll();
+}
+
+BOOST_AUTO_TEST_CASE(TestDataQueryAsyncRejectsOtherFunctions) {
+  // Test the statement functions fail with HY010 while an asynchronous
+  // operation is running, the operation is not affected
+  Connect();
+
+  stmt->SetAttribute(SQL_ATTR_ASYNC_ENABLE,
+                     reinterpret_cast< SQLPOINTER >(SQL_ASYNC_ENABLE_ON), 0);
+  BOOST_CHECK(IsSuccessful());
+
+  std::string sql = "select measure, time from mockDB.mockTableSlow";
+  stmt->ExecuteSqlQuery(sql);
+  BOOST_CHECK_EQUAL(GetReturnCode(), SQL_STILL_EXECUTING);
+
+  stmt->GetColumnNumber();
+  BOOST_CHECK_EQUAL(GetReturnCode(), SQL_ERROR);
+  BOOST_CHECK_EQUAL(GetSqlState(), "HY010");
+
+  stmt->SetAttribute(SQL_ATTR_MAX_ROWS, reinterpret_cast< SQLPOINTER >(1), 0);
+  BOOST_CHECK_EQUAL(GetReturnCode(), SQL_ERROR);
+  BOOST_CHECK_EQUAL(GetSqlState(), "HY010");
+
+  stmt->ExecuteGetTypeInfoQuery(SQL_ALL_TYPES);
+  BOOST_CHECK_EQUAL(GetReturnCode(), SQL_ERROR);
+  BOOST_CHECK_EQUAL(GetSqlState(), "HY010");
+
+  stmt->Close();
+  BOOST_CHECK_EQUAL(GetReturnCode(), SQL_ERROR);
+  BOOST_CHECK_EQUAL(GetSqlState(), "HY010");
+
+  PollAsync([this, &sql]() { stmt->ExecuteSqlQuery(sql); });
+  BOOST_CHECK(IsSuccessful());
+  BOOST_CHECK_EQUAL(stmt->GetColumnNumber(), 2);
+  BOOST_CHECK(IsSuccessful());
+}
+
+BOOST_AUTO_TEST_CASE(TestDataQueryTimeRangeFanOut) {
+  // Test a query split into 4 time ranges read in time order
+  CheckTimeRangeFanOut(true);
+}
+
+BOOST_AUTO_TEST_CASE(TestDataQueryTimeRangeFanOutUnordered) {
+  // Test a query split into 4 time ranges read in any order
+  CheckTimeRangeFanOut(false);
+}
+
+BOOST_AUTO_TEST_CASE(TestDataQueryResultCache) {
+  // Test the result is written to the result cache when all rows are
+  // fetched, and the query executed again is served from the cache
+  Configuration cfg;
+  std::string directory = MakeCacheDirectory();
+  cfg.SetResultCacheTTL(60);
+  cfg.SetResultCachePath(directory);
+  Connect(cfg);
+
+  std::string sql = "select measure, time from mockDB.mockTable";
+  std::vector< Aws::TimestreamQuery::Model::QueryResult > pages;
+  BOOST_REQUIRE(dbc->GetResultCache());
+  BOOST_CHECK(!dbc->GetResultCache()->Get(sql, pages));
+  for (int run = 0; run < 2; run++) {
+    stmt->ExecuteSqlQuery(sql);
+    BOOST_CHECK(IsSuccessful());
+
+    SQL_TIMESTAMP_STRUCT timestamp;
+    SQLLEN timestamp_len = 0;
+    stmt->BindColumn(2, SQL_C_TYPE_TIMESTAMP, &timestamp, sizeof(timestamp),
+                     &timestamp_len);
+
+    for (int i = 0; i < 3; i++) {
+      stmt->FetchRow();
+      BOOST_CHECK(IsSuccessful());
+    }
+    BOOST_CHECK_EQUAL(timestamp.day, 11);
+
+    stmt->FetchRow();
+    BOOST_CHECK_EQUAL(GetReturnCode(), SQL_NO_DATA);
+    stmt->Close();
+
+    BOOST_CHECK(dbc->GetResultCache()->Get(sql, pages));
+    BOOST_CHECK_EQUAL(pages.size(), 1);
+  }
+
+  ignite::odbc::common::DeletePath(directory);
+}
+
+BOOST_AUTO_TEST_CASE(TestDataQueryResultCacheEmptyFirstPage) {
+  // Test a result whose first page has no rows is fetched by a worker,
+  // cached and replayed with all of its rows
+  Configuration cfg;
+  std::string directory = MakeCacheDirectory();
+  cfg.SetResultCacheTTL(60);
+  cfg.SetResultCachePath(directory);
+  Connect(cfg);
+
+  // the pages are fetched by a worker when the query timeout is set
+  stmt->SetAttribute(SQL_ATTR_QUERY_TIMEOUT,
+                     reinterpret_cast< SQLPOINTER >(10), 0);
+  BOOST_CHECK(IsSuccessful());
+
+  std::string sql = "select measure, time from mockDB.mockTableEmptyFirst";
+  for (int run = 0; run < 2; run++) {
+    stmt->ExecuteSqlQuery(sql);
+    BOOST_CHECK(IsSuccessful());
+
+    for (int i = 0; i < 3; i++) {
+      stmt->FetchRow();
+      BOOST_CHECK(IsSuccessful());
+    }
+
+    stmt->FetchRow();
+    BOOST_CHECK_EQUAL(GetReturnCode(), SQL_NO_DATA);
+    stmt->Close();
+
+    // the empty page is not cached
+    std::vector< Aws::TimestreamQuery::Model::QueryResult > pages;
+    BOOST_REQUIRE(dbc->GetResultCache());
+    BOOST_CHECK(dbc->GetResultCache()->Get(sql, pages));
+    BOOST_CHECK_EQUAL(pages.size(), 1);
+  }
+
+  ignite::odbc::common::DeletePath(directory);
+}
+
+BOOST_AUTO_TEST_CASE(TestDataQueryStaticCursor) {
+  // Test scrolling a static cursor over a result of 4 pages, each page
+  // contains the rows of day 9, 10 and 11
+  Configuration cfg;
+  cfg.SetQueryFanOut(4);
+  Connect(cfg);
+
+  stmt->SetAttribute(SQL_ATTR_CURSOR_TYPE,
+                     reinterpret_cast< SQLPOINTER >(SQL_CURSOR_STATIC), 0);
+  BOOST_CHECK(IsSuccessful());
+
+  std::string sql =
+      "select measure, time from mockDB.mockTableRange where time between "
+      "'2022-11-09 00:00:00' and '2022-11-12 00:00:00'";
+  stmt->ExecuteSqlQuery(sql);
+  BOOST_CHECK(IsSuccessful());
+
+  SQL_TIMESTAMP_STRUCT timestamp;
+  SQLLEN timestamp_len = 0;
+  stmt->BindColumn(2, SQL_C_TYPE_TIMESTAMP, &timestamp, sizeof(timestamp),
+                   &timestamp_len);
+
+  stmt->FetchScroll(SQL_FETCH_LAST, 0);
+  BOOST_CHECK(IsSuccessful());
+  BOOST_CHECK_EQUAL(timestamp.day, 11);
+
+  stmt->FetchScroll(SQL_FETCH_PRIOR, 0);
+  BOOST_CHECK(IsSuccessful());
+  BOOST_CHECK_EQUAL(timestamp.day, 10);
+
+  stmt->FetchScroll(SQL_FETCH_ABSOLUTE, 4);
+  BOOST_CHECK(IsSuccessful());
+  BOOST_CHECK_EQUAL(timestamp.day, 9);
+
+  stmt->FetchScroll(SQL_FETCH_RELATIVE, -2);
+  BOOST_CHECK(IsSuccessful());
+  BOOST_CHECK_EQUAL(timestamp.day, 10);
+
+  stmt->FetchScroll(SQL_FETCH_ABSOLUTE, -1);
+  BOOST_CHECK(IsSuccessful());
+  BOOST_CHECK_EQUAL(timestamp.day, 11);
+
+  stmt->FetchScroll(SQL_FETCH_FIRST, 0);
+  BOOST_CHECK(IsSuccessful());
+  BOOST_CHECK_EQUAL(timestamp.day, 9);
+
+  stmt->FetchScroll(SQL_FETCH_PRIOR, 0);
+  BOOST_CHECK_EQUAL(GetReturnCode(), SQL_NO_DATA);
+
+  // the cursor is before the first row
+  stmt->FetchRow();
+  BOOST_CHECK(IsSuccessful());
+  BOOST_CHECK_EQUAL(timestamp.day, 9);
+
+  stmt->FetchScroll(SQL_FETCH_ABSOLUTE, 13);
+  BOOST_CHECK_EQUAL(GetReturnCode(), SQL_NO_DATA);
+
+  // the cursor is after the last row
+  stmt->FetchScroll(SQL_FETCH_PRIOR, 0);
+  BOOST_CHECK(IsSuccessful());
+  BOOST_CHECK_EQUAL(timestamp.day, 11);
+
+  stmt->FetchScroll(SQL_FETCH_BOOKMARK, 0);
+  BOOST_CHECK_EQUAL(GetReturnCode(), SQL_ERROR);
+  BOOST_CHECK_EQUAL(GetSqlState(), "HY106");
+}
+
+BOOST_AUTO_TEST_CASE(TestDataQueryForwardOnlyCursorScroll) {
+  // Test a forward-only cursor could only fetch the next row
+  Connect();
+
+  std::string sql = "select measure, time from mockDB.mockTable";
+  stmt->ExecuteSqlQuery(sql);
+  BOOST_CHECK(IsSuccessful());
+
+  stmt->FetchScroll(SQL_FETCH_NEXT, 0);
+  BOOST_CHECK(IsSuccessful());
+
+  stmt->FetchScroll(SQL_FETCH_PRIOR, 0);
+  BOOST_CHECK_EQUAL(GetReturnCode(), SQL_ERROR);
+  BOOST_CHECK_EQUAL(GetSqlState(), "HYC00");
+}
+
 BOOST_AUTO_TEST_CASE(TestDataQuery10RowWithError) {
   // Test fetching 10 rows and each page contains 3 rows.
   // When fetch the 10th row, the outcome contains an error.
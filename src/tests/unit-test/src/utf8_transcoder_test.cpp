@@ -0,0 +1,135 @@
+/*
+ * Copyright <2022> Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "timestream/odbc/utf8_transcoder.h"
+
+using timestream::odbc::Utf8Transcoder;
+using namespace boost::unit_test;
+
+namespace {
+std::u16string ToUtf16(const std::string& in) {
+  std::u16string out(in.size(), u'\0');
+  Utf8Transcoder::Result res =
+      Utf8Transcoder::Transcode(in.data(), in.size(), &out[0], out.size());
+  BOOST_CHECK(!res.invalid);
+  BOOST_CHECK_EQUAL(res.read, in.size());
+  out.resize(res.written);
+  return out;
+}
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(Utf8TranscoderTestSuite)
+
+BOOST_AUTO_TEST_CASE(TestTranscode) {
+  BOOST_CHECK(ToUtf16("") == u"");
+  BOOST_CHECK(ToUtf16("cpu_usage") == u"cpu_usage");
+  BOOST_CHECK(ToUtf16("host-24Gju.amazonaws.com/us-east-1")
+              == u"host-24Gju.amazonaws.com/us-east-1");
+  BOOST_CHECK(ToUtf16(u8"région é 中文 and more ascii text")
+              == u"région é 中文 and more ascii text");
+
+  // characters above U+FFFF are surrogate pairs in UTF-16
+  BOOST_CHECK(ToUtf16("\xF0\x9F\x98\x80") == u"\U0001F600");
+
+  char32_t out32[4];
+  Utf8Transcoder::Result res =
+      Utf8Transcoder::Transcode("a\xF0\x9F\x98\x80", 5, out32, 4);
+  BOOST_CHECK_EQUAL(res.written, 2);
+  BOOST_CHECK(out32[1] == U'\U0001F600');
+}
+
+BOOST_AUTO_TEST_CASE(TestTranscodeInvalid) {
+  char16_t out[32];
+
+  // overlong, surrogate, beyond U+10FFFF, stray continuation, incomplete
+  const char* invalid[] = {"ab\xC0\xAF", "ab\xED\xA0\x80", "ab\xF4\x90\x80\x80",
+                           "ab\x80", "ab\xE4\xB8"};
+  for (const char* str : invalid) {
+    std::string in(str);
+    Utf8Transcoder::Result res =
+        Utf8Transcoder::Transcode(in.data(), in.size(), out, 32);
+    BOOST_CHECK(res.invalid);
+    BOOST_CHECK_EQUAL(res.read, 2);
+    BOOST_CHECK_EQUAL(res.written, 2);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(TestTranscodeTruncated) {
+  // transcoding stops before a character the output has no room for
+  std::string in = std::string(20, 'x') + "\xF0\x9F\x98\x80";
+  char16_t out[21];
+  Utf8Transcoder::Result res =
+      Utf8Transcoder::Transcode(in.data(), in.size(), out, 21);
+  BOOST_CHECK(!res.invalid);
+  BOOST_CHECK_EQUAL(res.read, 20);
+  BOOST_CHECK_EQUAL(res.written, 20);
+
+  res = Utf8Transcoder::Transcode(in.data(), in.size(), out, 10);
+  BOOST_CHECK_EQUAL(res.read, 10);
+  BOOST_CHECK_EQUAL(res.written, 10);
+
+  BOOST_CHECK_EQUAL(Utf8Transcoder::CountUtf16(in.data(), in.size()), 22);
+  BOOST_CHECK_EQUAL(Utf8Transcoder::CountUtf32(in.data(), in.size()), 21);
+}
+
+BOOST_AUTO_TEST_CASE(TestTranscodeMatchesScalar) {
+  // the ASCII fast path gives the same output as the scalar transcoder for
+  // mixed text, including invalid bytes and short output buffers
+  const char* pieces[] = {"a",   "measure_value::double", u8"é", u8"中",
+                          "\xF0\x9F\x98\x80", "\xFF", " "};
+  std::mt19937 gen(42);
+  std::uniform_int_distribution< size_t > pick(0, 6);
+  std::uniform_int_distribution< size_t > pickLen(0, 64);
+
+  for (int i = 0; i < 2000; i++) {
+    std::string in;
+    size_t n = pickLen(gen);
+    for (size_t j = 0; j < n; j++) {
+      size_t k = pick(gen);
+      // invalid bytes are rare so most strings are transcoded to the end
+      in += (k == 5 && j % 7 != 0) ? pieces[0] : pieces[k];
+    }
+    size_t outLen = pickLen(gen) * 2;
+
+    std::vector< char16_t > fast(outLen + 1, 0);
+    std::vector< char16_t > scalar(outLen + 1, 0);
+    Utf8Transcoder::Result fastRes =
+        Utf8Transcoder::Transcode(in.data(), in.size(), fast.data(), outLen);
+    Utf8Transcoder::Result scalarRes = Utf8Transcoder::TranscodeScalar(
+        in.data(), in.size(), scalar.data(), outLen);
+    BOOST_CHECK_EQUAL(fastRes.read, scalarRes.read);
+    BOOST_CHECK_EQUAL(fastRes.written, scalarRes.written);
+    BOOST_CHECK_EQUAL(fastRes.invalid, scalarRes.invalid);
+    BOOST_CHECK(fast == scalar);
+
+    std::vector< char32_t > fast32(outLen + 1, 0);
+    std::vector< char32_t > scalar32(outLen + 1, 0);
+    fastRes = Utf8Transcoder::Transcode(in.data(), in.size(), fast32.data(),
+                                        outLen);
+    scalarRes = Utf8Transcoder::TranscodeScalar(in.data(), in.size(),
+                                                scalar32.data(), outLen);
+    BOOST_CHECK_EQUAL(fastRes.written, scalarRes.written);
+    BOOST_CHECK(fast32 == scalar32);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
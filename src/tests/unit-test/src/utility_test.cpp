@@ -18,6 +18,7 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <timestream/odbc/system/odbc_constants.h>
 #include <timestream/odbc/utils.h>
 #include <timestream/odbc/utility.h>
 
@@ -112,6 +113,47 @@ BOOST_AUTO_TEST_CASE(TestUtilityCopyStringToBuffer) {
   BOOST_CHECK_EQUAL(wstr.size() * sizeof(SQLWCHAR), bytesWrittenOrRequired);
 }
 
+BOOST_AUTO_TEST_CASE(TestUtilityCopyUtf8StringToSqlCharString) {
+  SQLCHAR buffer[64];
+  bool isTruncated = false;
+
+  // ASCII strings are copied directly
+  std::string str("host-24Gju.amazonaws.com/us-east-1");
+  size_t bytesWritten = CopyUtf8StringToSqlCharString(
+      str.c_str(), buffer, sizeof(buffer), isTruncated);
+  BOOST_CHECK_EQUAL(str.size(), bytesWritten);
+  BOOST_CHECK(!isTruncated);
+  BOOST_CHECK_EQUAL(str, reinterpret_cast< char* >(buffer));
+
+  bytesWritten =
+      CopyUtf8StringToSqlCharString(str.c_str(), buffer, 5, isTruncated);
+  BOOST_CHECK_EQUAL(4, bytesWritten);
+  BOOST_CHECK(isTruncated);
+  BOOST_CHECK_EQUAL("host", reinterpret_cast< char* >(buffer));
+
+  bytesWritten = CopyUtf8StringToSqlCharString("", buffer, 1, isTruncated);
+  BOOST_CHECK_EQUAL(0, bytesWritten);
+  BOOST_CHECK(!isTruncated);
+  BOOST_CHECK_EQUAL(0, buffer[0]);
+
+  if (ANSI_STRING_ONLY) {
+    return;
+  }
+
+  // other strings are narrowed one character per code point
+  std::string utf8String = u8"你好 - data";
+  bytesWritten = CopyUtf8StringToSqlCharString(
+      utf8String.c_str(), buffer, sizeof(buffer), isTruncated);
+  BOOST_CHECK_EQUAL(9, bytesWritten);
+  BOOST_CHECK(!isTruncated);
+  BOOST_CHECK_EQUAL(" - data", reinterpret_cast< char* >(buffer) + 2);
+
+  bytesWritten = CopyUtf8StringToSqlCharString(utf8String.c_str(), buffer, 3,
+                                               isTruncated);
+  BOOST_CHECK_EQUAL(2, bytesWritten);
+  BOOST_CHECK(isTruncated);
+}
+
 // Enable test to determine efficiency of conversion function.
 BOOST_AUTO_TEST_CASE(TestUtilityCopyStringToBufferRepetative, *disabled()) {
   char cch;